@@ -0,0 +1,7 @@
+# cmake/projects/bit_kernel_bench.cmake
+# (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+# Microbenchmark: per-bit I/O loops vs. word-level bitkernels.
+
+add_executable(bitKernelBench cmd/bitKernelBench/main.cpp)
+target_link_libraries(bitKernelBench PRIVATE crsce_static)
+add_dependencies(bitKernelBench crsce_static)
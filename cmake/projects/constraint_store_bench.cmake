@@ -0,0 +1,7 @@
+# cmake/projects/constraint_store_bench.cmake
+# (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+# Microbenchmark: former byte-array ConstraintStore vs. the bit-plane store.
+
+add_executable(constraintStoreBench cmd/constraintStoreBench/main.cpp)
+target_link_libraries(constraintStoreBench PRIVATE crsce_static)
+add_dependencies(constraintStoreBench crsce_static)
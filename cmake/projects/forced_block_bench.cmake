@@ -0,0 +1,7 @@
+# cmake/projects/forced_block_bench.cmake
+# (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+# Microbenchmark: constant-block decode, solver vs. forced-by-propagation fast path.
+
+add_executable(forcedBlockBench cmd/forcedBlockBench/main.cpp)
+target_link_libraries(forcedBlockBench PRIVATE crsce_static)
+add_dependencies(forcedBlockBench crsce_static)
@@ -55,6 +55,9 @@ include(cmake/projects/row_solver.cmake)
 include(cmake/projects/combinator_solver.cmake)
 include(cmake/projects/overlap_solver.cmake)
 include(cmake/projects/combinator_solver_191.cmake)
+include(cmake/projects/bit_kernel_bench.cmake)
+include(cmake/projects/forced_block_bench.cmake)
+include(cmake/projects/constraint_store_bench.cmake)
 include(cmake/pipeline/sources.cmake)
 
 # --- clang-tidy integration (optional) ---
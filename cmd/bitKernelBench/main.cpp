@@ -0,0 +1,207 @@
+/**
+ * @file cmd/bitKernelBench/main.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt.
+ * @brief Microbenchmark: per-bit I/O loops vs. the word-level bitkernels.
+ *
+ * Times the former bit-at-a-time implementations of block loading, block slicing
+ * (FileBitSerializer::popBits), Csm::vec serialization, and row-to-byte
+ * marshalling (LH / BH message layout) against the bitkernels replacements, on a
+ * non-byte-aligned block (bit offset 16,129).
+ *
+ * Usage:
+ *   bitKernelBench [-iters <n>]
+ */
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "common/BitKernels/BitKernels.h"
+#include "common/Csm/Csm.h"
+
+using namespace crsce; // NOLINT
+
+static constexpr std::uint16_t kS = 127;
+static constexpr std::uint32_t kBlockBits = kS * kS;
+
+/**
+ * @name sink
+ * @brief Accumulator that keeps the optimizer from discarding benchmark results.
+ */
+static volatile std::uint64_t sink = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @name legacyLoad
+ * @brief Former per-bit block load (Compressor slicing + loadCsm / loadOverlappingBlock).
+ */
+static common::Csm legacyLoad(const std::vector<std::uint8_t> &data, const std::size_t startBit) {
+    common::Csm csm;
+    for (std::size_t i = 0; i < kBlockBits; ++i) {
+        const auto srcBit = startBit + i;
+        const auto srcByte = srcBit / 8;
+        if (srcByte >= data.size()) { break; }
+        const auto v = static_cast<std::uint8_t>((data[srcByte] >> (7 - (srcBit % 8))) & 1U);
+        csm.set(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS), v);
+    }
+    return csm;
+}
+
+/**
+ * @name legacySlice
+ * @brief Former FileBitSerializer::popBits slicing: at most one source byte (8 bits) per step.
+ */
+static void legacySlice(const std::vector<std::uint8_t> &data, const std::size_t startBit,
+                        std::vector<std::uint8_t> &dst) {
+    dst.assign((kBlockBits + 7) / 8, 0);
+    std::size_t got = 0;
+    std::size_t pos = startBit;
+    while (got < kBlockBits) {
+        const auto take = std::min<std::size_t>(8 - (pos % 8), kBlockBits - got);
+        auto bits = static_cast<std::uint8_t>(data[pos / 8] << (pos % 8));
+        bits = static_cast<std::uint8_t>(bits & static_cast<std::uint8_t>(0xFFU << (8U - take)));
+        const auto dstShift = static_cast<unsigned>(got % 8);
+        dst[got / 8] |= static_cast<std::uint8_t>(bits >> dstShift);
+        if (dstShift + take > 8) {
+            dst[(got / 8) + 1] |= static_cast<std::uint8_t>(bits << (8U - dstShift));
+        }
+        got += take;
+        pos += take;
+    }
+}
+
+/**
+ * @name kernelSlice
+ * @brief FileBitSerializer::popBits slicing: up to 64 bits per step via loadBits64 / orBits64.
+ */
+static void kernelSlice(const std::vector<std::uint8_t> &data, const std::size_t startBit,
+                        std::vector<std::uint8_t> &dst) {
+    dst.assign((kBlockBits + 7) / 8, 0);
+    for (std::size_t got = 0; got < kBlockBits;) {
+        const auto take = std::min<std::size_t>(64, kBlockBits - got);
+        common::bitkernels::orBits64(dst.data(), dst.size(), got,
+                                     common::bitkernels::loadBits64(data.data(), data.size(), startBit + got),
+                                     static_cast<unsigned>(take));
+        got += take;
+    }
+}
+
+/**
+ * @name legacyVec
+ * @brief Former per-bit Csm::vec serialization.
+ */
+static std::vector<std::uint8_t> legacyVec(const common::Csm &csm) {
+    std::vector<std::uint8_t> out((kBlockBits + 7) / 8, 0);
+    std::uint32_t bitIdx = 0;
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        const auto row = csm.getRow(r);
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            if (((row[c / 64] >> (63 - (c % 64))) & 1ULL) != 0) { // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                out[bitIdx / 8] |= static_cast<std::uint8_t>(1U << (7 - (bitIdx % 8)));
+            }
+            ++bitIdx;
+        }
+    }
+    return out;
+}
+
+/**
+ * @name legacyRowBytes
+ * @brief Former byte-at-a-time row marshalling (LateralHash / verifyRow / BlockHash).
+ */
+static std::array<std::uint8_t, 16> legacyRowBytes(const std::array<std::uint64_t, 2> &row) {
+    std::array<std::uint8_t, 16> msg{};
+    for (int w = 0; w < 2; ++w) {
+        for (int b = 7; b >= 0; --b) {
+            msg[(w * 8) + (7 - b)] = static_cast<std::uint8_t>(row[w] >> (b * 8)); // NOLINT
+        }
+    }
+    return msg;
+}
+
+/**
+ * @name timeNs
+ * @brief Run fn() iters times and return mean nanoseconds per call.
+ */
+template <typename Fn>
+static double timeNs(const int iters, Fn &&fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; ++i) {
+        fn();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) / iters;
+}
+
+/**
+ * @name report
+ * @brief Print one legacy-vs-kernel comparison line.
+ */
+static void report(const char *name, const double legacy, const double kernel) {
+    std::printf("%-24s legacy %10.1f ns   kernel %10.1f ns   speedup %6.1fx\n", name, legacy, kernel, legacy / kernel);
+}
+
+int main(const int argc, const char *const argv[]) { // NOLINT
+    int iters = 2000;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i]; // NOLINT
+        if (arg == "-iters" && i + 1 < argc) { iters = std::atoi(argv[++i]); } // NOLINT
+    }
+    if (iters <= 0) {
+        std::fprintf(stderr, "usage: bitKernelBench [-iters <n>]\n");
+        return 1;
+    }
+
+    // Two blocks of pseudo-random input; the benchmark loads the second (mid-byte) block.
+    std::vector<std::uint8_t> data(((2 * kBlockBits) + 7) / 8);
+    std::uint32_t x = 0x9E3779B9U;
+    for (auto &b : data) {
+        x ^= x << 13U;
+        x ^= x >> 17U;
+        x ^= x << 5U;
+        b = static_cast<std::uint8_t>(x);
+    }
+    const std::size_t start = kBlockBits;
+
+    const auto ref = legacyLoad(data, start);
+    common::Csm fast;
+    common::bitkernels::unpackRows(data.data(), data.size(), start, kBlockBits, fast);
+    if (ref.vec() != legacyVec(fast)) {
+        std::fprintf(stderr, "bitKernelBench: kernel output differs from reference\n");
+        return 2;
+    }
+
+    report("load block (unaligned)",
+           timeNs(iters, [&] { sink = sink + legacyLoad(data, start).getRow(0)[0]; }),
+           timeNs(iters, [&] {
+               common::Csm csm;
+               common::bitkernels::unpackRows(data.data(), data.size(), start, kBlockBits, csm);
+               sink = sink + csm.getRow(0)[0];
+           }));
+    std::vector<std::uint8_t> sliced;
+    std::vector<std::uint8_t> slicedRef;
+    legacySlice(data, start, slicedRef);
+    kernelSlice(data, start, sliced);
+    if (sliced != slicedRef) {
+        std::fprintf(stderr, "bitKernelBench: slice output differs from reference\n");
+        return 2;
+    }
+    report("slice block (unaligned)",
+           timeNs(iters, [&] { legacySlice(data, start, slicedRef); sink = sink + slicedRef[7]; }),
+           timeNs(iters, [&] { kernelSlice(data, start, sliced); sink = sink + sliced[7]; }));
+    report("Csm::vec",
+           timeNs(iters, [&] { sink = sink + legacyVec(ref)[1]; }),
+           timeNs(iters, [&] { sink = sink + ref.vec()[1]; }));
+    report("row bytes x kS",
+           timeNs(iters, [&] {
+               for (std::uint16_t r = 0; r < kS; ++r) { sink = sink + legacyRowBytes(ref.getRow(r))[3]; }
+           }),
+           timeNs(iters, [&] {
+               for (std::uint16_t r = 0; r < kS; ++r) { sink = sink + common::bitkernels::rowToBytes(ref.getRow(r))[3]; }
+           }));
+    return 0;
+}
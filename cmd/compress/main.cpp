@@ -8,6 +8,7 @@
 #include "common/O11y/O11y.h"
 #include "compress/Cli/Heartbeat.h"
 #include "common/ArgParser/ArgParser.h"
+#include "common/Util/is_stdio_path.h"
 #include "common/exceptions/CliInputMissing.h"
 #include "common/exceptions/CliOutputExists.h"
 #include "common/exceptions/CliHelpRequested.h"
@@ -18,6 +19,7 @@
 #include <cstddef>
 #include <cstdint> // NOLINT
 #include <cstdio>
+#include <string>
 
 /**
  * @brief Program entry point for compressor CLI.
@@ -31,13 +33,21 @@ auto main(const int argc, char *argv[]) -> int {
 
         const std::span<char *> args{argv, static_cast<std::size_t>(argc)};
         const crsce::common::ArgParser parser("compress", args);
-        const auto &[input, output, help] = parser.options();
+        const auto &[input, output, help, threads, range, resume] = parser.options();
+        if (range || resume) {
+            // -range and -resume only apply to decompress.
+            throw crsce::common::exceptions::CliParseError(parser.usage());
+        }
 
-        ::crsce::o11y::O11y::instance().event("compress_begin", {{"in", input}, {"out", output}});
+        ::crsce::o11y::O11y::instance().event("compress_begin", {{"in", input}, {"out", output},
+                                                                {"threads", std::to_string(threads)}});
 
         crsce::compress::cli::Heartbeat heartbeat;
-        heartbeat.start();
-        const int rc = crsce::compress::cli::run(input, output);
+        if (!crsce::common::util::is_stdio_path(output)) {
+            // The heartbeat prints to stdout, which carries the data stream with -out -.
+            heartbeat.start();
+        }
+        const int rc = crsce::compress::cli::run(input, output, threads);
         ::crsce::o11y::O11y::instance().event("compress_end", {{"status", (rc == 0 ? std::string("OK") : std::string("FAIL"))}});
         heartbeat.wait();
 
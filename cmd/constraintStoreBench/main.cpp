@@ -0,0 +1,506 @@
+/**
+ * @file cmd/constraintStoreBench/main.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt.
+ * @brief Microbenchmark: the former ConstraintStore (per-cell byte array) vs. the current store.
+ *
+ * The former store kept every cell three ways: a CellState byte per cell, the value bits
+ * (rowBits_) and the known bits (assigned_). assign/unassign wrote all three and every
+ * getCellState probe was an out-of-line call reading the byte array. This benchmark replays
+ * that store (LegacyStore, its methods kept out of line as they were in the library) and the
+ * former forcing loop against ConstraintStore and PropagationEngine on the same block:
+ * assign/unassign throughput, a full-matrix getCellState scan, and line forcing
+ * (propagate + undo). The legacy side also keeps the former per-update line arithmetic
+ * (diagonal/anti-diagonal indices computed, LTP lines via ltpMembership()); the current store
+ * reads CellLineTable. A last case times RowSerialSolver's row-candidate step with the former
+ * snapshot undo against mark()/rollback().
+ *
+ * Usage:
+ *   constraintStoreBench [-iters <n>]
+ */
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/Csm/Csm.h"
+#include "decompress/Solvers/CellState.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/ForEachCellOnLine.h"
+#include "decompress/Solvers/IConstraintStore.h"
+#include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/LtpTable.h"
+#include "decompress/Solvers/PropagationEngine.h"
+
+using namespace crsce; // NOLINT
+using decompress::solvers::CellState;
+using decompress::solvers::ConstraintStore;
+
+static constexpr std::uint16_t kS = 127;
+static constexpr std::uint32_t kCells = static_cast<std::uint32_t>(kS) * kS;
+static constexpr std::uint32_t kLines = ConstraintStore::kTotalLines;
+
+/**
+ * @name sink
+ * @brief Accumulator that keeps the optimizer from discarding benchmark results.
+ */
+static volatile std::uint64_t sink = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @name forEachLineOfCell
+ * @brief Invoke fn(flatIndex) for the six lines through cell (r, c).
+ */
+template <typename Fn>
+static void forEachLineOfCell(const std::uint16_t r, const std::uint16_t c, Fn &&fn) {
+    fn(static_cast<std::uint32_t>(r));
+    fn(static_cast<std::uint32_t>(kS) + c);
+    fn((2U * kS) + static_cast<std::uint32_t>(c - r + (kS - 1)));
+    fn((2U * kS) + ConstraintStore::kNumDiags + static_cast<std::uint32_t>(r + c));
+    const auto &mem = decompress::solvers::ltpMembership(r, c);
+    for (std::uint8_t j = 0; j < mem.count; ++j) {
+        fn(static_cast<std::uint32_t>(mem.flat[j])); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+}
+
+/**
+ * @name LegacyStore
+ * @brief The former ConstraintStore state and its assign/unassign/getCellState.
+ */
+class LegacyStore {
+public:
+    /**
+     * @name LegacyStore
+     * @brief Start from the line statistics of a freshly built store.
+     */
+    explicit LegacyStore(const ConstraintStore &fresh)
+        : cells_(kCells, CellState::Unassigned), rowBits_(kS, std::array<std::uint64_t, 2>{}), stats_(kLines) {
+        for (std::uint32_t i = 0; i < kLines; ++i) {
+            stats_[i] = fresh.getStatDirect(i);
+        }
+    }
+
+    /**
+     * @name assign
+     * @brief Former ConstraintStore::assign.
+     */
+    [[gnu::noinline]] void assign(const std::uint16_t r, const std::uint16_t c, const std::uint8_t v) {
+        cells_[(static_cast<std::size_t>(r) * kS) + c] = (v != 0) ? CellState::One : CellState::Zero;
+        if (v != 0) {
+            rowBits_[r][c / 64] |= (std::uint64_t{1} << (63 - (c % 64))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        assigned_[r][c / 64] |= (std::uint64_t{1} << (c % 64)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        forEachLineOfCell(r, c, [&](const std::uint32_t i) { stats_[i].unknown--; });
+        if (v != 0) {
+            forEachLineOfCell(r, c, [&](const std::uint32_t i) { stats_[i].assigned++; });
+        }
+    }
+
+    /**
+     * @name unassign
+     * @brief Former ConstraintStore::unassign.
+     */
+    [[gnu::noinline]] void unassign(const std::uint16_t r, const std::uint16_t c) {
+        const auto wasOne = (cells_[(static_cast<std::size_t>(r) * kS) + c] == CellState::One);
+        cells_[(static_cast<std::size_t>(r) * kS) + c] = CellState::Unassigned;
+        if (wasOne) {
+            rowBits_[r][c / 64] &= ~(std::uint64_t{1} << (63 - (c % 64))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        assigned_[r][c / 64] &= ~(std::uint64_t{1} << (c % 64)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        forEachLineOfCell(r, c, [&](const std::uint32_t i) { stats_[i].unknown++; });
+        if (wasOne) {
+            forEachLineOfCell(r, c, [&](const std::uint32_t i) { stats_[i].assigned--; });
+        }
+    }
+
+    /**
+     * @name getCellState
+     * @brief Former ConstraintStore::getCellState (one byte read).
+     */
+    [[nodiscard, gnu::noinline]] CellState getCellState(const std::uint16_t r, const std::uint16_t c) const {
+        return cells_[(static_cast<std::size_t>(r) * kS) + c];
+    }
+
+    /**
+     * @name getLinesForCell
+     * @brief Former ConstraintStore::getLinesForCell (LineIDs, as the engine consumed them).
+     */
+    [[nodiscard, gnu::noinline]] decompress::solvers::IConstraintStore::CellLines
+    getLinesForCell(const std::uint16_t r, const std::uint16_t c) const {
+        decompress::solvers::IConstraintStore::CellLines out;
+        forEachLineOfCell(r, c, [&](const std::uint32_t i) {
+            out.lines[out.count++] = ConstraintStore::flatIndexToLineID(i); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        });
+        return out;
+    }
+
+    /**
+     * @name getResidual
+     * @brief Former ConstraintStore::getResidual.
+     */
+    [[nodiscard, gnu::noinline]] std::int32_t getResidual(const decompress::solvers::LineID line) const {
+        const auto &st = stats_[ConstraintStore::lineIndex(line)];
+        return static_cast<std::int32_t>(st.target) - static_cast<std::int32_t>(st.assigned);
+    }
+
+    /**
+     * @name getUnknownCount
+     * @brief Former ConstraintStore::getUnknownCount.
+     */
+    [[nodiscard, gnu::noinline]] std::uint16_t getUnknownCount(const decompress::solvers::LineID line) const {
+        return stats_[ConstraintStore::lineIndex(line)].unknown;
+    }
+
+    /**
+     * @name Snapshot
+     * @brief Former ConstraintStore::Snapshot: a copy of every mutable member.
+     */
+    struct Snapshot {
+        std::vector<CellState> cells;
+        std::vector<std::array<std::uint64_t, 2>> rowBits;
+        std::array<std::array<std::uint64_t, 2>, kS> assigned;
+        std::vector<ConstraintStore::LineStat> stats;
+    };
+
+    /**
+     * @name takeSnapshot
+     * @brief Former ConstraintStore::takeSnapshot.
+     */
+    [[nodiscard, gnu::noinline]] Snapshot takeSnapshot() const {
+        return {.cells = cells_, .rowBits = rowBits_, .assigned = assigned_, .stats = stats_};
+    }
+
+    /**
+     * @name restoreSnapshot
+     * @brief Former ConstraintStore::restoreSnapshot.
+     */
+    [[gnu::noinline]] void restoreSnapshot(const Snapshot &snap) {
+        cells_ = snap.cells;
+        rowBits_ = snap.rowBits;
+        assigned_ = snap.assigned;
+        stats_ = snap.stats;
+    }
+
+private:
+    std::vector<CellState> cells_;
+    std::vector<std::array<std::uint64_t, 2>> rowBits_;
+    std::array<std::array<std::uint64_t, 2>, kS> assigned_{};
+    std::vector<ConstraintStore::LineStat> stats_;
+};
+
+/**
+ * @name LegacyEngine
+ * @brief Former PropagationEngine::propagate forcing loop over LegacyStore.
+ */
+class LegacyEngine {
+public:
+    /**
+     * @name LegacyEngine
+     * @brief Bind to a store (must outlive the engine).
+     */
+    explicit LegacyEngine(LegacyStore &store) : store_(store), queued_(kLines, 0) {}
+
+    /**
+     * @name propagate
+     * @brief Force lines from queue to quiescence; forced() lists the cells forced.
+     * @return False on a contradiction.
+     */
+    bool propagate(const std::vector<decompress::solvers::LineID> &queue) {
+        forced_.clear();
+        work_.assign(queue.begin(), queue.end());
+        for (const auto &line : work_) {
+            queued_[ConstraintStore::lineIndex(line)] = 1;
+        }
+        for (std::size_t front = 0; front < work_.size(); ++front) {
+            const auto line = work_[front];
+            queued_[ConstraintStore::lineIndex(line)] = 0;
+            const auto rho = store_.getResidual(line);
+            const auto u = store_.getUnknownCount(line);
+            if (rho < 0 || std::cmp_greater(rho, u)) {
+                return false;
+            }
+            if (u == 0 || (rho != 0 && std::cmp_not_equal(rho, u))) {
+                continue;
+            }
+            const auto value = static_cast<std::uint8_t>(rho == 0 ? 0 : 1);
+            decompress::solvers::forEachCellOnLine(line, kS, [&](const std::uint16_t r, const std::uint16_t c) {
+                if (store_.getCellState(r, c) != CellState::Unassigned) {
+                    return;
+                }
+                store_.assign(r, c, value);
+                forced_.push_back({.r = r, .c = c, .value = value, .antecedentLine = ConstraintStore::lineIndex(line)});
+                const auto affected = store_.getLinesForCell(r, c);
+                for (std::uint8_t i = 0; i < affected.count; ++i) {
+                    const auto &aff = affected.lines[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    if (queued_[ConstraintStore::lineIndex(aff)] == 0) {
+                        queued_[ConstraintStore::lineIndex(aff)] = 1;
+                        work_.push_back(aff);
+                    }
+                }
+            });
+        }
+        return true;
+    }
+
+    /**
+     * @name forced
+     * @brief Cells forced by the last propagate(), in order.
+     */
+    [[nodiscard]] const std::vector<decompress::solvers::Assignment> &forced() const {
+        return forced_;
+    }
+
+private:
+    LegacyStore &store_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+    std::vector<std::uint8_t> queued_;
+    std::vector<decompress::solvers::LineID> work_;
+    std::vector<decompress::solvers::Assignment> forced_;
+};
+
+/**
+ * @name lineSums
+ * @brief Every line's sum for csm, by flat index.
+ */
+static std::vector<std::uint16_t> lineSums(const common::Csm &csm) {
+    std::vector<std::uint16_t> sums(kLines, 0);
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            if (csm.get(r, c) != 0) {
+                forEachLineOfCell(r, c, [&](const std::uint32_t i) { ++sums[i]; });
+            }
+        }
+    }
+    return sums;
+}
+
+/**
+ * @name makeStore
+ * @brief A fresh ConstraintStore with csm's line sums as targets.
+ */
+static ConstraintStore makeStore(const std::vector<std::uint16_t> &sums) {
+    const auto slice = [&](const std::uint32_t base, const std::uint32_t n) {
+        return std::vector<std::uint16_t>(sums.begin() + base, sums.begin() + base + n);
+    };
+    const std::vector<std::uint16_t> none;
+    return {slice(0, kS), slice(kS, kS), slice(2U * kS, ConstraintStore::kNumDiags),
+            slice((2U * kS) + ConstraintStore::kNumDiags, ConstraintStore::kNumAntiDiags),
+            slice(ConstraintStore::kLTP1Base, kS), slice(ConstraintStore::kLTP2Base, kS), none, none, none, none};
+}
+
+/**
+ * @name timeNs
+ * @brief Run fn() iters times and return mean nanoseconds per call.
+ */
+template <typename Fn>
+static double timeNs(const int iters, Fn &&fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; ++i) {
+        fn();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) / iters;
+}
+
+/**
+ * @name report
+ * @brief Print one legacy-vs-current comparison line (times per operation).
+ */
+static void report(const char *name, const double legacy, const double current) {
+    std::printf("%-28s legacy %10.2f ns   current %10.2f ns   speedup %6.2fx\n", name, legacy, current,
+                legacy / current);
+}
+
+int main(const int argc, const char *const argv[]) { // NOLINT
+    int iters = 200;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i]; // NOLINT
+        if (arg == "-iters" && i + 1 < argc) { iters = std::atoi(argv[++i]); } // NOLINT
+    }
+    if (iters <= 0) {
+        std::fprintf(stderr, "usage: constraintStoreBench [-iters <n>]\n");
+        return 1;
+    }
+
+    // A sparse pseudo-random block (about 1 bit in 16) and a pseudo-random cell order.
+    common::Csm csm;
+    std::vector<std::pair<std::uint16_t, std::uint16_t>> order;
+    order.reserve(kCells);
+    std::uint32_t x = 0x9E3779B9U;
+    const auto next = [&] {
+        x ^= x << 13U;
+        x ^= x >> 17U;
+        x ^= x << 5U;
+        return x;
+    };
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            csm.set(r, c, static_cast<std::uint8_t>((next() & 15U) == 0U ? 1U : 0U));
+            order.emplace_back(r, c);
+        }
+    }
+    for (std::size_t i = order.size() - 1; i > 0; --i) {
+        std::swap(order[i], order[next() % (i + 1)]);
+    }
+    const auto sums = lineSums(csm);
+
+    // assign/unassign: every cell in random order, then back out in reverse.
+    {
+        auto planes = makeStore(sums);
+        LegacyStore legacy(planes);
+        const auto cycle = [&](auto &store) {
+            for (const auto &[r, c] : order) {
+                store.assign(r, c, csm.get(r, c));
+            }
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                store.unassign(it->first, it->second);
+            }
+        };
+        report("assign+unassign (per op)", timeNs(iters, [&] { cycle(legacy); }) / (2.0 * kCells),
+               timeNs(iters, [&] { cycle(planes); }) / (2.0 * kCells));
+    }
+
+    // getCellState: probe every cell with half the matrix assigned.
+    {
+        auto planes = makeStore(sums);
+        LegacyStore legacy(planes);
+        for (std::size_t i = 0; i < order.size() / 2; ++i) {
+            planes.assign(order[i].first, order[i].second, csm.get(order[i].first, order[i].second));
+            legacy.assign(order[i].first, order[i].second, csm.get(order[i].first, order[i].second));
+        }
+        const auto scan = [](const auto &store) {
+            std::uint64_t open = 0;
+            for (std::uint16_t r = 0; r < kS; ++r) {
+                for (std::uint16_t c = 0; c < kS; ++c) {
+                    open += store.getCellState(r, c) == CellState::Unassigned ? 1U : 0U;
+                }
+            }
+            sink = sink + open;
+        };
+        report("getCellState (per probe)", timeNs(iters * 10, [&] { scan(legacy); }) / kCells,
+               timeNs(iters * 10, [&] { scan(planes); }) / kCells);
+    }
+
+    // propagate: the top half of the rows decided (as branching would), every line queued,
+    // forcing to quiescence, then the forced cells undone.
+    {
+        auto planes = makeStore(sums);
+        LegacyStore legacy(planes);
+        for (std::uint16_t r = 0; r < kS / 2; ++r) {
+            for (std::uint16_t c = 0; c < kS; ++c) {
+                planes.assign(r, c, csm.get(r, c));
+                legacy.assign(r, c, csm.get(r, c));
+            }
+        }
+        std::vector<decompress::solvers::LineID> all;
+        for (std::uint32_t i = 0; i < kLines; ++i) {
+            all.push_back(ConstraintStore::flatIndexToLineID(i));
+        }
+        decompress::solvers::PropagationEngine engine(planes);
+        LegacyEngine legacyEngine(legacy);
+        std::size_t legacyForced = 0;
+        std::size_t planesForced = 0;
+        const auto legacyRun = [&] {
+            sink = sink + static_cast<std::uint64_t>(legacyEngine.propagate(all));
+            const auto &got = legacyEngine.forced();
+            legacyForced = got.size();
+            for (auto it = got.rbegin(); it != got.rend(); ++it) {
+                legacy.unassign(it->r, it->c);
+            }
+        };
+        const auto planesRun = [&] {
+            engine.reset();
+            sink = sink + static_cast<std::uint64_t>(engine.propagate(all));
+            const auto &got = engine.getForcedAssignments();
+            planesForced = got.size();
+            for (auto it = got.rbegin(); it != got.rend(); ++it) {
+                planes.unassign(it->r, it->c);
+            }
+        };
+        const auto legacyNs = timeNs(iters, legacyRun);
+        const auto planesNs = timeNs(iters, planesRun);
+        if (legacyForced != planesForced) {
+            std::fprintf(stderr, "constraintStoreBench: forced %zu cells, legacy forced %zu\n", planesForced,
+                         legacyForced);
+            return 2;
+        }
+        std::printf("propagate: %zu cells forced per run\n", planesForced);
+        report("propagate+undo (per run)", legacyNs, planesNs);
+    }
+
+    // Row-candidate undo (RowSerialSolver): the solver only branches on rows with at most
+    // kMaxFreeBits (22) unknowns, i.e. late in the search. Here the top half is decided and every
+    // lower row keeps 22 unknown cells; a candidate assigns one such row's unknowns and propagates
+    // its lines. The former store copied all of its state out before each candidate and back
+    // after it; the current one trails the candidate's assigns and rolls back only those. Only
+    // the undo is timed on either side.
+    {
+        constexpr std::uint16_t kRow = kS / 2;
+        constexpr std::uint16_t kOpen = 22;
+        auto store = makeStore(sums);
+        LegacyStore legacy(store);
+        std::vector<std::uint16_t> rowFree;
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            const auto open = static_cast<std::uint16_t>(next() % (kS - kOpen));
+            for (std::uint16_t c = 0; c < kS; ++c) {
+                if (r >= kRow && c >= open && c < open + kOpen) {
+                    if (r == kRow) {
+                        rowFree.push_back(c);
+                    }
+                    continue;
+                }
+                store.assign(r, c, csm.get(r, c));
+                legacy.assign(r, c, csm.get(r, c));
+            }
+        }
+        std::vector<decompress::solvers::LineID> rowLines;
+        std::vector<bool> queued(kLines, false);
+        for (const auto c : rowFree) {
+            const auto &lines = store.cellLines(kRow, c);
+            for (std::uint8_t j = 0; j < lines.count; ++j) {
+                const auto idx = lines.flat[j]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                if (!queued[idx]) {
+                    queued[idx] = true;
+                    rowLines.push_back(ConstraintStore::flatIndexToLineID(idx));
+                }
+            }
+        }
+        const auto snapshotNs = timeNs(iters * 10, [&] {
+            const auto snap = legacy.takeSnapshot();
+            legacy.restoreSnapshot(snap);
+        });
+
+        decompress::solvers::PropagationEngine engine(store);
+        const auto trailRun = [&](const bool cascade, const char *name) {
+            std::size_t changed = 0;
+            double total = 0;
+            const auto runs = iters * 10;
+            for (int i = 0; i < runs; ++i) {
+                const auto t0 = std::chrono::steady_clock::now();
+                const auto undo = store.mark();
+                const auto t1 = std::chrono::steady_clock::now();
+                for (const auto c : rowFree) {
+                    store.assign(kRow, c, csm.get(kRow, c));
+                }
+                changed = rowFree.size();
+                if (cascade) {
+                    engine.reset();
+                    sink = sink + static_cast<std::uint64_t>(engine.propagate(rowLines));
+                    changed += engine.getForcedAssignments().size();
+                }
+                const auto t2 = std::chrono::steady_clock::now();
+                store.rollback(undo);
+                const auto t3 = std::chrono::steady_clock::now();
+                total += std::chrono::duration<double, std::nano>((t1 - t0) + (t3 - t2)).count();
+            }
+            std::printf("%s: %zu cells changed per candidate\n", name, changed);
+            report(name, snapshotNs, total / runs);
+        };
+        trailRun(false, "candidate undo, row only");
+        trailRun(true, "candidate undo, cascade");
+    }
+    return 0;
+}
@@ -10,6 +10,7 @@
 #include "common/exceptions/CliOutputExists.h"
 #include "decompress/Cli/run.h"
 #include "common/ArgParser/ArgParser.h"
+#include "common/Util/is_stdio_path.h"
 #include "common/exceptions/CliHelpRequested.h"
 #include "common/exceptions/CliNoArgs.h"
 #include "common/exceptions/CliParseError.h"
@@ -32,13 +33,22 @@ auto main(const int argc, char *argv[]) -> int {
 
         const std::span<char *> args{argv, static_cast<std::size_t>(argc)};
         const crsce::common::ArgParser parser("decompress", args);
-        const auto &[input, output, help] = parser.options();
+        const auto &[input, output, help, threads, range, resume] = parser.options();
 
-        ::crsce::o11y::O11y::instance().event("decompress_begin", {{"in", input}, {"out", output}});
+        ::crsce::o11y::O11y::instance().event("decompress_begin", {{"in", input}, {"out", output},
+                                                                  {"threads", std::to_string(threads)},
+                                                                  {"range", range ? std::to_string(range->start) + ":" +
+                                                                                        std::to_string(range->length)
+                                                                                  : std::string("all")},
+                                                                  {"resume", resume ? "true" : "false"}});
 
         crsce::decompress::cli::Heartbeat heartbeat;
-        heartbeat.start();
-        const int rc = crsce::decompress::cli::run(input, output);
+        if (!crsce::common::util::is_stdio_path(output)) {
+            // The heartbeat prints to stdout, which carries the data stream with -out -.
+            heartbeat.start();
+        }
+        const int rc = range ? crsce::decompress::cli::run(input, output, threads, range->start, range->length, resume)
+                             : crsce::decompress::cli::run(input, output, threads, resume);
         ::crsce::o11y::O11y::instance().event("decompress_end",
                                               {{"status", (rc == 0 ? std::string("OK") : std::string("FAIL"))}});
         heartbeat.wait();
@@ -0,0 +1,189 @@
+/**
+ * @file cmd/forcedBlockBench/main.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt.
+ * @brief Microbenchmark: per-block decode cost of forced blocks, solver vs. solveForced.
+ *
+ * Builds the payloads of an all-zero, an all-one and a sparse block and times the DI=0 path that
+ * Decompressor::reconstructBlock used for them before the fast path (ConstraintStore,
+ * propagation, RowDecomposedController to the first solution) against solveForced.
+ *
+ * Usage:
+ *   forcedBlockBench [-iters <n>]
+ */
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/BlockHash/BlockHash.h"
+#include "common/Csm/Csm.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+#include "decompress/Solvers/BranchingController.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/ForcedBlock.h"
+#include "decompress/Solvers/LtpTable.h"
+#include "decompress/Solvers/PropagationEngine.h"
+#include "decompress/Solvers/RowDecomposedController.h"
+#include "decompress/Solvers/Sha1HashVerifier.h"
+
+using namespace crsce; // NOLINT
+
+static constexpr std::uint16_t kS = 127;
+
+/**
+ * @name sink
+ * @brief Accumulator that keeps the optimizer from discarding benchmark results.
+ */
+static volatile std::uint64_t sink = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @name payloadOf
+ * @brief Serialized payload of a block: all cross-sums, lateral hashes and block hash.
+ */
+static std::vector<std::uint8_t> payloadOf(const common::Csm &csm) {
+    using common::format::CompressedPayload;
+    CompressedPayload payload;
+    std::vector<std::uint16_t> col(kS, 0), ltp1(kS, 0), ltp2(kS, 0);
+    std::vector<std::uint16_t> diag(CompressedPayload::kDiagCount, 0), anti(CompressedPayload::kDiagCount, 0);
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            if (csm.get(r, c) == 0) {
+                continue;
+            }
+            ++col[c];
+            ++diag[c - r + kS - 1];
+            ++anti[r + c];
+            const auto &mem = decompress::solvers::ltpMembership(r, c);
+            for (std::uint8_t j = 0; j < mem.count; ++j) {
+                const auto f = mem.flat[j]; // NOLINT
+                if (f < decompress::solvers::kLtp2Base) {
+                    ++ltp1[f - decompress::solvers::kLtp1Base];
+                } else {
+                    ++ltp2[f - decompress::solvers::kLtp2Base];
+                }
+            }
+        }
+    }
+    const decompress::solvers::Sha1HashVerifier hasher(kS);
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        payload.setLSM(r, csm.popcount(r));
+        payload.setVSM(r, col[r]);
+        payload.setLTP1SM(r, ltp1[r]);
+        payload.setLTP2SM(r, ltp2[r]);
+        const auto digest = hasher.computeHash(csm.getRow(r));
+        std::array<std::uint8_t, CompressedPayload::kLHDigestBytes> lh{};
+        std::copy_n(digest.begin(), lh.size(), lh.begin());
+        payload.setLH(r, lh);
+    }
+    for (std::uint16_t d = 0; d < CompressedPayload::kDiagCount; ++d) {
+        payload.setDSM(d, diag[d]);
+        payload.setXSM(d, anti[d]);
+    }
+    payload.setBH(common::BlockHash::compute(csm));
+    return payload.serializeBlock();
+}
+
+/**
+ * @name solverDecode
+ * @brief The DI=0 solver path of Decompressor::reconstructBlock (CPU propagation).
+ */
+static common::Csm solverDecode(const common::format::CompressedPayloadView &view) {
+    std::vector<std::uint16_t> lsm, vsm, dsm, xsm, ltp1, ltp2;
+    view.unpackLSM(lsm);
+    view.unpackVSM(vsm);
+    view.unpackDSM(dsm);
+    view.unpackXSM(xsm);
+    view.unpackLTP1SM(ltp1);
+    view.unpackLTP2SM(ltp2);
+    const std::vector<std::uint16_t> none;
+    auto store = std::make_unique<decompress::solvers::ConstraintStore>(lsm, vsm, dsm, xsm, ltp1, ltp2,
+                                                                       none, none, none, none);
+    auto propagator = std::make_unique<decompress::solvers::PropagationEngine>(*store);
+    auto brancher = std::make_unique<decompress::solvers::BranchingController>(*store, *propagator);
+    auto hasher = std::make_unique<decompress::solvers::Sha1HashVerifier>(kS);
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        std::array<std::uint8_t, 32> lh32{};
+        std::copy_n(view.lh(r).begin(), common::format::CompressedPayload::kLHDigestBytes, lh32.begin());
+        hasher->setExpected(r, lh32);
+    }
+    decompress::solvers::RowDecomposedController solver(std::move(store), std::move(propagator),
+                                                        std::move(brancher), std::move(hasher));
+    for (const auto &csm : solver.enumerateSolutionsLex()) {
+        return csm;
+    }
+    return {};
+}
+
+/**
+ * @name timeNs
+ * @brief Run fn() iters times and return mean nanoseconds per call.
+ */
+template <typename Fn>
+static double timeNs(const int iters, Fn &&fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; ++i) {
+        fn();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) / iters;
+}
+
+/**
+ * @name report
+ * @brief Print one solver-vs-fast-path comparison line.
+ */
+static void report(const char *name, const double solver, const double fast) {
+    std::printf("%-16s solver %12.1f us   forced %8.2f us   speedup %8.1fx\n", name, solver / 1000.0,
+                fast / 1000.0, solver / fast);
+}
+
+int main(const int argc, const char *const argv[]) { // NOLINT
+    int iters = 20;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i]; // NOLINT
+        if (arg == "-iters" && i + 1 < argc) { iters = std::atoi(argv[++i]); } // NOLINT
+    }
+    if (iters <= 0) {
+        std::fprintf(stderr, "usage: forcedBlockBench [-iters <n>]\n");
+        return 1;
+    }
+
+    common::Csm allOne;
+    common::Csm sparse;
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            allOne.set(r, c, 1);
+        }
+    }
+    sparse.set(0, 0, 1);
+    sparse.set(6, 15, 1);
+    sparse.set(39, 47, 1);
+    sparse.set(97, 26, 1);
+
+    struct Case {
+        const char *name;
+        common::Csm csm;
+        int fastScale; // the family fast path is too short to time at the solver's count
+    };
+    for (const auto &[name, csm, fastScale] : {Case{"all-zero block", common::Csm{}, 1000},
+                                               Case{"all-one block", allOne, 1000},
+                                               Case{"sparse block", sparse, 1}}) {
+        const auto bytes = payloadOf(csm);
+        const common::format::CompressedPayloadView view(bytes.data(), bytes.size());
+        const auto fast = decompress::solvers::solveForced(view);
+        if (!fast || fast->vec() != solverDecode(view).vec()) {
+            std::fprintf(stderr, "forcedBlockBench: fast path differs from the solver\n");
+            return 2;
+        }
+        report(name, timeNs(iters, [&] { sink = sink + solverDecode(view).getRow(0)[0]; }),
+               timeNs(iters * fastScale, [&] { sink = sink + decompress::solvers::solveForced(view)->getRow(0)[0]; }));
+    }
+    return 0;
+}
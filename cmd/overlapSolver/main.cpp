@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "common/BitKernels/BitKernels.h"
 #include "common/Csm/Csm.h"
 #include "decompress/Solvers/CombinatorSolver.h"
 
@@ -41,14 +42,8 @@ static common::Csm loadOverlappingBlock(const std::vector<std::uint8_t> &data,
     const auto stride = static_cast<std::size_t>(kS - overlap) * kS;
     const auto startBit = static_cast<std::size_t>(blockIdx) * stride;
 
-    for (std::size_t i = 0; i < kBlockBits; ++i) {
-        const auto srcBit = startBit + i;
-        const auto srcByte = srcBit / 8;
-        if (srcByte >= data.size()) { break; }
-        const auto bitInByte = static_cast<std::uint8_t>(7 - (srcBit % 8));
-        const auto v = static_cast<std::uint8_t>((data[srcByte] >> bitInByte) & 1);
-        csm.set(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS), v);
-    }
+    // Bits past the end of the input read as zero.
+    common::bitkernels::unpackRows(data.data(), data.size(), startBit, kBlockBits, csm);
     return csm;
 }
 
@@ -5,12 +5,14 @@
  * @brief Simple command-line argument parser shared by project binaries.
  * @note Located under include/common/ArgParser.
  *
- * Supports flags: -h/--help, -in <path>, -out <path> and exposes parsed
+ * Supports flags: -h/--help, -in <path>, -out <path>, -threads <n>, -range <start:len>, -resume and exposes parsed
  * values via a small Options POD. Intended for use by cmd/compress and
  * cmd/decompress to validate required I/O arguments.
  */
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <span>
 #include <string>
 
@@ -25,9 +27,27 @@ namespace crsce::common {
      */
     class ArgParser {
     public:
+        /**
+         * @struct ByteRange
+         * @brief Byte range parsed from -range <start:len> (offsets into the original file).
+         */
+        struct ByteRange {
+            /**
+             * @name start
+             * @brief Offset of the first byte.
+             */
+            std::uint64_t start{0};
+
+            /**
+             * @name length
+             * @brief Number of bytes.
+             */
+            std::uint64_t length{0};
+        };
+
         /**
          * @struct Options
-         * @brief Parsed arguments for input, output, and help.
+         * @brief Parsed arguments for input, output, help, worker threads, byte range, and resume.
          */
         struct Options {
             /**
@@ -47,6 +67,24 @@ namespace crsce::common {
              * @brief True if -h/--help was provided by the user.
              */
             bool help{false};
+
+            /**
+             * @name threads
+             * @brief Worker thread count parsed from -threads <n> (default 1 = serial).
+             */
+            std::uint32_t threads{1};
+
+            /**
+             * @name range
+             * @brief Byte range parsed from -range <start:len>; empty when not given.
+             */
+            std::optional<ByteRange> range;
+
+            /**
+             * @name resume
+             * @brief True if -resume was provided (an existing output is then permitted).
+             */
+            bool resume{false};
         };
 
         /**
@@ -72,7 +110,7 @@ namespace crsce::common {
 
         /**
          * @name parse
-         * @brief Parse argv for -h/--help, -in <path>, -out <path>.
+         * @brief Parse argv for -h/--help, -in <path>, -out <path>, -threads <n>, -range <start:len>, -resume.
          * @usage if (!parser.parse({argv, argv+argc})) { show_usage(); }
          * @throws None
          * @param args Span of C-strings (argv slice) to parse.
@@ -91,7 +129,8 @@ namespace crsce::common {
 
         /**
          * @name usage
-         * @brief Create a usage string: "<program> -in <file> -out <file>".
+         * @brief Create a usage string: "<program> -in <file|-> -out <file|-> [-threads <n>]", plus
+         *        "[-range <start:len>] [-resume]" for programs other than compress.
          * @usage std::string u = parser.usage();
          * @throws None
          * @return Human-readable usage string.
@@ -0,0 +1,162 @@
+/**
+ * @file BitKernels.h
+ * @author Sam Caldwell
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Word-level kernels moving MSB-first bitstreams into and out of CSM rows.
+ *
+ * A CSM block is a row-major bitstream with a 127-bit row stride, and blocks
+ * after the first start mid-byte (16,129 mod 8 = 1). These kernels replace
+ * the per-bit loops on the I/O paths with 64-bit big-endian loads, funnel
+ * shifts, and byte swaps: each row costs two unaligned 64-bit loads (or
+ * stores) instead of 127 single-bit operations.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::bitkernels {
+    /**
+     * @name kRowBits
+     * @brief Number of significant bits per CSM row (kS).
+     */
+    inline constexpr std::uint16_t kRowBits = Csm::kS;
+
+    /**
+     * @name kRowBytes
+     * @brief Bytes in the big-endian serialization of a row's two words.
+     */
+    inline constexpr std::size_t kRowBytes = Csm::kWordsPerRow * sizeof(std::uint64_t);
+
+    /**
+     * @name loadBE64
+     * @brief Load 8 bytes as a big-endian uint64, zero-filling bytes at or beyond len.
+     * @param data Source buffer.
+     * @param len Length of the source buffer in bytes.
+     * @param byte Byte offset of the first byte to load.
+     * @return The big-endian value.
+     * @throws None
+     */
+    inline std::uint64_t loadBE64(const std::uint8_t *data, const std::size_t len, const std::size_t byte) noexcept {
+        std::uint64_t v = 0;
+        if (byte + sizeof(v) <= len) {
+            std::memcpy(&v, data + byte, sizeof(v)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        } else if (byte < len) {
+            std::memcpy(&v, data + byte, len - byte); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        if constexpr (std::endian::native == std::endian::little) {
+            v = std::byteswap(v);
+        }
+        return v;
+    }
+
+    /**
+     * @name loadBits64
+     * @brief Read 64 bits starting at an arbitrary bit position (MSB-first); bits past len read as zero.
+     * @details Funnel shift of the 8-byte word at bitPos / 8 with the following byte.
+     * @param data Source buffer.
+     * @param len Length of the source buffer in bytes.
+     * @param bitPos Absolute bit offset of the first bit.
+     * @return The 64 bits, first bit in the MSB.
+     * @throws None
+     */
+    inline std::uint64_t loadBits64(const std::uint8_t *data, const std::size_t len, const std::uint64_t bitPos) noexcept {
+        const auto byte = static_cast<std::size_t>(bitPos / 8);
+        const auto shift = static_cast<unsigned>(bitPos % 8);
+        const std::uint64_t hi = loadBE64(data, len, byte);
+        if (shift == 0) {
+            return hi;
+        }
+        const std::uint64_t next = (byte + 8 < len) ? data[byte + 8] : 0U; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return (hi << shift) | (next >> (8U - shift));
+    }
+
+    /**
+     * @name orBits64
+     * @brief OR the top `count` bits of value into dst at an arbitrary bit position (MSB-first).
+     * @details Inverse funnel shift: one 8-byte big-endian read-modify-write plus one spill byte.
+     *          Bytes at or beyond len are never touched.
+     * @param dst Destination buffer.
+     * @param len Length of the destination buffer in bytes.
+     * @param bitPos Absolute bit offset at which the first bit is written.
+     * @param value Bits to write, first bit in the MSB.
+     * @param count Number of significant leading bits in value (1..64).
+     * @return void
+     * @throws None
+     */
+    inline void orBits64(std::uint8_t *dst, const std::size_t len, const std::uint64_t bitPos,
+                         std::uint64_t value, const unsigned count) noexcept {
+        if (count < 64) {
+            value &= ~(~std::uint64_t{0} >> count);
+        }
+        const auto byte = static_cast<std::size_t>(bitPos / 8);
+        const auto shift = static_cast<unsigned>(bitPos % 8);
+        std::uint64_t hi = value >> shift;
+        if constexpr (std::endian::native == std::endian::little) {
+            hi = std::byteswap(hi);
+        }
+        std::array<std::uint8_t, 8> bytes{};
+        std::memcpy(bytes.data(), &hi, sizeof(hi));
+        const auto n = (byte < len) ? std::min<std::size_t>(8, len - byte) : 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            dst[byte + i] |= bytes[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        if (shift != 0 && byte + 8 < len) {
+            dst[byte + 8] |= static_cast<std::uint8_t>(value << (8U - shift)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+    /**
+     * @name rowToBytes
+     * @brief Serialize a CSM row's two words to 16 big-endian bytes (the LH / BH message layout).
+     * @param row The row words, MSB-first bit ordering.
+     * @return 16 bytes: word 0 big-endian followed by word 1 big-endian.
+     * @throws None
+     */
+    inline std::array<std::uint8_t, kRowBytes>
+    rowToBytes(const std::array<std::uint64_t, Csm::kWordsPerRow> &row) noexcept {
+        std::array<std::uint8_t, kRowBytes> out{};
+        for (std::size_t w = 0; w < Csm::kWordsPerRow; ++w) {
+            std::uint64_t v = row[w]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            if constexpr (std::endian::native == std::endian::little) {
+                v = std::byteswap(v);
+            }
+            std::memcpy(out.data() + (w * sizeof(v)), &v, sizeof(v)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        return out;
+    }
+
+    /**
+     * @name unpackRows
+     * @brief Load a 127-bit-stride MSB-first bitstream into the rows of a CSM.
+     * @param data Source buffer.
+     * @param len Length of the source buffer in bytes.
+     * @param startBit Absolute bit offset of cell (0, 0) in the source.
+     * @param bitCount Number of valid bits to load; cells at or beyond it are zero.
+     * @param csm Destination matrix; every row is overwritten.
+     * @return void
+     * @throws None
+     */
+    void unpackRows(const std::uint8_t *data, std::size_t len, std::uint64_t startBit,
+                    std::size_t bitCount, Csm &csm) noexcept;
+
+    /**
+     * @name packRows
+     * @brief OR the rows of a CSM into a 127-bit-stride MSB-first bitstream.
+     * @details The destination must be zeroed over the written range by the caller; bits
+     *          are OR-ed so a block can be spliced after a partially filled byte.
+     * @param csm Source matrix.
+     * @param dst Destination buffer.
+     * @param len Length of the destination buffer in bytes; bits beyond it are dropped.
+     * @param startBit Absolute bit offset at which cell (0, 0) is written.
+     * @return void
+     * @throws None
+     */
+    void packRows(const Csm &csm, std::uint8_t *dst, std::size_t len, std::uint64_t startBit) noexcept;
+} // namespace crsce::common::bitkernels
@@ -0,0 +1,99 @@
+/**
+ * @file CsmLayout.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Per-block layout transforms: alternative ways to lay a block's bits onto the CSM.
+ *
+ * loadCsm lays the 16,129 bits of a block onto the matrix row-major. How the bits land
+ * decides how many cross-sum lines are saturated (all zeros or all ones) and therefore how
+ * much of the block propagation fixes before any search. Byte-oriented data keeps its
+ * structure at byte positions -- ASCII text has a zero in bit 7 of every byte -- and
+ * row-major scatters that structure across every line. Each layout is a permutation from
+ * stream bit i to matrix cell p = r * kS + c:
+ *
+ *   RowMajor    p = i (loadCsm's layout)
+ *   Transpose   column-major: p = (i mod kS) * kS + i / kS
+ *   BitPlane    bit j of byte k goes to p = j * kBytes + k: each bit plane is contiguous
+ *   ByteColumn  bytes as kBytes / 16 records of 16: byte k of every record is contiguous
+ *
+ * The last bit of the block (16,129 = 8 * 2,016 + 1) is not part of a byte and stays at
+ * the last cell under BitPlane and ByteColumn. The compressor records the layout in the
+ * block frame (BlockFrame::layout()); the decoder solves for the laid-out matrix and
+ * applies invert() before writing it out.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::csmlayout {
+
+    /**
+     * @name Layout
+     * @brief Layout transform identifiers as stored in BlockFrame::layout().
+     */
+    enum class Layout : std::uint8_t {
+        RowMajor = 0,
+        Transpose = 1,
+        BitPlane = 2,
+        ByteColumn = 3,
+    };
+
+    /**
+     * @name kLayoutCount
+     * @brief Number of layouts; valid identifiers are 0..kLayoutCount-1.
+     */
+    inline constexpr std::uint8_t kLayoutCount = 4;
+
+    /**
+     * @name kBytes
+     * @brief Whole bytes in a block (the 16,129th bit stands alone).
+     */
+    inline constexpr std::uint16_t kBytes = (Csm::kS * Csm::kS) / 8;
+
+    /**
+     * @name kRecordBytes
+     * @brief Record width of the ByteColumn layout (kBytes is a multiple of it).
+     */
+    inline constexpr std::uint16_t kRecordBytes = 16;
+
+    /**
+     * @name cellOf
+     * @brief Matrix cell (r * kS + c) that holds stream bit i under a layout.
+     * @param layout Layout transform.
+     * @param i Stream bit index in [0, kS * kS).
+     * @return Cell index in [0, kS * kS).
+     * @throws None
+     */
+    [[nodiscard]] std::uint16_t cellOf(Layout layout, std::uint16_t i) noexcept;
+
+    /**
+     * @name apply
+     * @brief Re-lay a row-major block (as loaded by loadCsm) under another layout.
+     * @param natural The block in RowMajor layout.
+     * @param layout Target layout.
+     * @return The block with stream bit i at cellOf(layout, i).
+     * @throws None
+     */
+    [[nodiscard]] Csm apply(const Csm &natural, Layout layout);
+
+    /**
+     * @name invert
+     * @brief Undo apply(): recover the row-major block from a laid-out one.
+     * @param laid The block in the given layout.
+     * @param layout Layout the block is in.
+     * @return The block in RowMajor layout.
+     * @throws None
+     */
+    [[nodiscard]] Csm invert(const Csm &laid, Layout layout);
+
+    /**
+     * @name name
+     * @brief Short lowercase name of a layout, for observability.
+     * @param layout Layout transform.
+     * @return "row_major", "transpose", "bit_plane" or "byte_column".
+     * @throws None
+     */
+    [[nodiscard]] const char *name(Layout layout) noexcept;
+
+} // namespace crsce::common::csmlayout
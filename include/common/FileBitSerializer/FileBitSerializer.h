@@ -7,7 +7,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <istream>
 #include <optional>
 #include <string>
 #include <vector>
@@ -19,7 +21,8 @@ namespace crsce::common {
      * @brief Provides a bit-by-bit interface over a file.
      *
      * Reads input in 1 KiB chunks and yields bits MSB-first from each byte. The
-     * consumer calls pop() until it returns std::nullopt indicating EOF.
+     * consumer calls pop() until it returns std::nullopt indicating EOF, or
+     * popBits() to pull a whole run of bits (e.g. one CSM block) at once.
      */
     class FileBitSerializer {
     public:
@@ -39,6 +42,23 @@ namespace crsce::common {
          */
         explicit FileBitSerializer(const std::string &path);
 
+        /**
+         * @name FileBitSerializer
+         * @brief Construct a bit serializer over an already-open stream (e.g. std::cin).
+         * @usage FileBitSerializer s(std::cin);
+         * @throws None (check good() to verify the stream is readable)
+         * @param in Stream to read; must outlive the serializer. Only sequential reads are used.
+         * @return N/A
+         */
+        explicit FileBitSerializer(std::istream &in);
+
+        // in_ may point at file_, so a copy or move would keep reading the source object's stream.
+        FileBitSerializer(const FileBitSerializer &) = delete;
+        FileBitSerializer &operator=(const FileBitSerializer &) = delete;
+        FileBitSerializer(FileBitSerializer &&) = delete;
+        FileBitSerializer &operator=(FileBitSerializer &&) = delete;
+        ~FileBitSerializer() = default;
+
         /**
          * @name has_next
          * @brief Check if at least one more bit can be produced.
@@ -57,6 +77,17 @@ namespace crsce::common {
          */
         std::optional<bool> pop();
 
+        /**
+         * @name popBits
+         * @brief Pop up to bitCount bits (MSB-first) into a zero-padded, byte-aligned buffer.
+         * @usage std::vector<std::uint8_t> block; const auto got = s.popBits(block, 16129);
+         * @throws None
+         * @param dst Destination; resized to ceil(bitCount / 8) bytes and zero-filled first.
+         * @param bitCount Number of bits requested.
+         * @return Number of bits actually produced (less than bitCount only at EOF).
+         */
+        std::size_t popBits(std::vector<std::uint8_t> &dst, std::size_t bitCount);
+
         /**
          * @name good
          * @brief True if the underlying file stream opened successfully.
@@ -64,7 +95,7 @@ namespace crsce::common {
          * @throws None
          * @return true if the stream is in a good state; false otherwise.
          */
-        [[nodiscard]] bool good() const { return in_.good(); }
+        [[nodiscard]] bool good() const { return in_->good(); }
 
     private:
         /**
@@ -76,11 +107,17 @@ namespace crsce::common {
          */
         bool fill();
 
+        /**
+         * @name file_
+         * @brief File stream opened in binary mode (unused when reading an external stream).
+         */
+        std::ifstream file_;
+
         /**
          * @name in_
-         * @brief File stream opened in binary mode.
+         * @brief Stream actually read: file_, or the stream passed to the constructor.
          */
-        std::ifstream in_;
+        std::istream *in_{&file_};
 
         /**
          * @name buf_
@@ -0,0 +1,233 @@
+/**
+ * @file BlockFrame.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CRSCE v2 per-block frame (16 bytes) preceding each block payload.
+ *
+ * The frame names the block it belongs to and carries a CRC-32 over the frame
+ * fields and the payload, so a decoder can reject a damaged block in O(1)
+ * (one CRC over 1,385 bytes) before spending any solver time on it. Frames are
+ * fixed-size, so block b still lives at a computable offset and independent
+ * decoders can pick blocks without scanning the file.
+ *
+ * The one exception is a stored block (kFlagStored): the compressor's fallback
+ * when DI discovery fails or runs out of time, carrying the block's raw bits
+ * (kStoredPayloadBytes) instead of a CompressedPayload. Each stored block adds
+ * kStoredPayloadBytes - kBlockPayloadBytes bytes to the file, so the file size
+ * tells a decoder whether any exist; only then must it walk frames to find block b.
+ *
+ * A hinted block (kFlagHint) appends a DecodeHint section (a length field and the
+ * search trail to the original block) to its CompressedPayload. Its size is known only
+ * once that length field has been read: payloadBytes(flags) covers the payload up to and
+ * including the field, and hintBytes() gives the rest.
+ *
+ * A compressed block may also name the layout transform its bits were laid onto the matrix
+ * with (kLayoutMask, see CsmLayout.h); the decoder undoes it after reconstruction. The
+ * last block of a file sets kFlagPadded when its DI was ranked with the zero padding
+ * past the end of the data already assigned, so the decoder must assign it the same way.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @struct BlockFrame
+     * @name BlockFrame
+     * @brief 16-byte v2 block frame: block id, flags, and CRC-32 over frame + payload.
+     * @details
+     * Layout (all multi-byte fields little-endian):
+     *   Offset  Size  Type      Field
+     *    0       8    uint64    block_id (0-based index of the block in the file)
+     *    8       2    uint16    flags (kFlagFinal, kFlagStored, kFlagHint, kLayoutMask, kFlagPadded; others 0)
+     *   10       2    uint16    final_bits (valid bits in a kFlagFinal block; otherwise 0)
+     *   12       4    uint32    block_crc32 (CRC-32 over bytes 0-11, then the payload)
+     */
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    struct BlockFrame {
+        /**
+         * @name kFrameBytes
+         * @brief Size of the frame in bytes.
+         */
+        static constexpr std::size_t kFrameBytes = 16;
+
+        /**
+         * @name kFlagFinal
+         * @brief Last block of a streamed container; finalBits holds its valid bit count.
+         */
+        static constexpr std::uint16_t kFlagFinal = 0x0001;
+
+        /**
+         * @name kFlagStored
+         * @brief Payload is the block's raw bits (kStoredPayloadBytes), copied through without solving.
+         */
+        static constexpr std::uint16_t kFlagStored = 0x0002;
+
+        /**
+         * @name kFlagHint
+         * @brief Payload is a CompressedPayload followed by a DecodeHint section (never with kFlagStored).
+         */
+        static constexpr std::uint16_t kFlagHint = 0x0004;
+
+        /**
+         * @name kLayoutMask
+         * @brief Two-bit csmlayout::Layout the block's bits were laid out with (0 = row-major;
+         *        never with kFlagStored, whose raw bits are always row-major).
+         */
+        static constexpr std::uint16_t kLayoutMask = 0x0018;
+
+        /**
+         * @name kLayoutShift
+         * @brief Position of the layout field within the flags.
+         */
+        static constexpr unsigned kLayoutShift = 3;
+
+        /**
+         * @name kFlagPadded
+         * @brief The block's padding cells (past the end of the file's data) were assigned 0
+         *        before its DI was ranked; the decoder must assign them too (never with kFlagStored).
+         */
+        static constexpr std::uint16_t kFlagPadded = 0x0020;
+
+        /**
+         * @name kKnownFlags
+         * @brief Mask of flag bits this decoder understands; any other bit rejects the block.
+         */
+        static constexpr std::uint16_t kKnownFlags = kFlagFinal | kFlagStored | kFlagHint | kLayoutMask | kFlagPadded;
+
+        /**
+         * @name kStoredPayloadBytes
+         * @brief Payload size of a stored block: one 127 x 127 block, row-major, MSB-first, zero-padded.
+         */
+        static constexpr std::size_t kStoredPayloadBytes = ((127U * 127U) + 7U) / 8U;
+
+        /**
+         * @name blockId
+         * @brief Index of the block within the file.
+         */
+        std::uint64_t blockId{0};
+
+        /**
+         * @name flags
+         * @brief Per-block flag bits.
+         */
+        std::uint16_t flags{0};
+
+        /**
+         * @name finalBits
+         * @brief Valid (non-padding) bits in this block when kFlagFinal is set; 0 otherwise.
+         */
+        std::uint16_t finalBits{0};
+
+        /**
+         * @name final
+         * @brief True if this frame closes a streamed container.
+         * @return true if kFlagFinal is set.
+         * @throws None
+         */
+        [[nodiscard]] bool final() const { return (flags & kFlagFinal) != 0; }
+
+        /**
+         * @name stored
+         * @brief True if the payload holds the block's raw bits rather than a CompressedPayload.
+         * @return true if kFlagStored is set.
+         * @throws None
+         */
+        [[nodiscard]] bool stored() const { return (flags & kFlagStored) != 0; }
+
+        /**
+         * @name hinted
+         * @brief True if the payload carries a DecodeHint section after the CompressedPayload.
+         * @return true if kFlagHint is set.
+         * @throws None
+         */
+        [[nodiscard]] bool hinted() const { return (flags & kFlagHint) != 0; }
+
+        /**
+         * @name padded
+         * @brief True if the decoder must pre-assign the block's padding cells to 0.
+         * @return true if kFlagPadded is set.
+         * @throws None
+         */
+        [[nodiscard]] bool padded() const { return (flags & kFlagPadded) != 0; }
+
+        /**
+         * @name layout
+         * @brief Layout transform of the block's bits (a csmlayout::Layout value).
+         * @return The kLayoutMask field, 0 for row-major.
+         * @throws None
+         */
+        [[nodiscard]] std::uint8_t layout() const {
+            return static_cast<std::uint8_t>((flags & kLayoutMask) >> kLayoutShift);
+        }
+
+        /**
+         * @name layoutFlags
+         * @brief Flag bits that record a layout transform.
+         * @param layout A csmlayout::Layout value (0..3).
+         * @return The value to OR into flags.
+         * @throws None
+         */
+        [[nodiscard]] static std::uint16_t layoutFlags(const std::uint8_t layout) {
+            return static_cast<std::uint16_t>((static_cast<unsigned>(layout) << kLayoutShift) & kLayoutMask);
+        }
+
+        /**
+         * @name payloadBytes
+         * @brief Payload bytes to read after a frame carrying the given flags, before hintBytes().
+         * @param flags Frame flag bits.
+         * @return kStoredPayloadBytes if kFlagStored is set, else CompressedPayload::kBlockPayloadBytes,
+         *         plus DecodeHint::kHeaderBytes if kFlagHint is set.
+         * @throws None
+         */
+        [[nodiscard]] static std::size_t payloadBytes(std::uint16_t flags);
+
+        /**
+         * @name hintBytes
+         * @brief Payload bytes that follow the first payloadBytes(flags) bytes.
+         * @param flags Frame flag bits.
+         * @param payload Pointer to at least payloadBytes(flags) payload bytes.
+         * @return The hint trail length if kFlagHint is set (read from the payload), else 0.
+         * @throws None
+         */
+        [[nodiscard]] static std::size_t hintBytes(std::uint16_t flags, const std::uint8_t *payload);
+
+        /**
+         * @name peekFlags
+         * @brief Read the flags field of a frame that has not been validated yet.
+         * @details Used only to learn how many payload bytes to read; deserialize() then checks
+         *          the flags, the length, and the CRC together.
+         * @param data Pointer to at least kFrameBytes bytes.
+         * @return The raw flags field.
+         * @throws None
+         */
+        [[nodiscard]] static std::uint16_t peekFlags(const std::uint8_t *data);
+
+        /**
+         * @name serialize
+         * @brief Build the framed block: 16-byte frame followed by the payload.
+         * @param payload Serialized block payload (payloadBytes(flags) + hintBytes() bytes).
+         * @return Vector of kFrameBytes + payload.size() bytes.
+         * @throws None
+         */
+        [[nodiscard]] std::vector<std::uint8_t> serialize(const std::vector<std::uint8_t> &payload) const;
+
+        /**
+         * @name deserialize
+         * @brief Validate a framed block and return its frame.
+         * @param data Pointer to the frame followed by the payload.
+         * @param len Length of frame + payload in bytes (must be > kFrameBytes).
+         * @param expectedBlockId Block index implied by the frame's position in the file.
+         * @return Deserialized BlockFrame; the payload starts at data + kFrameBytes.
+         * @throws DecompressBlockCorrupt on short buffer, CRC-32 mismatch, block id mismatch,
+         *         unknown or conflicting flags, a payload length other than payloadBytes(flags) +
+         *         hintBytes(), a hint trail longer than DecodeHint::kMaxTrailBits, or a
+         *         final_bits value inconsistent with the flags.
+         */
+        static BlockFrame deserialize(const std::uint8_t *data, std::size_t len, std::uint64_t expectedBlockId);
+    };
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+} // namespace crsce::common::format
@@ -463,15 +463,6 @@ namespace crsce::common::format {
         static void packBits(std::vector<std::uint8_t> &buf, std::size_t &bitOffset,
                              std::uint16_t value, std::uint8_t n);
 
-        /**
-         * @name unpackBits
-         * @brief Read n bits from data starting at the given bit offset (MSB-first).
-         * @param data Input byte buffer.
-         * @param bitOffset Current bit offset into data (updated on return).
-         * @param n Number of bits to read (1..16).
-         * @return The extracted value.
-         */
-        static std::uint16_t unpackBits(const std::uint8_t *data, std::size_t &bitOffset, std::uint8_t n);
     };
 
 } // namespace crsce::common::format
@@ -0,0 +1,256 @@
+/**
+ * @file CompressedPayloadView.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Read-only, zero-copy view over one serialized CRSCE block payload.
+ *
+ * CompressedPayload::deserializeBlock copies every field into owned vectors one
+ * bit at a time. The decompressor only needs each cross-sum vector once, in the
+ * std::vector<uint16_t> form the ConstraintStore constructor takes, so this view
+ * leaves the bytes where they are: digests are exposed as spans into the buffer
+ * and the bit-packed sum vectors are decoded directly into caller-owned vectors
+ * through a 64-bit window (one funnel-shift load per ~9 elements).
+ */
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @class CompressedPayloadView
+     * @name CompressedPayloadView
+     * @brief Non-owning accessor for a kBlockPayloadBytes buffer laid out as CompressedPayload serializes it.
+     * @details The viewed buffer must outlive the view. Field offsets are fixed by the format:
+     *          LH (kS x 4 bytes), BH (32 bytes), DI (1 byte), then the MSB-first bitstream
+     *          LSM, VSM (kS x 7 bits), DSM, XSM (kDiagCount x diagBits(k)), LTP1SM, LTP2SM.
+     */
+    class CompressedPayloadView {
+    public:
+        /**
+         * @name kS
+         * @brief Matrix dimension.
+         */
+        static constexpr std::uint16_t kS = CompressedPayload::kS;
+
+        /**
+         * @name kDiagCount
+         * @brief Number of diagonals (and anti-diagonals).
+         */
+        static constexpr std::uint16_t kDiagCount = CompressedPayload::kDiagCount;
+
+        /**
+         * @name CompressedPayloadView
+         * @brief Bind a view to a serialized block payload (no copy).
+         * @param data Pointer to at least kBlockPayloadBytes bytes.
+         * @param len Length of the buffer.
+         * @throws DecompressHeaderInvalid if len < kBlockPayloadBytes.
+         */
+        CompressedPayloadView(const std::uint8_t *data, std::size_t len);
+
+        /**
+         * @name lh
+         * @brief Lateral hash digest for row r, as a span into the viewed buffer.
+         * @param r Row index in [0, kS).
+         * @return kLHDigestBytes-byte span.
+         * @throws None
+         */
+        [[nodiscard]] std::span<const std::uint8_t, CompressedPayload::kLHDigestBytes> lh(std::uint16_t r) const {
+            return std::span<const std::uint8_t, CompressedPayload::kLHDigestBytes>(
+                data_ + (static_cast<std::size_t>(r) * CompressedPayload::kLHDigestBytes), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                CompressedPayload::kLHDigestBytes);
+        }
+
+        /**
+         * @name getBH
+         * @brief Block hash digest.
+         * @return Copy of the 32-byte digest (the form BlockHash::verify takes).
+         * @throws None
+         */
+        [[nodiscard]] std::array<std::uint8_t, CompressedPayload::kBHDigestBytes> getBH() const;
+
+        /**
+         * @name getDI
+         * @brief Disambiguation index.
+         * @return The DI byte.
+         * @throws None
+         */
+        [[nodiscard]] std::uint8_t getDI() const { return data_[kDIByte]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        /**
+         * @name unpackLSM
+         * @brief Decode the kS row sums into out (resized to kS).
+         * @param out Destination vector.
+         * @return void
+         * @throws None
+         */
+        void unpackLSM(std::vector<std::uint16_t> &out) const;
+
+        /**
+         * @name unpackVSM
+         * @brief Decode the kS column sums into out (resized to kS).
+         * @param out Destination vector.
+         * @return void
+         * @throws None
+         */
+        void unpackVSM(std::vector<std::uint16_t> &out) const;
+
+        /**
+         * @name unpackDSM
+         * @brief Decode the kDiagCount diagonal sums into out (resized to kDiagCount).
+         * @param out Destination vector.
+         * @return void
+         * @throws None
+         */
+        void unpackDSM(std::vector<std::uint16_t> &out) const;
+
+        /**
+         * @name unpackXSM
+         * @brief Decode the kDiagCount anti-diagonal sums into out (resized to kDiagCount).
+         * @param out Destination vector.
+         * @return void
+         * @throws None
+         */
+        void unpackXSM(std::vector<std::uint16_t> &out) const;
+
+        /**
+         * @name unpackLTP1SM
+         * @brief Decode the kS LTP1 partition sums into out (resized to kS).
+         * @param out Destination vector.
+         * @return void
+         * @throws None
+         */
+        void unpackLTP1SM(std::vector<std::uint16_t> &out) const;
+
+        /**
+         * @name unpackLTP2SM
+         * @brief Decode the kS LTP2 partition sums into out (resized to kS).
+         * @param out Destination vector.
+         * @return void
+         * @throws None
+         */
+        void unpackLTP2SM(std::vector<std::uint16_t> &out) const;
+
+    private:
+        /**
+         * @name kBHByte
+         * @brief Byte offset of the block hash.
+         */
+        static constexpr std::size_t kBHByte = static_cast<std::size_t>(kS) * CompressedPayload::kLHDigestBytes;
+
+        /**
+         * @name kDIByte
+         * @brief Byte offset of the DI byte.
+         */
+        static constexpr std::size_t kDIByte = kBHByte + CompressedPayload::kBHDigestBytes;
+
+        /**
+         * @name kUniformBits
+         * @brief Width of each LSM/VSM element: bit_width(kS).
+         */
+        static constexpr unsigned kUniformBits = std::bit_width(static_cast<unsigned>(kS));
+
+        /**
+         * @name diagBits
+         * @brief Width of DSM/XSM element k: bit_width(diagonal length).
+         * @param k Diagonal index in [0, kDiagCount).
+         * @return Number of bits.
+         */
+        static constexpr unsigned diagBits(const std::uint16_t k) {
+            const unsigned len = (k < kS) ? k + 1U : (2U * kS) - 1U - k;
+            return std::bit_width(len);
+        }
+
+        /**
+         * @name diagStreamBits
+         * @brief Total bits of one DSM or XSM vector.
+         * @return Sum of diagBits(k) over all diagonals.
+         */
+        static constexpr std::uint64_t diagStreamBits() {
+            std::uint64_t total = 0;
+            for (std::uint16_t k = 0; k < kDiagCount; ++k) {
+                total += diagBits(k);
+            }
+            return total;
+        }
+
+        /**
+         * @name kLSMBit
+         * @brief Bit offset of the LSM vector (first bit after DI).
+         */
+        static constexpr std::uint64_t kLSMBit = (kDIByte + 1) * 8;
+
+        /**
+         * @name kVSMBit
+         * @brief Bit offset of the VSM vector.
+         */
+        static constexpr std::uint64_t kVSMBit = kLSMBit + (static_cast<std::uint64_t>(kS) * kUniformBits);
+
+        /**
+         * @name kDSMBit
+         * @brief Bit offset of the DSM vector.
+         */
+        static constexpr std::uint64_t kDSMBit = kVSMBit + (static_cast<std::uint64_t>(kS) * kUniformBits);
+
+        /**
+         * @name xsmBit
+         * @brief Bit offset of the XSM vector.
+         * @return kDSMBit plus one diagonal stream.
+         */
+        static constexpr std::uint64_t xsmBit() { return kDSMBit + diagStreamBits(); }
+
+        /**
+         * @name ltp1Bit
+         * @brief Bit offset of the LTP1SM vector (LTP2SM follows it).
+         * @return xsmBit() plus one diagonal stream.
+         */
+        static constexpr std::uint64_t ltp1Bit() { return xsmBit() + diagStreamBits(); }
+
+        /**
+         * @name unpackUniform
+         * @brief Decode count elements of `width` bits starting at bitPos.
+         * @param bitPos First bit of the vector.
+         * @param width Element width in bits (1..16).
+         * @param count Number of elements.
+         * @param out Destination vector (resized to count).
+         * @return void
+         */
+        void unpackUniform(std::uint64_t bitPos, unsigned width, std::size_t count,
+                           std::vector<std::uint16_t> &out) const;
+
+        /**
+         * @name unpackDiagonal
+         * @brief Decode a variable-width DSM/XSM vector starting at bitPos.
+         * @param bitPos First bit of the vector.
+         * @param out Destination vector (resized to kDiagCount).
+         * @return void
+         */
+        void unpackDiagonal(std::uint64_t bitPos, std::vector<std::uint16_t> &out) const;
+
+        /**
+         * @name ltpBits
+         * @brief Width of each LTP partition sum element.
+         * @return bit_width of the LTP line length.
+         */
+        [[nodiscard]] static unsigned ltpBits();
+
+        /**
+         * @name data_
+         * @brief Viewed payload bytes (not owned).
+         */
+        const std::uint8_t *data_;
+
+        /**
+         * @name len_
+         * @brief Length of the viewed buffer.
+         */
+        std::size_t len_;
+    };
+
+} // namespace crsce::common::format
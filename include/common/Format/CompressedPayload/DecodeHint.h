@@ -0,0 +1,76 @@
+/**
+ * @file DecodeHint.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Optional per-block decode hint: the lex search's branch trail to the original block.
+ *
+ * The lex enumeration assigns cells in a fixed order, branching only where propagation
+ * leaves a cell open. The trail is the original block's value at each of those branch
+ * cells, root first; replaying it reaches the original block with no search at all. A hinted
+ * block (BlockFrame::kFlagHint) appends the hint section after its CompressedPayload:
+ *
+ *   Offset  Size          Field
+ *    0       2            trail_bits (little-endian uint16, at most kMaxTrailBits)
+ *    2       ceil(n / 8)  trail, MSB-first, zero-padded
+ *
+ * The hint is advisory: a decoder that cannot replay it, or whose result fails the lateral
+ * and block hashes, falls back to the DI search, which the payload still fully supports.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @struct DecodeHint
+     * @name DecodeHint
+     * @brief Encode and decode the hint section of a kFlagHint block.
+     */
+    struct DecodeHint {
+        /**
+         * @name kHeaderBytes
+         * @brief Size of the trail_bits field that opens the section.
+         */
+        static constexpr std::size_t kHeaderBytes = 2;
+
+        /**
+         * @name kMaxTrailBits
+         * @brief Longest trail a hint may carry. Keeps every hinted payload shorter than a
+         *        stored block, so the two stay distinguishable by size alone.
+         */
+        static constexpr std::size_t kMaxTrailBits = 4096;
+
+        /**
+         * @name serialize
+         * @brief Build the hint section for a trail.
+         * @param trail Branch values (0 or 1), root first; at most kMaxTrailBits entries.
+         * @return kHeaderBytes + ceil(trail.size() / 8) bytes.
+         * @throws None
+         */
+        [[nodiscard]] static std::vector<std::uint8_t> serialize(const std::vector<std::uint8_t> &trail);
+
+        /**
+         * @name deserialize
+         * @brief Decode a hint section.
+         * @param data Pointer to the section.
+         * @param len Section length in bytes.
+         * @return The trail, or nullopt if the length disagrees with trail_bits or the trail is too long.
+         * @throws None
+         */
+        [[nodiscard]] static std::optional<std::vector<std::uint8_t>> deserialize(const std::uint8_t *data,
+                                                                                  std::size_t len);
+
+        /**
+         * @name trailBytes
+         * @brief Bytes that follow the trail_bits field, read from the field itself.
+         * @param header Pointer to the first kHeaderBytes bytes of the section.
+         * @return ceil(trail_bits / 8).
+         * @throws None
+         */
+        [[nodiscard]] static std::size_t trailBytes(const std::uint8_t *header);
+    };
+
+} // namespace crsce::common::format
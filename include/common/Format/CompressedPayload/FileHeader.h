@@ -6,6 +6,14 @@
  * The file header encodes the magic number, format version, header size,
  * original file size, block count, and a CRC-32 checksum over bytes 0-23.
  * All multi-byte integers are stored in little-endian byte order.
+ *
+ * Version 1 files follow the header with raw kBlockPayloadBytes payloads.
+ * Version 2 files precede each payload with a 16-byte BlockFrame (block id,
+ * flags, CRC-32). The header layout is identical in both versions.
+ *
+ * A streamed v2 file (written while reading a pipe) does not know its size when
+ * the header is written: both counts hold kStreamed and the last block's frame
+ * carries BlockFrame::kFlagFinal with the number of valid bits in that block.
  */
 #pragma once
 
@@ -22,7 +30,7 @@ namespace crsce::common::format {
      * Layout (all multi-byte fields little-endian):
      *   Offset  Size  Type      Field
      *    0       4    char[4]   magic ("CRSC" = 0x43525343)
-     *    4       2    uint16    version (1)
+     *    4       2    uint16    version (1 = raw payloads, 2 = framed payloads)
      *    6       2    uint16    header_bytes (28)
      *    8       8    uint64    original_file_size_bytes
      *   16       8    uint64    block_count
@@ -36,11 +44,17 @@ namespace crsce::common::format {
          */
         static constexpr std::uint32_t kMagic = 0x43525343;
 
+        /**
+         * @name kVersionV1
+         * @brief Original format version: unframed fixed-size payloads (read-only support).
+         */
+        static constexpr std::uint16_t kVersionV1 = 1;
+
         /**
          * @name kVersion
-         * @brief Current format version.
+         * @brief Current format version (written by the compressor): BlockFrame-framed payloads.
          */
-        static constexpr std::uint16_t kVersion = 1;
+        static constexpr std::uint16_t kVersion = 2;
 
         /**
          * @name kHeaderBytes
@@ -48,6 +62,18 @@ namespace crsce::common::format {
          */
         static constexpr std::uint16_t kHeaderBytes = 28;
 
+        /**
+         * @name kStreamed
+         * @brief Sentinel for originalFileSizeBytes and blockCount in a streamed (size-unknown) v2 header.
+         */
+        static constexpr std::uint64_t kStreamed = UINT64_MAX;
+
+        /**
+         * @name version
+         * @brief Format version of this file (kVersionV1 or kVersion).
+         */
+        std::uint16_t version{kVersion};
+
         /**
          * @name originalFileSizeBytes
          * @brief Size of the original uncompressed file in bytes.
@@ -60,6 +86,22 @@ namespace crsce::common::format {
          */
         std::uint64_t blockCount{0};
 
+        /**
+         * @name streamed
+         * @brief True if the sizes were unknown when the header was written (see kStreamed).
+         * @return true if both originalFileSizeBytes and blockCount are kStreamed.
+         * @throws None
+         */
+        [[nodiscard]] bool streamed() const;
+
+        /**
+         * @name blockStride
+         * @brief Bytes occupied by each block on disk (payload, plus the BlockFrame in v2).
+         * @return Per-block stride in bytes.
+         * @throws None
+         */
+        [[nodiscard]] std::uint64_t blockStride() const;
+
         /**
          * @name serialize
          * @brief Serialize the header to a 28-byte little-endian buffer.
@@ -74,7 +116,8 @@ namespace crsce::common::format {
          * @param data Pointer to at least 28 bytes of header data.
          * @param len Length of the buffer (must be >= 28).
          * @return Deserialized FileHeader.
-         * @throws DecompressHeaderInvalid if len < 28, magic mismatch, or CRC-32 mismatch.
+         * @throws DecompressHeaderInvalid if len < 28, magic mismatch, CRC-32 mismatch, unknown version,
+         *         or a malformed streamed header.
          */
         static FileHeader deserialize(const std::uint8_t *data, std::size_t len);
     };
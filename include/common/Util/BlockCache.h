@@ -0,0 +1,222 @@
+/**
+ * @file BlockCache.h
+ * @author Sam Caldwell
+ * @brief Thread-safe, bounded, content-addressed cache of per-block results.
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ *
+ * Used by the compress and decompress pipelines so that a block seen before in the same
+ * run (VM images, zero padding, repeated records) costs one SHA-256 and one lookup instead
+ * of a DI search or a solve. Keys are SHA-256 digests of the block's bytes, so two blocks
+ * share an entry only if their bytes are equal (up to a 2^-128 collision bound).
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "common/BlockHash/BlockHash.h"
+
+namespace crsce::common::util {
+
+    /**
+     * @class BlockCache
+     * @name BlockCache
+     * @brief Bounded map from block content (SHA-256) to a per-block result, with hit counters.
+     * @details All members are safe to call concurrently. When full, the oldest entry is evicted
+     *          first. Two workers that miss on the same key at once both compute the value; the
+     *          second insert is ignored. A capacity of 0 disables the cache (find() always misses).
+     * @tparam Value Cached result type (copied out on a hit).
+     */
+    template <typename Value>
+    class BlockCache {
+    public:
+        /**
+         * @name Key
+         * @brief SHA-256 digest of a block's bytes.
+         */
+        using Key = std::array<std::uint8_t, 32>;
+
+        /**
+         * @name kDefaultCapacity
+         * @brief Entries kept when CRSCE_DEDUP_BLOCKS is not set (a few MB of Csm or payload).
+         */
+        static constexpr std::size_t kDefaultCapacity = 4096;
+
+        /**
+         * @name BlockCache
+         * @brief Construct a cache holding at most `capacity` entries.
+         * @param capacity Maximum number of entries; 0 disables the cache.
+         * @throws None
+         */
+        explicit BlockCache(const std::size_t capacity) : capacity_(capacity) {}
+
+        /**
+         * @name capacityFromEnv
+         * @brief Capacity from CRSCE_DEDUP_BLOCKS (0 disables), or kDefaultCapacity if unset or invalid.
+         * @return Entry capacity.
+         * @throws None
+         */
+        [[nodiscard]] static std::size_t capacityFromEnv() {
+            const char *env = std::getenv("CRSCE_DEDUP_BLOCKS"); // NOLINT(concurrency-mt-unsafe)
+            if (env == nullptr) {
+                return kDefaultCapacity;
+            }
+            try {
+                return static_cast<std::size_t>(std::stoull(std::string(env)));
+            } catch (...) {
+                return kDefaultCapacity;
+            }
+        }
+
+        /**
+         * @name keyOf
+         * @brief Content key of a byte range.
+         * @param data Pointer to the block's bytes.
+         * @param len Number of bytes.
+         * @return SHA-256 digest of the bytes.
+         * @throws None
+         */
+        [[nodiscard]] static Key keyOf(const std::uint8_t *data, const std::size_t len) {
+            return BlockHash::compute(data, len);
+        }
+
+        /**
+         * @name enabled
+         * @brief True if the cache can hold entries.
+         * @return capacity > 0.
+         * @throws None
+         */
+        [[nodiscard]] bool enabled() const { return capacity_ > 0; }
+
+        /**
+         * @name find
+         * @brief Look up a key, counting a hit or a miss.
+         * @param key Content key.
+         * @return A copy of the cached value, or nullopt.
+         * @throws None
+         */
+        [[nodiscard]] std::optional<Value> find(const Key &key) {
+            const std::scoped_lock lock(mtx_);
+            const auto it = map_.find(key);
+            if (it == map_.end()) {
+                ++misses_;
+                return std::nullopt;
+            }
+            ++hits_;
+            return it->second;
+        }
+
+        /**
+         * @name insert
+         * @brief Add an entry, evicting the oldest one if the cache is full.
+         * @param key Content key.
+         * @param value Result for that content.
+         * @return void
+         * @throws None
+         */
+        void insert(const Key &key, Value value) {
+            if (capacity_ == 0) {
+                return;
+            }
+            const std::scoped_lock lock(mtx_);
+            if (!map_.try_emplace(key, std::move(value)).second) {
+                return;
+            }
+            order_.push_back(key);
+            if (order_.size() > capacity_) {
+                map_.erase(order_.front());
+                order_.pop_front();
+            }
+        }
+
+        /**
+         * @name hits
+         * @brief Lookups that found an entry.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t hits() const {
+            const std::scoped_lock lock(mtx_);
+            return hits_;
+        }
+
+        /**
+         * @name misses
+         * @brief Lookups that found nothing.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t misses() const {
+            const std::scoped_lock lock(mtx_);
+            return misses_;
+        }
+
+        /**
+         * @name size
+         * @brief Entries currently held.
+         * @return Entry count.
+         */
+        [[nodiscard]] std::size_t size() const {
+            const std::scoped_lock lock(mtx_);
+            return map_.size();
+        }
+
+    private:
+        /**
+         * @struct KeyHash
+         * @name KeyHash
+         * @brief Bucket hash: the digest's first 8 bytes are already uniformly distributed.
+         */
+        struct KeyHash {
+            std::size_t operator()(const Key &key) const noexcept {
+                std::uint64_t h = 0;
+                std::memcpy(&h, key.data(), sizeof(h));
+                return static_cast<std::size_t>(h);
+            }
+        };
+
+        /**
+         * @name capacity_
+         * @brief Maximum number of entries.
+         */
+        std::size_t capacity_;
+
+        /**
+         * @name mtx_
+         * @brief Guards every member below.
+         */
+        mutable std::mutex mtx_;
+
+        /**
+         * @name map_
+         * @brief Content key -> cached value.
+         */
+        std::unordered_map<Key, Value, KeyHash> map_;
+
+        /**
+         * @name order_
+         * @brief Keys in insertion order, for oldest-first eviction.
+         */
+        std::deque<Key> order_;
+
+        /**
+         * @name hits_
+         * @brief Lookups that found an entry.
+         */
+        std::uint64_t hits_{0};
+
+        /**
+         * @name misses_
+         * @brief Lookups that found nothing.
+         */
+        std::uint64_t misses_{0};
+    };
+
+} // namespace crsce::common::util
@@ -0,0 +1,221 @@
+/**
+ * @file OrderedPipeline.h
+ * @author Sam Caldwell
+ * @brief Bounded worker pool that produces indexed results out of order and consumes them in order.
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ *
+ * Used by the block-parallel compress and decompress paths: each block is read
+ * sequentially, produced independently on a worker thread, and consumed (written)
+ * by the calling thread strictly in block order. runOrderedStream serves sources
+ * whose length is unknown up front (pipes); runOrderedPipeline is its bounded form. At most `window` blocks are claimed-but-not-yet-
+ * consumed at any time, which bounds in-flight memory regardless of file size.
+ */
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace crsce::common::util {
+    /**
+     * @name runOrderedStream
+     * @brief Load items sequentially until the source is exhausted, produce them on a worker pool,
+     *        and consume results in index order.
+     * @details With threads <= 1 the pipeline degenerates to a serial loop on the calling thread.
+     *          Otherwise `threads` workers claim indices in ascending order; a worker may only claim
+     *          index i while i < consumed + window, so loaded inputs plus buffered results never
+     *          exceed `window`. load(i) runs while the claim is held, so loads happen strictly in
+     *          index order and never concurrently (suitable for a sequential reader or a pipe).
+     *          The first load(i) that returns std::nullopt ends the stream: no index >= i is loaded
+     *          again, and the call returns once items [0, i) are consumed. consume() always runs on
+     *          the calling thread.
+     *
+     *          If load(i) or produce(i) throws, the exception is captured and rethrown on the calling
+     *          thread when index i reaches the head of the order, so the caller observes the same
+     *          first failure a serial loop would. Outstanding workers are stopped and joined first.
+     * @tparam Input Value type carried by the optional returned from load (must be move-constructible).
+     * @tparam Result Value type returned by produce (must be move-constructible).
+     * @param threads Number of worker threads.
+     * @param window Maximum number of items in flight or buffered (clamped to >= threads).
+     * @param load Callable `std::optional<Input>(std::uint64_t index)`; invoked in index order, one at
+     *             a time; returns std::nullopt once there are no more items.
+     * @param produce Callable `Result(std::uint64_t index, Input &&input)`; invoked concurrently.
+     * @param consume Callable `void(std::uint64_t index, Result &&result)`; invoked in index order.
+     * @return void
+     * @throws Any exception thrown by load, produce, or consume.
+     */
+    template <typename Input, typename Result, typename Load, typename Produce, typename Consume>
+    void runOrderedStream(const std::uint32_t threads, std::uint64_t window,
+                          Load &&load, Produce &&produce, Consume &&consume) {
+        if (threads <= 1) {
+            for (std::uint64_t i = 0;; ++i) {
+                std::optional<Input> input = load(i);
+                if (!input) {
+                    return;
+                }
+                consume(i, produce(i, std::move(*input)));
+            }
+        }
+        window = std::max<std::uint64_t>(window, threads);
+
+        /**
+         * @struct Slot
+         * @brief A finished item: either a result or the exception load()/produce() threw.
+         */
+        struct Slot {
+            std::optional<Result> result;
+            std::exception_ptr error;
+        };
+
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::map<std::uint64_t, Slot> finished;
+        std::uint64_t nextClaim = 0;
+        std::uint64_t consumed = 0;
+        std::uint64_t end = UINT64_MAX; // first index load() reported as absent
+        bool stop = false;
+
+        auto worker = [&]() {
+            while (true) {
+                std::uint64_t idx = 0;
+                std::optional<Input> input;
+                Slot slot;
+                {
+                    std::unique_lock lk(mtx);
+                    cv.wait(lk, [&] { return stop || nextClaim >= end || nextClaim < consumed + window; });
+                    if (stop || nextClaim >= end) {
+                        return;
+                    }
+                    idx = nextClaim++;
+                    try {
+                        input = load(idx);
+                        if (!input) {
+                            end = idx;
+                            lk.unlock();
+                            cv.notify_all();
+                            return;
+                        }
+                    } catch (...) {
+                        slot.error = std::current_exception();
+                    }
+                }
+                if (!slot.error) {
+                    try {
+                        slot.result.emplace(produce(idx, std::move(*input)));
+                    } catch (...) {
+                        slot.error = std::current_exception();
+                    }
+                }
+                input.reset();
+                {
+                    const std::scoped_lock lk(mtx);
+                    finished.emplace(idx, std::move(slot));
+                }
+                cv.notify_all();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads);
+        auto shutdown = [&]() {
+            {
+                const std::scoped_lock lk(mtx);
+                stop = true;
+            }
+            cv.notify_all();
+            for (auto &t : pool) {
+                if (t.joinable()) {
+                    t.join();
+                }
+            }
+        };
+
+        try {
+            for (std::uint32_t t = 0; t < threads; ++t) {
+                pool.emplace_back(worker);
+            }
+            for (std::uint64_t i = 0;; ++i) {
+                Slot slot;
+                {
+                    std::unique_lock lk(mtx);
+                    cv.wait(lk, [&] { return finished.contains(i) || i >= end; });
+                    if (!finished.contains(i)) {
+                        break;
+                    }
+                    auto node = finished.extract(i);
+                    slot = std::move(node.mapped());
+                    consumed = i + 1;
+                }
+                cv.notify_all();
+                if (slot.error) {
+                    std::rethrow_exception(slot.error);
+                }
+                consume(i, std::move(*slot.result));
+            }
+        } catch (...) {
+            shutdown();
+            throw;
+        }
+        shutdown();
+    }
+
+    /**
+     * @name runOrderedPipeline
+     * @brief Load `count` items sequentially, produce them on a worker pool, and consume results in index order.
+     * @details Bounded form of runOrderedStream: load(i) is called exactly once for each i in [0, count).
+     *          With threads <= 1 (or a single item) the pipeline runs serially on the calling thread.
+     * @tparam Input Value type returned by load (must be move-constructible).
+     * @tparam Result Value type returned by produce (must be move-constructible).
+     * @param count Number of items to process.
+     * @param threads Number of worker threads.
+     * @param window Maximum number of items in flight or buffered (clamped to >= threads).
+     * @param load Callable `Input(std::uint64_t index)`; invoked in index order, one at a time.
+     * @param produce Callable `Result(std::uint64_t index, Input &&input)`; invoked concurrently.
+     * @param consume Callable `void(std::uint64_t index, Result &&result)`; invoked in index order.
+     * @return void
+     * @throws Any exception thrown by load, produce, or consume.
+     */
+    template <typename Input, typename Result, typename Load, typename Produce, typename Consume>
+    void runOrderedPipeline(const std::uint64_t count, const std::uint32_t threads, const std::uint64_t window,
+                            Load &&load, Produce &&produce, Consume &&consume) {
+        runOrderedStream<Input, Result>(
+            static_cast<std::uint32_t>(std::min<std::uint64_t>(threads, count)), window,
+            [&](const std::uint64_t i) -> std::optional<Input> {
+                if (i >= count) {
+                    return std::nullopt;
+                }
+                return std::optional<Input>(load(i));
+            },
+            std::forward<Produce>(produce), std::forward<Consume>(consume));
+    }
+
+    /**
+     * @name runOrderedPipeline
+     * @brief Run produce(i) for i in [0, count) on a worker pool and consume(i, result) in index order.
+     * @details Convenience overload for work that needs no sequential load stage.
+     * @tparam Result Value type returned by produce (must be move-constructible).
+     * @param count Number of items to process.
+     * @param threads Number of worker threads.
+     * @param window Maximum number of items in flight or buffered (clamped to >= threads).
+     * @param produce Callable `Result(std::uint64_t index)`; invoked concurrently from workers.
+     * @param consume Callable `void(std::uint64_t index, Result &&result)`; invoked in index order.
+     * @return void
+     * @throws Any exception thrown by produce or consume.
+     */
+    template <typename Result, typename Produce, typename Consume>
+    void runOrderedPipeline(const std::uint64_t count, const std::uint32_t threads, const std::uint64_t window,
+                            Produce &&produce, Consume &&consume) {
+        runOrderedPipeline<std::uint64_t, Result>(
+            count, threads, window,
+            [](const std::uint64_t i) { return i; },
+            [&](const std::uint64_t i, std::uint64_t /*unused*/) { return produce(i); },
+            std::forward<Consume>(consume));
+    }
+} // namespace crsce::common::util
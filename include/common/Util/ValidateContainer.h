@@ -12,15 +12,16 @@
 namespace crsce::common::util {
     /**
      * @name validate_container
-     * @brief Validate that a file is a syntactically correct CRSCE v1 container.
+     * @brief Validate that a file is a syntactically correct CRSCE v1 or v2 container.
      * @param cx_path Path to the candidate CRSCE container file.
      * @param err Output parameter set to a human-readable reason on failure.
      * @return bool True if the container passes structural validation; false otherwise.
      * @details This function performs light-weight structural checks:
      *          - Verifies minimum size for header presence
-     *          - Parses and validates the v1 header (magic, version, sizes, CRC32)
+     *          - Parses and validates the header (magic, version 1 or 2, sizes, CRC32)
      *          - Confirms file size matches header-declared block count and layout
      *          - Scans each block to ensure LH and cross-sum segments have expected sizes
+     *          - For v2, checks every BlockFrame (CRC-32, block id, flags)
      */
     bool validate_container(const std::filesystem::path &cx_path, std::string &err);
 }
@@ -0,0 +1,26 @@
+/**
+ * @file is_stdio_path.h
+ * @brief Recognize the "-" path that selects stdin/stdout on the command line.
+ * @copyright © 2026 Sam Caldwell.  See LICENSE.txt for details
+ */
+#pragma once
+
+#include <string_view>
+
+namespace crsce::common::util {
+    /**
+     * @name kStdioPath
+     * @brief Path token meaning stdin for -in and stdout for -out.
+     */
+    inline constexpr std::string_view kStdioPath = "-";
+
+    /**
+     * @name is_stdio_path
+     * @brief True if path names the standard stream rather than a file.
+     * @param path Path given on the command line.
+     * @return true if path is exactly "-".
+     */
+    constexpr bool is_stdio_path(const std::string_view path) noexcept {
+        return path == kStdioPath;
+    }
+}
@@ -0,0 +1,22 @@
+/**
+ * @file DecompressBlockCorrupt.h
+ * @brief Thrown when a v2 block frame fails its integrity check.
+ * @author Sam Caldwell
+ * @copyright © 2026 Sam Caldwell. See LICENSE.txt for details
+ */
+#pragma once
+
+#include <string>
+#include "common/exceptions/CrsceException.h"
+
+namespace crsce::common::exceptions {
+    /**
+     * @name DecompressBlockCorrupt
+     * @brief A block frame has a bad CRC-32, unexpected block id, or unknown flags.
+     */
+    class DecompressBlockCorrupt : public CrsceException {
+    public:
+        explicit DecompressBlockCorrupt(const std::string &what_arg) : CrsceException(what_arg) {}
+        explicit DecompressBlockCorrupt(const char *what_arg) : CrsceException(what_arg) {}
+    };
+}
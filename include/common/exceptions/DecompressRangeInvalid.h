@@ -0,0 +1,22 @@
+/**
+ * @file DecompressRangeInvalid.h
+ * @brief Thrown when a requested decompression byte range lies outside the original file.
+ * @author Sam Caldwell
+ * @copyright © 2026 Sam Caldwell. See LICENSE.txt for details
+ */
+#pragma once
+
+#include <string>
+#include "common/exceptions/CrsceException.h"
+
+namespace crsce::common::exceptions {
+    /**
+     * @name DecompressRangeInvalid
+     * @brief Requested byte range starts beyond the end of the original file.
+     */
+    class DecompressRangeInvalid : public CrsceException {
+    public:
+        explicit DecompressRangeInvalid(const std::string &what_arg) : CrsceException(what_arg) {}
+        explicit DecompressRangeInvalid(const char *what_arg) : CrsceException(what_arg) {}
+    };
+}
@@ -6,13 +6,17 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace crsce::compress::cli {
     /**
      * @name run
      * @brief Thin CLI entry: run compression for input/output paths.
+     * @param input input filename (source)
+     * @param output output filename (target)
+     * @param threads number of blocks compressed concurrently (1 = serial)
      * @return 0 on success; non-zero on failure.
      */
-    int run(const std::string &input, const std::string &output);
+    int run(const std::string &input, const std::string &output, std::uint32_t threads = 1);
 }
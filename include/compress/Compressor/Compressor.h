@@ -9,10 +9,13 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
 #include "common/Format/CompressedPayload/CompressedPayload.h"
 
 namespace crsce::compress {
@@ -53,23 +56,64 @@ namespace crsce::compress {
          */
         Compressor();
 
+        /**
+         * @name Compressor
+         * @brief Construct a Compressor that processes up to `threads` blocks concurrently.
+         * @param threads Worker thread count; 0 or 1 selects the serial path.
+         * @throws None
+         */
+        explicit Compressor(std::uint32_t threads);
+
         /**
          * @name compress
          * @brief Compress an input file and write the CRSCE output.
-         * @param inputPath Path to the input file.
-         * @param outputPath Path to the output CRSCE file.
+         * @details A block whose DI cannot be found (time limit, DI > 255, or not found) is
+         *          written as a stored block instead of failing the whole file.
+         * @param inputPath Path to the input file, or "-" to read stdin (writes a streamed header).
+         * @param outputPath Path to the output CRSCE file, or "-" to write stdout.
          * @return void
          * @throws CompressInputOpenError if the input file cannot be opened.
          * @throws CompressInputReadError if the input file cannot be read.
          * @throws CompressOutputOpenError if the output file cannot be opened.
          * @throws CompressOutputWriteError if the output file write fails.
-         * @throws CompressDIOverflow if the DI exceeds 255 for any block.
-         * @throws CompressTimeoutException if the compression time limit is exceeded.
-         * @throws CompressDINotFound if enumeration exhausts without finding the original CSM.
          */
         void compress(const std::string &inputPath, const std::string &outputPath) const;
 
     private:
+        /**
+         * @name compressBlock
+         * @brief Run the full per-block pipeline (loadCsm through discoverDI) and serialize the payload.
+         * @details Safe to call concurrently from multiple threads: every call builds its own CSM,
+         *          payload, and solver stack.
+         * @param blockData Byte-aligned, zero-padded block bits (MSB-first).
+         * @param blockBitCount Number of valid bits in blockData.
+         * @param blockIndex Zero-based index of the block (for observability).
+         * @param blockCount Total number of blocks in the file (for observability).
+         * @param frameFlags Receives the BlockFrame flags the payload needs (kFlagHint, layout,
+         *        kFlagPadded).
+         * @return The serialized block payload (CompressedPayload::kBlockPayloadBytes bytes), followed
+         *         by its DecodeHint section when decode hints are enabled and the trail fits.
+         * @throws CompressDIOverflow if the DI exceeds 255.
+         * @throws CompressTimeoutException if the compression time limit is exceeded.
+         * @throws CompressDINotFound if enumeration exhausts without finding the original CSM.
+         */
+        [[nodiscard]] std::vector<std::uint8_t> compressBlock(const std::vector<std::uint8_t> &blockData,
+                                                              std::size_t blockBitCount,
+                                                              std::uint64_t blockIndex,
+                                                              std::uint64_t blockCount,
+                                                              std::uint16_t &frameFlags) const;
+
+        /**
+         * @name storeBlock
+         * @brief Build a stored-block payload: the block's raw bits, for a BlockFrame::kFlagStored frame.
+         * @param blockData Byte-aligned, zero-padded block bits (MSB-first).
+         * @param blockBitCount Number of valid bits in blockData.
+         * @return BlockFrame::kStoredPayloadBytes bytes; bits at or beyond blockBitCount are zero.
+         * @throws None
+         */
+        [[nodiscard]] static std::vector<std::uint8_t> storeBlock(const std::vector<std::uint8_t> &blockData,
+                                                                  std::size_t blockBitCount);
+
         /**
          * @name loadCsm
          * @brief Load raw bytes into a CSM, row-major, MSB-first per byte.
@@ -110,12 +154,31 @@ namespace crsce::compress {
          */
         static void computeBH(const common::Csm &csm, common::format::CompressedPayload &payload);
 
+        /**
+         * @name forcedCells
+         * @brief Count the cells the decoder's initial propagation fixes from a payload's cross-sums.
+         * @param payload Payload with its cross-sums filled in.
+         * @param validBits Data bits in the block; the padding after them is pre-assigned 0.
+         * @param layout Layout the payload's block was laid out with.
+         * @return Number of cells known before any branching, padding included.
+         * @throws None
+         */
+        [[nodiscard]] static std::size_t forcedCells(const common::format::CompressedPayload &payload,
+                                                     std::uint32_t validBits,
+                                                     common::csmlayout::Layout layout);
+
         /**
          * @name discoverDI
-         * @brief Discover the disambiguation index via solver enumeration.
-         * @param original The original CSM to match against enumerated solutions.
+         * @brief Discover the disambiguation index: the original CSM's rank in lex solution order.
+         * @details Uses EnumerationController::rankLex, which counts only the solutions that
+         *          precede the original and stops once the count passes 255.
+         * @param original The original CSM to rank among the enumerated solutions.
          * @param payload The CompressedPayload containing cross-sums and lateral hashes.
          * @param maxTimeSeconds Maximum wall-clock time in seconds for enumeration.
+         * @param validBits Data bits in the block; the padding after them is pre-assigned 0
+         *        (solvers::assignPadding), exactly as the decoder does for a kFlagPadded block.
+         * @param layout Layout the original was laid out with (locates the padding cells).
+         * @param trail If non-null, receives the original's branch trail (DecodeHint).
          * @return The zero-based DI (0..255).
          * @throws CompressTimeoutException if the time limit is exceeded.
          * @throws CompressDIOverflow if the DI exceeds 255.
@@ -123,7 +186,10 @@ namespace crsce::compress {
          */
         static std::uint8_t discoverDI(const common::Csm &original,
                                         const common::format::CompressedPayload &payload,
-                                        std::uint64_t maxTimeSeconds);
+                                        std::uint64_t maxTimeSeconds,
+                                        std::uint32_t validBits,
+                                        common::csmlayout::Layout layout,
+                                        std::vector<std::uint8_t> *trail = nullptr);
 
         /**
          * @name maxTimeSeconds_
@@ -139,6 +205,31 @@ namespace crsce::compress {
          *          compress-only debugging without running the solver.
          */
         bool disableDI_{false};
+
+        /**
+         * @name decodeHints_
+         * @brief When true, append a DecodeHint (the search trail) to every block that has one.
+         * @details Controlled by the CRSCE_DECODE_HINTS environment variable ("1" or "true").
+         *          Costs 2 + ceil(trail / 8) bytes per hinted block; saves the decoder its search.
+         */
+        bool decodeHints_{false};
+
+        /**
+         * @name layouts_
+         * @brief When true, lay each block out with the csmlayout::Layout that forces the most cells.
+         * @details Controlled by the CRSCE_LAYOUT_TRANSFORMS environment variable ("0" or "false"
+         *          keeps every block row-major). Has no effect when DI discovery is disabled.
+         */
+        bool layouts_{true};
+
+        /**
+         * @name threads_
+         * @brief Number of blocks compressed concurrently (1 = serial).
+         * @details Blocks are independent after loadCsm, so each worker runs the whole per-block
+         *          pipeline; an ordered writer emits payloads in block order with at most
+         *          2 * threads_ blocks buffered.
+         */
+        std::uint32_t threads_{1};
     };
 
 } // namespace crsce::compress
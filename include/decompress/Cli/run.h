@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace crsce::decompress::cli {
@@ -13,7 +14,23 @@ namespace crsce::decompress::cli {
      * @brief Thin CLI entrypoint: run decompression given input/output paths.
      * @param input Input filename (source).
      * @param output Output filename (target).
+     * @param threads Number of blocks reconstructed concurrently (1 = serial).
+     * @param resume Checkpoint to <output>.journal and continue from a matching journal.
      * @return int Process exit code (0 on success; non-zero on failure).
      */
-    int run(const std::string &input, const std::string &output);
+    int run(const std::string &input, const std::string &output, std::uint32_t threads = 1, bool resume = false);
+
+    /**
+     * @name run
+     * @brief Thin CLI entrypoint: decompress only original bytes [start, start + length).
+     * @param input Input filename (source).
+     * @param output Output filename (target); receives exactly the requested bytes.
+     * @param threads Number of blocks reconstructed concurrently (1 = serial).
+     * @param start Offset of the first original byte to recover.
+     * @param length Number of bytes to recover (clamped to the end of the original file).
+     * @param resume Checkpoint to <output>.journal and continue from a matching journal.
+     * @return int Process exit code (0 on success; non-zero on failure).
+     */
+    int run(const std::string &input, const std::string &output, std::uint32_t threads,
+            std::uint64_t start, std::uint64_t length, bool resume = false);
 }
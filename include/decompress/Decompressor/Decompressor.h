@@ -10,10 +10,14 @@
 #pragma once
 
 #include <cstdint>
+#include <istream>
 #include <string>
+#include <vector>
 
 #include "common/Csm/Csm.h"
-#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+#include "common/Format/CompressedPayload/FileHeader.h"
 
 namespace crsce::decompress {
 
@@ -23,12 +27,13 @@ namespace crsce::decompress {
      * @brief Decompresses a CRSCE file by reconstructing CSM blocks via constraint-based enumeration.
      * @details
      * For each block the decompressor:
-     *   1. Deserializes the CompressedPayload from the block's 19,549 bytes
+     *   1. Validates the block frame (v2) and views the payload bytes in place
      *   2. Builds solver components from the payload's cross-sums and lateral hashes
      *   3. Enumerates solutions until reaching the DI-th (0-based) match
      *   4. Extracts bits from the reconstructed CSM in row-major MSB-first order
      *
-     * The output file is truncated to the original file size stored in the header.
+     * Recovered bytes are streamed to the output as each block completes (in block
+     * order); the tail is trimmed to the original file size stored in the header.
      */
     class Decompressor {
     public:
@@ -51,30 +56,210 @@ namespace crsce::decompress {
          */
         Decompressor();
 
+        /**
+         * @name Decompressor
+         * @brief Construct a Decompressor that reconstructs up to `threads` blocks concurrently.
+         * @param threads Worker thread count; 0 or 1 selects the serial path.
+         * @throws None
+         */
+        explicit Decompressor(std::uint32_t threads);
+
+        /**
+         * @name Decompressor
+         * @brief Construct a Decompressor with a thread count and resume mode.
+         * @param threads Worker thread count; 0 or 1 selects the serial path.
+         * @param resume If true, checkpoint progress to <output>.journal and continue from a matching
+         *               journal instead of starting over (see ResumeJournal).
+         * @throws None
+         */
+        Decompressor(std::uint32_t threads, bool resume);
+
         /**
          * @name decompress
          * @brief Decompress a CRSCE input file and write the original output.
-         * @param inputPath Path to the CRSCE compressed input file.
-         * @param outputPath Path to the output (decompressed) file.
+         * @param inputPath Path to the CRSCE compressed input file, or "-" to read stdin.
+         * @param outputPath Path to the output (decompressed) file, or "-" to write stdout.
          * @return void
          * @throws DecompressInputOpenError if the input file cannot be opened.
          * @throws DecompressInputReadError if the input file cannot be read.
          * @throws DecompressHeaderInvalid if the header is invalid (too small, bad magic, CRC, or size mismatch).
-         * @throws DecompressOutputOpenError if the output file cannot be opened.
+         * @throws DecompressOutputOpenError if the output file cannot be opened, or (resume mode)
+         *         if the output exists without a matching journal.
          * @throws DecompressOutputWriteError if the output file write fails.
+         * @throws DecompressBlockCorrupt if a v2 block frame fails its integrity check.
          * @throws DecompressDIOutOfRange if a block cannot be reconstructed.
          */
         void decompress(const std::string &inputPath, const std::string &outputPath);
 
+        /**
+         * @name decompressRange
+         * @brief Recover only original bytes [start, start + length) and write them to the output.
+         * @details The range is mapped to block indices via the fixed per-block stride,
+         *          so only the blocks overlapping the range are read and solved. From stdin
+         *          the blocks ahead of the range are read and discarded instead of skipped.
+         * @param inputPath Path to the CRSCE compressed input file, or "-" to read stdin.
+         * @param outputPath Path to the output file (receives exactly the requested bytes), or "-" for stdout.
+         * @param start Offset of the first original byte to recover.
+         * @param length Number of bytes to recover; clamped to the end of the original file.
+         * @return void
+         * @throws DecompressRangeInvalid if start lies beyond the end of the original file.
+         * @throws DecompressInputOpenError, DecompressInputReadError, DecompressHeaderInvalid,
+         *         DecompressOutputOpenError, DecompressOutputWriteError, DecompressBlockCorrupt,
+         *         DecompressDIOutOfRange as for decompress().
+         */
+        void decompressRange(const std::string &inputPath, const std::string &outputPath,
+                             std::uint64_t start, std::uint64_t length);
+
     private:
+        /**
+         * @name readBlock
+         * @brief Read block b at the stream's current position, validating and stripping its v2 frame.
+         * @param in Input stream positioned at the start of block b.
+         * @param header Deserialized file header (selects v1 or v2 layout).
+         * @param b Block index expected at this position.
+         * @param inputPath Input path, used in error messages.
+         * @param frame If non-null, receives the v2 frame (left untouched for v1).
+         * @return The payload: kBlockPayloadBytes bytes (plus its DecodeHint section for a hinted
+         *         block), or kStoredPayloadBytes for a stored block.
+         * @throws DecompressInputReadError if the block cannot be read.
+         * @throws DecompressBlockCorrupt if a v2 frame fails validation.
+         */
+        static std::vector<std::uint8_t> readBlock(std::istream &in, const common::format::FileHeader &header,
+                                                   std::uint64_t b, const std::string &inputPath,
+                                                   common::format::BlockFrame *frame = nullptr);
+
+        /**
+         * @name extraBytes
+         * @brief Bytes a container with a known block count holds beyond the fixed block layout.
+         * @details Stored blocks (kStoredPayloadBytes - kBlockPayloadBytes each) and hinted blocks
+         *          (their DecodeHint section) are longer than blockStride(); 0 means block b is at
+         *          the fixed offset kHeaderBytes + b * blockStride().
+         * @param header Deserialized (or resolved) file header.
+         * @param fileSize Size of the input file in bytes.
+         * @return The extra bytes.
+         * @throws DecompressHeaderInvalid if the file is shorter than the fixed layout, or longer
+         *         than every block being stored would make it.
+         */
+        static std::uint64_t extraBytes(const common::format::FileHeader &header, std::uint64_t fileSize);
+
+        /**
+         * @name blockOffset
+         * @brief File offset of block b.
+         * @details O(1) when the file has no extra bytes; otherwise the frame headers ahead of b
+         *          are walked until every longer-than-stride block has been passed.
+         * @param in Seekable input stream; its position is undefined on return.
+         * @param header Deserialized (or resolved) file header.
+         * @param b Block index.
+         * @param extra Result of extraBytes().
+         * @param inputPath Input path, used in error messages.
+         * @return Offset of block b's frame (or payload, for v1).
+         * @throws DecompressInputReadError if a frame header cannot be read.
+         */
+        static std::uint64_t blockOffset(std::istream &in, const common::format::FileHeader &header, std::uint64_t b,
+                                         std::uint64_t extra, const std::string &inputPath);
+
+        /**
+         * @name peekFlagsAt
+         * @brief Flags of the (not yet validated) frame at a file offset.
+         * @param in Seekable input stream; left positioned after the frame header.
+         * @param offset Offset of the frame.
+         * @param inputPath Input path, used in error messages.
+         * @return The raw flags field.
+         * @throws DecompressInputReadError if the frame header cannot be read.
+         */
+        static std::uint16_t peekFlagsAt(std::istream &in, std::uint64_t offset, const std::string &inputPath);
+
+        /**
+         * @name frameBytesAt
+         * @brief Length of the (not yet validated) framed block at a file offset: frame plus payload.
+         * @param in Seekable input stream; its position is undefined on return.
+         * @param offset Offset of the frame.
+         * @param flags The frame's flags (from peekFlagsAt()).
+         * @param inputPath Input path, used in error messages.
+         * @return kFrameBytes + payloadBytes(flags) + hintBytes().
+         * @throws DecompressInputReadError if a hinted block's length field cannot be read.
+         */
+        static std::uint64_t frameBytesAt(std::istream &in, std::uint64_t offset, std::uint16_t flags,
+                                          const std::string &inputPath);
+
+        /**
+         * @name resolveStreamedHeader
+         * @brief Fill in the sizes of a streamed header from a seekable file.
+         * @details The block count follows from the file size, or from walking the frames when
+         *          stored or hinted blocks are present; the original size follows from the last block's
+         *          final frame (see streamedSize).
+         * @param in Seekable input stream; its position is undefined on return.
+         * @param header Deserialized streamed header.
+         * @param fileSize Size of the input file in bytes.
+         * @param inputPath Input path, used in error messages.
+         * @return The header with originalFileSizeBytes and blockCount filled in.
+         * @throws DecompressHeaderInvalid if the file is not a whole number of blocks or lacks a final frame.
+         * @throws DecompressBlockCorrupt if the last block's frame fails validation.
+         */
+        static common::format::FileHeader resolveStreamedHeader(std::istream &in, common::format::FileHeader header,
+                                                                std::uint64_t fileSize, const std::string &inputPath);
+
+        /**
+         * @name streamedSize
+         * @brief Original size in bytes implied by a final frame at block index b.
+         * @param b Index of the final block.
+         * @param frame The final block's frame.
+         * @return (b * kBlockBits + frame.finalBits) / 8.
+         * @throws DecompressBlockCorrupt if that bit count is not a whole number of bytes.
+         */
+        static std::uint64_t streamedSize(std::uint64_t b, const common::format::BlockFrame &frame);
+
+        /**
+         * @name validateFrames
+         * @brief Check the frames of blocks [firstBlock, endBlock) before any solving starts.
+         * @param in Input stream positioned at the start of block firstBlock.
+         * @param header Deserialized file header.
+         * @param firstBlock First block index to check.
+         * @param endBlock One past the last block index to check.
+         * @param inputPath Input path, used in error messages.
+         * @return void
+         * @throws DecompressBlockCorrupt naming the corrupt blocks, if any.
+         * @throws DecompressInputReadError if a block cannot be read.
+         */
+        static void validateFrames(std::istream &in, const common::format::FileHeader &header,
+                                   std::uint64_t firstBlock, std::uint64_t endBlock, const std::string &inputPath);
+
         /**
          * @name reconstructBlock
          * @brief Reconstruct the original CSM for a single block from its compressed payload.
-         * @param payload The deserialized CompressedPayload for the block.
-         * @return The reconstructed Csm matching the DI-th enumerated solution.
+         * @param payload View over the block's serialized payload bytes.
+         * @param selectThreads Workers for the DI-th solution search when DI > 0 (1 = serial
+         *        enumeration). The parallel search returns the same solution as the serial one.
+         * @param trail Decode-hint branch trail (DecodeHint) to replay before searching, or nullptr.
+         *        A trail that does not replay to a block passing every hash is ignored.
+         * @param validBits Data bits of a kFlagPadded block; the cells of the padding after them
+         *        are assigned 0 before the search (kBlockBits assigns nothing).
+         * @param layout Layout of the block (csmlayout::Layout), which locates the padding cells.
+         * @return The reconstructed Csm matching the DI-th enumerated solution, still laid out.
          * @throws DecompressDIOutOfRange if enumeration does not reach the DI-th solution.
          */
-        static common::Csm reconstructBlock(const common::format::CompressedPayload &payload);
+        static common::Csm reconstructBlock(const common::format::CompressedPayloadView &payload,
+                                            std::uint32_t selectThreads = 1,
+                                            const std::vector<std::uint8_t> *trail = nullptr,
+                                            std::uint32_t validBits = kBlockBits,
+                                            std::uint8_t layout = 0);
+
+        /**
+         * @name threads_
+         * @brief Number of blocks reconstructed concurrently (1 = serial).
+         * @details Each worker builds its own ConstraintStore / PropagationEngine /
+         *          solver stack inside reconstructBlock and solves blocks out of order;
+         *          a reorder buffer appends the recovered bits in block order with at
+         *          most 2 * threads_ blocks held. A block with DI > 0 also splits its
+         *          DI-th solution search across threads_ divided by the blocks in flight.
+         */
+        std::uint32_t threads_{1};
+
+        /**
+         * @name resume_
+         * @brief Resume mode: journal each written block and keep partial output on failure.
+         */
+        bool resume_{false};
     };
 
 } // namespace crsce::decompress
@@ -0,0 +1,219 @@
+/**
+ * @file ResumeJournal.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Sidecar checkpoint journal for resumable decompression (-resume).
+ *
+ * The journal lives next to the output (<output>.journal) and is a small text
+ * file: an identity line naming the input container's header and byte range,
+ * followed by one checkpoint line per completed block. Each checkpoint also
+ * carries a digest of the input blocks it covers, so a journal left by a
+ * different archive with the same header (same-size input) is rejected on
+ * load instead of splicing two archives' output together. Each checkpoint is
+ * appended only after that block's bytes have been fsync'd (syncFile()), and
+ * is fsync'd itself, so after a crash or power loss the last complete line
+ * still describes a prefix of the output that is on disk. A torn final line
+ * (process killed mid-append) is ignored. begin() replaces the journal by
+ * writing <journal>.tmp and renaming it over the old one, so a crash while
+ * rewriting leaves either the old journal or the new one, never neither.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace crsce::decompress {
+
+    /**
+     * @class ResumeJournal
+     * @name ResumeJournal
+     * @brief Records which blocks have been solved and written, and where the output stands.
+     */
+    class ResumeJournal {
+    public:
+        /**
+         * @struct Checkpoint
+         * @brief Output writer state after the last durably written block.
+         */
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        struct Checkpoint {
+            /**
+             * @name nextBlock
+             * @brief Absolute index of the first block not yet written.
+             */
+            std::uint64_t nextBlock{0};
+
+            /**
+             * @name outputBytes
+             * @brief Bytes of the output file covered by this checkpoint.
+             */
+            std::uint64_t outputBytes{0};
+
+            /**
+             * @name tailBase
+             * @brief Original-file byte offset of the carried partial byte.
+             */
+            std::uint64_t tailBase{0};
+
+            /**
+             * @name tailBits
+             * @brief Number of valid bits (0-7) in the carried partial byte.
+             */
+            std::uint64_t tailBits{0};
+
+            /**
+             * @name tailByte
+             * @brief The carried partial byte (valid bits MSB-first).
+             */
+            std::uint8_t tailByte{0};
+
+            /**
+             * @name digest
+             * @brief extend() chained over the input blocks from the range's first block up to
+             *        nextBlock (0 when none are covered).
+             */
+            std::uint32_t digest{0};
+        };
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+        /**
+         * @name ResumeJournal
+         * @brief Bind a journal to a path; nothing is opened until begin().
+         * @param path Journal file path (see pathFor()).
+         * @throws None
+         */
+        explicit ResumeJournal(std::string path);
+
+        /**
+         * @name ~ResumeJournal
+         * @brief Close the journal if open; the file itself is kept.
+         * @throws None
+         */
+        ~ResumeJournal();
+
+        ResumeJournal(const ResumeJournal &) = delete;
+        ResumeJournal &operator=(const ResumeJournal &) = delete;
+        ResumeJournal(ResumeJournal &&) = delete;
+        ResumeJournal &operator=(ResumeJournal &&) = delete;
+
+        /**
+         * @name pathFor
+         * @brief Journal path for a given output path.
+         * @param outputPath Decompressor output path.
+         * @return outputPath + ".journal".
+         * @throws None
+         */
+        [[nodiscard]] static std::string pathFor(const std::string &outputPath);
+
+        /**
+         * @name identity
+         * @brief Identity string binding a journal to one container header and output range.
+         * @details The header does not depend on the data (same-size inputs share it); the
+         *          checkpoints' digests bind the journal to the container's content.
+         * @param header Serialized file header bytes.
+         * @param headerLen Number of header bytes.
+         * @param start First original byte of the output range.
+         * @param end One past the last original byte of the output range.
+         * @return Hex header bytes followed by "start:end".
+         * @throws None
+         */
+        [[nodiscard]] static std::string identity(const std::uint8_t *header, std::size_t headerLen,
+                                                  std::uint64_t start, std::uint64_t end);
+
+        /**
+         * @name extend
+         * @brief Extend a content digest with the next input block.
+         * @details CRC-32 continued over the block's frame flags (2 bytes, little-endian; 0 for
+         *          v1) and its payload bytes as read from the container.
+         * @param digest Digest of the preceding blocks (0 for none).
+         * @param flags The block's frame flags.
+         * @param payload The block's payload bytes.
+         * @param len Number of payload bytes.
+         * @return The digest covering this block too.
+         * @throws None
+         */
+        [[nodiscard]] static std::uint32_t extend(std::uint32_t digest, std::uint16_t flags,
+                                                  const std::uint8_t *payload, std::size_t len);
+
+        /**
+         * @name syncFile
+         * @brief fsync a file's data to stable storage.
+         * @details Used on the output before each record(), so no checkpoint names bytes
+         *          that a crash could still lose. The caller flushes its own stream first.
+         * @param path File to sync.
+         * @return void
+         * @throws DecompressOutputWriteError if the file cannot be opened or synced.
+         */
+        static void syncFile(const std::string &path);
+
+        /**
+         * @name load
+         * @brief Read the last complete checkpoint from an existing journal.
+         * @param identity Identity string of the current run (input header and range).
+         * @return The checkpoint, or std::nullopt if no journal exists.
+         * @throws DecompressOutputOpenError if the journal exists but belongs to a different run
+         *         or holds no readable checkpoint.
+         */
+        [[nodiscard]] std::optional<Checkpoint> load(const std::string &identity) const;
+
+        /**
+         * @name begin
+         * @brief (Re)write the journal with the identity line and a starting checkpoint.
+         * @details Writes and fsyncs <path>.tmp, then renames it over the journal.
+         * @param identity Identity string of the current run.
+         * @param start Writer state to start (or resume) from.
+         * @return void
+         * @throws DecompressOutputWriteError if the journal cannot be written.
+         */
+        void begin(const std::string &identity, const Checkpoint &start);
+
+        /**
+         * @name record
+         * @brief Append and fsync a checkpoint after a block has been synced to the output.
+         * @param checkpoint Writer state after the block.
+         * @return void
+         * @throws DecompressOutputWriteError if the journal cannot be written.
+         */
+        void record(const Checkpoint &checkpoint);
+
+        /**
+         * @name remove
+         * @brief Close and delete the journal (called once the output is complete).
+         * @return void
+         * @throws None
+         */
+        void remove();
+
+    private:
+        /**
+         * @name writeAll
+         * @brief Write text to the open journal descriptor, retrying short writes.
+         * @param text Bytes to write.
+         * @return void
+         * @throws DecompressOutputWriteError on a write error.
+         */
+        void writeAll(const std::string &text) const;
+
+        /**
+         * @name close
+         * @brief Close the journal descriptor if open.
+         * @return void
+         * @throws None
+         */
+        void close();
+
+        /**
+         * @name path_
+         * @brief Journal file path.
+         */
+        std::string path_;
+
+        /**
+         * @name fd_
+         * @brief Append descriptor, open between begin() and remove() (-1 otherwise).
+         */
+        int fd_{-1};
+    };
+
+} // namespace crsce::decompress
@@ -0,0 +1,219 @@
+/**
+ * @file SolveCache.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Opt-in on-disk cache of solved blocks, shared across decompress runs.
+ *
+ * Enabled by CRSCE_SOLVE_CACHE=<directory>. Each entry is one file named by the hex SHA-256
+ * of a block's compressed payload and holding the block's packed rows (kStoredPayloadBytes,
+ * the same layout as a stored block). Entries are written to a temporary file and renamed
+ * into place, so concurrent runs sharing a directory never see a partial entry. A lookup
+ * refreshes the entry's modification time; trim() evicts the least recently used entries
+ * beyond CRSCE_SOLVE_CACHE_MAX, and temporary files orphaned by a crashed writer once they
+ * are older than kTmpGrace. store() trims every maxEntries / kTrimShare writes and a run
+ * trims once more when it ends, so the directory stays within the limit during a run. Every hit is checked against the payload's block hash (BH)
+ * before use, so a damaged or foreign entry costs a solve, never a wrong block. The cache is
+ * best effort: I/O errors disable an operation, never the decompression.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "common/Csm/Csm.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @class SolveCache
+     * @name SolveCache
+     * @brief Maps a payload digest to its reconstructed block in a local directory.
+     * @details All members are safe to call concurrently, including from several processes
+     *          sharing one directory. An empty directory path disables the cache.
+     */
+    class SolveCache {
+    public:
+        /**
+         * @name Key
+         * @brief SHA-256 digest of a block's serialized payload.
+         */
+        using Key = std::array<std::uint8_t, 32>;
+
+        /**
+         * @name kDefaultMaxEntries
+         * @brief Entries kept when CRSCE_SOLVE_CACHE_MAX is not set (about 130 MB of blocks).
+         */
+        static constexpr std::uint64_t kDefaultMaxEntries = 65536;
+
+        /**
+         * @name kTrimShare
+         * @brief store() trims after every maxEntries / kTrimShare writes (at least every write).
+         * @details Bounds the overshoot to that share of the limit per process, at the cost of one
+         *          directory scan per that many writes.
+         */
+        static constexpr std::uint64_t kTrimShare = 16;
+
+        /**
+         * @name kTmpGrace
+         * @brief Age after which trim() deletes a temporary entry file as orphaned.
+         * @details store() renames its temporary file within milliseconds; one older than this was
+         *          left by a process that died between write and rename.
+         */
+        static constexpr std::chrono::hours kTmpGrace{1};
+
+        /**
+         * @name SolveCache
+         * @brief Bind the cache to a directory, creating it if needed.
+         * @param dir Cache directory; empty (or not creatable) disables the cache.
+         * @param maxEntries Entries kept by trim().
+         * @throws None
+         */
+        SolveCache(std::string dir, std::uint64_t maxEntries);
+
+        /**
+         * @name dirFromEnv
+         * @brief Cache directory from CRSCE_SOLVE_CACHE, or empty if unset.
+         * @return Directory path.
+         * @throws None
+         */
+        [[nodiscard]] static std::string dirFromEnv();
+
+        /**
+         * @name maxEntriesFromEnv
+         * @brief Entry limit from CRSCE_SOLVE_CACHE_MAX, or kDefaultMaxEntries if unset or invalid.
+         * @return Entry limit.
+         * @throws None
+         */
+        [[nodiscard]] static std::uint64_t maxEntriesFromEnv();
+
+        /**
+         * @name enabled
+         * @brief True if the cache has a usable directory.
+         * @return Enabled flag.
+         * @throws None
+         */
+        [[nodiscard]] bool enabled() const { return !dir_.empty(); }
+
+        /**
+         * @name load
+         * @brief Look up a block by payload digest and check it against the payload's block hash.
+         * @param key SHA-256 of the serialized payload.
+         * @param payload The payload itself (supplies the expected BH).
+         * @return The block, or nullopt on a miss, a short entry or a BH mismatch (the entry is removed).
+         * @throws None
+         */
+        [[nodiscard]] std::optional<common::Csm> load(const Key &key,
+                                                      const common::format::CompressedPayloadView &payload);
+
+        /**
+         * @name store
+         * @brief Write a solved block atomically (temporary file, then rename), trimming the
+         *        directory every trimEvery_ writes.
+         * @param key SHA-256 of the serialized payload.
+         * @param csm The reconstructed block.
+         * @return void
+         * @throws None
+         */
+        void store(const Key &key, const common::Csm &csm);
+
+        /**
+         * @name trim
+         * @brief Remove the least recently used entries until at most maxEntries remain, and
+         *        temporary files older than kTmpGrace.
+         * @return Number of entries removed (temporary files not included).
+         * @throws None
+         */
+        std::uint64_t trim();
+
+        /**
+         * @name hits
+         * @brief Lookups answered from the directory.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t hits() const { return hits_.load(); }
+
+        /**
+         * @name misses
+         * @brief Lookups that found no usable entry.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t misses() const { return misses_.load(); }
+
+        /**
+         * @name writes
+         * @brief Entries written by store().
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t writes() const { return writes_.load(); }
+
+        /**
+         * @name evicted
+         * @brief Entries removed by trim().
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t evicted() const { return evicted_.load(); }
+
+    private:
+        /**
+         * @name pathOf
+         * @brief Entry path for a key: <dir>/<hex key>.blk.
+         * @param key Payload digest.
+         * @return File path.
+         */
+        [[nodiscard]] std::string pathOf(const Key &key) const;
+
+        /**
+         * @name dir_
+         * @brief Cache directory (empty when disabled).
+         */
+        std::string dir_;
+
+        /**
+         * @name maxEntries_
+         * @brief Entries kept by trim().
+         */
+        std::uint64_t maxEntries_;
+
+        /**
+         * @name trimEvery_
+         * @brief Writes between the trims store() runs (maxEntries / kTrimShare, at least 1).
+         */
+        std::uint64_t trimEvery_;
+
+        /**
+         * @name hits_
+         * @brief Lookups answered from the directory.
+         */
+        std::atomic<std::uint64_t> hits_{0};
+
+        /**
+         * @name misses_
+         * @brief Lookups that found no usable entry.
+         */
+        std::atomic<std::uint64_t> misses_{0};
+
+        /**
+         * @name writes_
+         * @brief Entries written by store().
+         */
+        std::atomic<std::uint64_t> writes_{0};
+
+        /**
+         * @name evicted_
+         * @brief Entries removed by trim().
+         */
+        std::atomic<std::uint64_t> evicted_{0};
+
+        /**
+         * @name seq_
+         * @brief Numbers this process's temporary files.
+         */
+        std::atomic<std::uint64_t> seq_{0};
+    };
+
+} // namespace crsce::decompress
@@ -0,0 +1,33 @@
+/**
+ * @file BlockPadding.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Pre-assignment of a partial block's zero padding before the solver starts.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "common/Csm/CsmLayout.h"
+#include "decompress/Solvers/ConstraintStore.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name assignPadding
+     * @brief Assign 0 to every cell that holds padding rather than data, before initial propagation.
+     *
+     * The last block of a file is zero-padded to kS * kS bits, and the file size says exactly
+     * where the data ends. Assigning those cells up front takes them out of the search (up to
+     * every cell of the block) instead of leaving them to propagation and branching. Both
+     * discoverDI and the decoder must do this, or they rank solutions in different sets; the
+     * compressor marks blocks whose DI was ranked this way with BlockFrame::kFlagPadded.
+     *
+     * @param store Freshly built constraint store with nothing assigned.
+     * @param validBits Stream bits that hold data; bits [validBits, kS * kS) are padding.
+     * @param layout Layout the block was laid out with (padding bits go where it puts them).
+     * @return Number of cells assigned.
+     * @throws None
+     */
+    std::uint32_t assignPadding(ConstraintStore &store, std::uint32_t validBits, common::csmlayout::Layout layout);
+
+} // namespace crsce::decompress::solvers
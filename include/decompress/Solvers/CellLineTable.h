@@ -0,0 +1,73 @@
+/**
+ * @file CellLineTable.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Per-cell table of the flat stat indices of every constraint line through the cell.
+ *
+ * Each cell lies on six lines: its row, column, diagonal, anti-diagonal, and one line of each
+ * LTP sub-table. assign/unassign, propagation and scoring used to recompute the diagonal and
+ * anti-diagonal indices with arithmetic and look the LTP lines up through ltpMembership()
+ * (a function-local static). This table holds all six flat indices per cell in one 16-byte
+ * entry, four entries per cache line, so a cell's lines are a single load.
+ *
+ * The geometric half (row, column, diagonal, anti-diagonal) is generated at compile time for
+ * the fixed kS = 127 geometry. The LTP half depends on the LTP seeds or table file
+ * (CRSCE_LTP_SEED_*, CRSCE_LTP_TABLE_FILE), which are read at run time, so it is filled in from
+ * ltpMembership() the first time cellLineTable() is called.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "decompress/Solvers/LtpTable.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name kCellLineSlots
+     * @brief Line slots per cell: row, column, diagonal, anti-diagonal, LTP1, LTP2.
+     */
+    inline constexpr std::uint8_t kCellLineSlots = 6;
+
+    /**
+     * @name kCellLineNone
+     * @brief Flat index one past the last line: fills the LTP slot of a cell a loaded LTP table
+     *        left without one. Stores keep a spare (never read) stat there, so updates stay unconditional.
+     */
+    inline constexpr std::uint16_t kCellLineNone = static_cast<std::uint16_t>(kLtp2Base + kLtpNumLines);
+
+    /**
+     * @struct CellLineIndex
+     * @name CellLineIndex
+     * @brief The flat stat indices of the lines through one cell, padded to 16 bytes.
+     */
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    struct alignas(16) CellLineIndex {
+        /**
+         * @name flat
+         * @brief Flat indices in slot order row, column, diagonal, anti-diagonal, LTP1, LTP2.
+         */
+        std::array<std::uint16_t, kCellLineSlots> flat{};
+
+        /**
+         * @name count
+         * @brief Real lines in flat (6, or fewer when a loaded LTP table covers fewer sub-tables);
+         *        slots at or past count hold kCellLineNone.
+         */
+        std::uint8_t count{0};
+    };
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+    static_assert(sizeof(CellLineIndex) == 16, "CellLineIndex must pack four entries per cache line");
+
+    /**
+     * @name cellLineTable
+     * @brief The process-wide cell-line table, row-major (entry r * kS + c), 64-byte aligned.
+     * @details The first call fills the LTP slots (thread-safe); later calls only return the
+     *          pointer. Hot paths fetch it once and keep it.
+     * @return Pointer to kLtpS * kLtpS entries.
+     * @throws None
+     */
+    [[nodiscard]] const CellLineIndex *cellLineTable();
+
+} // namespace crsce::decompress::solvers
@@ -6,14 +6,18 @@
 #pragma once
 
 #include <array>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <utility>
 #include <vector>
 
+#include "decompress/Solvers/CellLineTable.h"
 #include "decompress/Solvers/CellState.h"
 #include "decompress/Solvers/IConstraintStore.h"
 #include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/LineMaskTable.h"
 
 namespace crsce::decompress::solvers {
     /**
@@ -25,6 +29,10 @@ namespace crsce::decompress::solvers {
      * for all 12s-2 lines (s rows, s columns, 2s-1 diagonals, 2s-1 anti-diagonals,
      * and 6 pseudorandom LTP partitions of s lines each).
      *
+     * Cell state lives in two bit-planes, two words per row: rowBits_ (the value plane)
+     * and assigned_ (the known plane). A value bit is only ever set on a known cell, so
+     * getCellState() is known + value with no branch and no per-cell byte array.
+     *
      * B.20: replaced 4 toroidal-slope partitions with 4 LTP pseudorandom partitions.
      * B.27: added LTP5 and LTP6 (6 total LTP partitions, 12s-2 = 6130 lines total).
      */
@@ -120,6 +128,14 @@ namespace crsce::decompress::solvers {
          */
         static constexpr std::uint32_t kTotalLines = kBasicLines + (kNumLtpPartitions * kS); // 1014
 
+        /**
+         * @name kStatSlots
+         * @brief Per-line statistics slots: every line plus the spare kCellLineNone slot, which
+         *        absorbs the updates of a CellLineIndex slot that has no line and is never read.
+         */
+        static constexpr std::uint32_t kStatSlots = kTotalLines + 1;
+        static_assert(kCellLineNone == kTotalLines, "CellLineTable's spare slot must follow the last line");
+
         /**
          * @name lineIndex
          * @brief Map a LineID to a flat index in [0, kTotalLines).
@@ -239,11 +255,39 @@ namespace crsce::decompress::solvers {
         [[nodiscard]] std::uint16_t getUnknownCount(LineID line) const override;
         [[nodiscard]] std::uint16_t getAssignedCount(LineID line) const override;
         [[nodiscard]] CellLines getLinesForCell(std::uint16_t r, std::uint16_t c) const override;
-        [[nodiscard]] CellState getCellState(std::uint16_t r, std::uint16_t c) const override;
-        [[nodiscard]] std::uint8_t getCellValue(std::uint16_t r, std::uint16_t c) const override;
         [[nodiscard]] std::uint16_t getRowUnknownCount(std::uint16_t r) const override;
         [[nodiscard]] const std::array<std::uint64_t, 2> &getRow(std::uint16_t r) const override;
 
+        /**
+         * @name getCellState
+         * @brief Get the current assignment state of cell (r, c), branch-free.
+         *
+         * The known bit plus the value bit (set only on known cells) is the CellState
+         * (0 = Unassigned, 1 = Zero, 2 = One). Defined here so the solver's probe loops,
+         * which hold the concrete store, inline it.
+         *
+         * @param r Row index.
+         * @param c Column index.
+         * @return The cell's state (Unassigned, Zero, or One).
+         * @throws None
+         */
+        [[nodiscard]] CellState getCellState(const std::uint16_t r, const std::uint16_t c) const override {
+            const auto known = (assigned_[r][c / 64U] >> (c % 64U)) & 1U; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            return static_cast<CellState>(known + getCellValue(r, c));
+        }
+
+        /**
+         * @name getCellValue
+         * @brief Get the assigned value of cell (r, c) from the value plane.
+         * @param r Row index.
+         * @param c Column index.
+         * @return 0 or 1. Returns 0 for unassigned cells.
+         * @throws None
+         */
+        [[nodiscard]] std::uint8_t getCellValue(const std::uint16_t r, const std::uint16_t c) const override {
+            return static_cast<std::uint8_t>((rowBits_[r][c / 64U] >> (63U - (c % 64U))) & 1U); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
         /**
          * @name getColumn
          * @brief Assemble column c from rowBits_ as 8 uint64 words (MSB-first, matching getRow format).
@@ -261,6 +305,63 @@ namespace crsce::decompress::solvers {
         [[nodiscard]] std::optional<std::pair<std::uint16_t, std::uint16_t>>
             getFirstUnassigned(std::uint16_t startRow) const;
 
+        /**
+         * @name forEachUnassignedInRow
+         * @brief Invoke callback(c) for every unassigned cell of row r, a word of the known plane at a time.
+         *
+         * Skips assigned cells 64 at a time instead of probing each one. The callback may assign
+         * cells of row r; cells assigned that way are not visited afterwards.
+         *
+         * @tparam Func Callable with signature void(uint16_t c).
+         * @param r Row index.
+         * @param callback Invoked once per unassigned column, in increasing column order.
+         */
+        template<typename Func>
+        void forEachUnassignedInRow(const std::uint16_t r, const Func &callback) const {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+            for (std::uint16_t w = 0; w < 2; ++w) {
+                const std::uint64_t valid = w == 0 ? ~std::uint64_t{0} : kLastWordValid;
+                std::uint64_t free = ~assigned_[r][w] & valid;
+                while (free != 0) {
+                    const auto bit = static_cast<std::uint16_t>(__builtin_ctzll(free));
+                    callback(static_cast<std::uint16_t>((w * 64U) + bit));
+                    free &= free - 1;
+                    free &= ~assigned_[r][w];
+                }
+            }
+            // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        /**
+         * @name forEachUnassignedOnLine
+         * @brief Invoke callback(r, c) for every unassigned cell of a line, via its membership mask.
+         *
+         * ANDs the line's LineMask with the complement of the known plane, one row word at a
+         * time over the rows the line spans, and visits the set bits with countr_zero. The
+         * callback may assign cells; cells assigned that way are not visited afterwards.
+         *
+         * @tparam Func Callable with signature void(uint16_t r, uint16_t c).
+         * @param flatIdx Flat line index (see lineIndex()).
+         * @param callback Invoked once per unassigned cell, in row-major order.
+         */
+        template<typename Func>
+        void forEachUnassignedOnLine(const std::uint32_t flatIdx, const Func &callback) const {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto &mask = masks_[flatIdx];
+            for (std::uint16_t r = mask.rowLo; r <= mask.rowHi; ++r) {
+                for (std::uint16_t w = 0; w < 2; ++w) {
+                    std::uint64_t free = mask.words[r][w] & ~assigned_[r][w];
+                    while (free != 0) {
+                        const auto bit = static_cast<std::uint16_t>(std::countr_zero(free));
+                        callback(r, static_cast<std::uint16_t>((w * 64U) + bit));
+                        free &= free - 1;
+                        free &= ~assigned_[r][w];
+                    }
+                }
+            }
+            // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
         /**
          * @struct LineStat
          * @name LineStat
@@ -297,54 +398,95 @@ namespace crsce::decompress::solvers {
         }
 
         /**
-         * @struct Snapshot
-         * @name Snapshot
-         * @brief Complete mutable state snapshot for backtracking (~26 KB).
+         * @name cellLines
+         * @brief The flat indices of the lines through cell (r, c), from cellLineTable().
+         * @param r Row index.
+         * @param c Column index.
+         * @return The cell's CellLineIndex (six slots; count real lines).
          */
-        struct Snapshot {
-            /**
-             * @name cells
-             * @brief Copy of cells_ vector.
-             */
-            std::vector<CellState> cells;
+        [[nodiscard]] const CellLineIndex &cellLines(const std::uint16_t r, const std::uint16_t c) const {
+            return lines_[(static_cast<std::size_t>(r) * kS) + c]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
 
-            /**
-             * @name stats
-             * @brief Copy of stats_ array.
-             */
-            std::array<LineStat, kTotalLines> stats;
+        /**
+         * @name drainLineEvents
+         * @brief Hand every pending line event to callback(flatIdx), oldest first, and clear them.
+         *
+         * assign() raises an event for a line when its counters reach a state propagation must act
+         * on: rho < 0 or rho > u (conflict), or u > 0 with rho == 0 or rho == u (forcing). Each line
+         * is pending at most once until drained, so the queue never exceeds the line count.
+         *
+         * @tparam Func Callable with signature void(uint16_t flatIdx).
+         * @param callback Invoked once per pending line.
+         */
+        template<typename Func>
+        void drainLineEvents(const Func &callback) {
+            // Index loop: the callback may assign, which can raise further events.
+            for (std::size_t i = 0; i < lineEvents_.size(); ++i) {
+                const auto idx = lineEvents_[i];
+                eventPending_[idx] = 0; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                callback(idx);
+            }
+            lineEvents_.clear();
+        }
 
-            /**
-             * @name rowBits
-             * @brief Copy of rowBits_ vector.
-             */
-            std::vector<std::array<std::uint64_t, 2>> rowBits;
+        /**
+         * @name clearLineEvents
+         * @brief Drop every pending line event (after a conflict, when the caller will undo anyway).
+         * @throws None
+         */
+        void clearLineEvents() {
+            for (const auto idx : lineEvents_) {
+                eventPending_[idx] = 0; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+            lineEvents_.clear();
+        }
 
-            /**
-             * @name assigned
-             * @brief Copy of assigned_ bitset.
-             */
-            std::array<std::array<std::uint64_t, 2>, kS> assigned;
-        };
+        /**
+         * @name mark
+         * @brief Start (or nest) an undo point: rollback(mark()) later reverts every assign made after it.
+         *
+         * The first mark turns the trail on; from then on assign() records each cell it sets.
+         * Marks nest: an inner rollback leaves the outer mark valid. Every mark must be closed,
+         * innermost first, by exactly one rollback() or commit().
+         *
+         * @return The trail position to pass to rollback().
+         * @throws None
+         */
+        [[nodiscard]] std::size_t mark();
 
         /**
-         * @name takeSnapshot
-         * @brief Save the complete mutable state for later restoration.
-         * @return Snapshot containing copies of all mutable members.
+         * @name rollback
+         * @brief Unassign every cell assigned since the given mark, newest first, in O(changes).
+         *
+         * Closes the innermost mark (which must be this one). Closing the outermost mark turns the
+         * trail off again until the next mark(). Only assignments are undone: a cell that was
+         * unassigned after the mark is not re-assigned.
+         *
+         * @param trailMark A value returned by mark().
          * @throws None
          */
-        [[nodiscard]] Snapshot takeSnapshot() const;
+        void rollback(std::size_t trailMark);
 
         /**
-         * @name restoreSnapshot
-         * @brief Restore the mutable state from a previously taken snapshot.
-         * @param snap The snapshot to restore.
+         * @name commit
+         * @brief Keep every assign made since the innermost mark and close that mark.
+         *
+         * Under an outer mark the cells stay trailed, so rolling the outer mark back still undoes
+         * them. Committing the outermost mark turns the trail off and empties it.
+         *
          * @throws None
          */
-        void restoreSnapshot(const Snapshot &snap);
+        void commit();
 
     private:
 
+        /**
+         * @name kLastWordValid
+         * @brief Valid-column mask of a row's second known-plane word (columns 64..kS-1, LSB-first).
+         */
+        static constexpr std::uint64_t kLastWordValid = (std::uint64_t{1} << (kS - 64U)) - 1;
+
         /**
          * @name lineLen
          * @brief Compute the length of a line (number of cells).
@@ -355,10 +497,11 @@ namespace crsce::decompress::solvers {
         [[nodiscard]] std::uint16_t lineLen(LineID line) const;
 
         /**
-         * @name cells_
-         * @brief Assignment state of each cell (flat, row-major: cells_[r * kS + c]).
+         * @name closeMark
+         * @brief Close the innermost mark; closing the last one turns the trail off and empties it.
+         * @throws None
          */
-        std::vector<CellState> cells_;
+        void closeMark();
 
         /**
          * @name stats_
@@ -367,17 +510,60 @@ namespace crsce::decompress::solvers {
          * Layout: rows [0,kS), cols [kS,2*kS), diags [2*kS, 2*kS+kNumDiags),
          * anti-diags [2*kS+kNumDiags, kBasicLines), LTP1–LTP4 follow.
          */
-        std::array<LineStat, kTotalLines> stats_{};
+        std::array<LineStat, kStatSlots> stats_{};
+
+        /**
+         * @name lines_
+         * @brief cellLineTable(), fetched once so updates skip its first-use guard.
+         */
+        const CellLineIndex *lines_{cellLineTable()};
+
+        /**
+         * @name masks_
+         * @brief lineMaskTable(), fetched once so forcing skips its first-use guard.
+         */
+        const LineMask *masks_{lineMaskTable()};
+
+        /**
+         * @name lineEvents_
+         * @brief Flat indices of lines assign() found forcing or in conflict, not yet drained.
+         */
+        std::vector<std::uint16_t> lineEvents_;
+
+        /**
+         * @name eventPending_
+         * @brief 1 while a line is in lineEvents_. The spare slot (kCellLineNone) is pinned to 1:
+         *        its counters are never meaningful, so it must never raise an event.
+         */
+        std::array<std::uint8_t, kStatSlots> eventPending_{};
+
+        /**
+         * @name trail_
+         * @brief Cells (r * kS + c) assigned since the first outstanding mark(), oldest first.
+         */
+        std::vector<std::uint16_t> trail_;
+
+        /**
+         * @name markDepth_
+         * @brief Marks opened and not yet closed by rollback() or commit().
+         */
+        std::size_t markDepth_{0};
+
+        /**
+         * @name trailing_
+         * @brief True while markDepth_ > 0, so assign() records onto trail_.
+         */
+        bool trailing_{false};
 
         /**
          * @name rowBits_
-         * @brief Row bit storage for hash verification (8 x uint64 per row, MSB-first).
+         * @brief Value plane: assigned-one cells (2 x uint64 per row, MSB-first, as hashed).
          */
         std::vector<std::array<std::uint64_t, 2>> rowBits_;
 
         /**
          * @name assigned_
-         * @brief Compact bitset tracking assigned cells (1 = assigned, 0 = unassigned).
+         * @brief Known plane: compact bitset tracking assigned cells (1 = assigned, 0 = unassigned).
          *
          * Same 511 x 8 x uint64 layout as rowBits_. Bit c in row r is at:
          *   assigned_[r][c / 64] & (1ULL << (c % 64))
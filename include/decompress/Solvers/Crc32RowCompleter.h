@@ -121,6 +121,13 @@ namespace crsce::decompress::solvers {
              * @brief (column, value) pairs for determined cells.
              */
             std::array<std::pair<std::uint16_t, std::uint8_t>, 32> assignments{};
+
+            /**
+             * @name freeVariables
+             * @brief Unknowns the CRC-32 system leaves free. When non-zero, assignments is the
+             *        first completion that also meets the row sum, not the only one.
+             */
+            std::uint8_t freeVariables{0};
         };
 
         /**
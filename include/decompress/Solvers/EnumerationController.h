@@ -5,16 +5,23 @@
  */
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "common/Csm/Csm.h"
 #include "decompress/Solvers/AsyncHashPipeline.h"
 #include "decompress/Solvers/BranchingController.h"
 #include "decompress/Solvers/IConstraintStore.h"
 #include "decompress/Solvers/IEnumerationController.h"
+#include "decompress/Solvers/IBranchingController.h"
 #include "decompress/Solvers/IHashVerifier.h"
 #include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/LexPrefix.h"
+#include "decompress/Solvers/LexPruner.h"
+#include "decompress/Solvers/LexRank.h"
 
 namespace crsce::decompress::solvers {
     /**
@@ -23,7 +30,9 @@ namespace crsce::decompress::solvers {
      * @brief Coordinates DFS traversal to enumerate feasible CSM solutions in lex order.
      *
      * Implements Algorithm 1 (EnumerateSolutionsLex) from the specification.
-     * Composes IConstraintStore, IPropagationEngine, IBranchingController, and IHashVerifier.
+     * Composes IConstraintStore, IPropagationEngine, IBranchingController, and IHashVerifier,
+     * plus a LexPruner that adds CRC-32 row completion and failed-literal probing without
+     * changing the order in which solutions are found.
      */
     class EnumerationController final : public IEnumerationController {
     public:
@@ -51,7 +60,107 @@ namespace crsce::decompress::solvers {
         auto enumerateSolutionsLex() -> crsce::common::Generator<crsce::common::Csm> override;
         void reset() override;
 
+        /**
+         * @name rankLex
+         * @brief Position of a known solution in the enumerateSolutionsLex() order, without enumerating it.
+         *
+         * Descends the DFS along the target's own bits. At each branch point, sibling subtrees that
+         * enumerateSolutionsLex() visits before the target's value are fully counted (feasible,
+         * every row hash verified); subtrees after it are never expanded. Counting stops as soon
+         * as more than `limit` solutions precede the target.
+         *
+         * @param target The solution to rank (normally the compressor's original CSM).
+         * @param limit Largest rank the caller can encode.
+         * @param deadline Wall-clock limit for the walk.
+         * @return Found with the 0-based rank and the target's branch trail, or Overflow, NotFound, or TimedOut.
+         * @throws None
+         */
+        [[nodiscard]] LexRank rankLex(const crsce::common::Csm &target, std::uint32_t limit,
+                                      std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * @name expandLex
+         * @brief Children of a search node, in enumeration order.
+         * @details A child is kept if its branch value propagates without contradiction and every
+         *          row it completes passes its hash; a child with no unassigned cell left is a leaf
+         *          only if all rows verify. A node that is already complete (only possible for the
+         *          root, when initial propagation assigns every cell) is returned as its own leaf,
+         *          matching enumerateSolutionsLex(), which yields that matrix directly.
+         * @param node Node to expand (must not be a leaf).
+         * @return Feasible children, earliest first; empty if the node is a dead end.
+         * @throws None
+         */
+        [[nodiscard]] std::vector<LexPrefix> expandLex(const LexPrefix &node);
+
+        /**
+         * @name countLex
+         * @brief Count the solutions in a node's subtree, stopping at a budget.
+         * @param node Node whose subtree to count.
+         * @param budget Stop once this many solutions have been counted.
+         * @return Number of solutions counted (at most budget).
+         * @throws None
+         */
+        [[nodiscard]] std::uint32_t countLex(const LexPrefix &node, std::uint32_t budget);
+
+        /**
+         * @name solutionAt
+         * @brief Materialize the matrix of a leaf node.
+         * @param node A leaf returned by expandLex().
+         * @return The solution, or nullopt if the path does not replay to a complete assignment.
+         * @throws None
+         */
+        [[nodiscard]] std::optional<crsce::common::Csm> solutionAt(const LexPrefix &node);
+
     private:
+        /**
+         * @name prepareRoot
+         * @brief Run the initial propagation over every line once and record its forced cells.
+         * @return true if the root state is feasible.
+         * @throws None
+         */
+        [[nodiscard]] bool prepareRoot();
+
+        /**
+         * @name replay
+         * @brief Re-enter a node from the root by assigning its path at successive branch cells.
+         * @param path Branch values, root first.
+         * @return Undo point to return to the root, or nullopt (state unchanged) if the path is infeasible.
+         * @throws None
+         */
+        [[nodiscard]] std::optional<IBranchingController::UndoToken> replay(const std::vector<std::uint8_t> &path);
+
+        /**
+         * @name tryAssign
+         * @brief Assign one branch cell, propagate, and verify every row the assignment completes.
+         *
+         * Same step as one enumerateSolutionsLex() iteration, including CRC-32 row completion of
+         * the rows it touches but not the stall-time lookahead, so a replayed path always reaches
+         * the same node. The caller saves an undo point before calling and undoes to it
+         * afterwards, whether or not the step succeeded.
+         *
+         * @param r Row of the branch cell.
+         * @param c Column of the branch cell.
+         * @param v Value to assign (0 or 1).
+         * @return false if propagation is infeasible, a completed row fails its hash, or CRC-32
+         *         row completion finds a contradiction.
+         * @throws None
+         */
+        [[nodiscard]] bool tryAssign(std::uint16_t r, std::uint16_t c, std::uint8_t v);
+
+        /**
+         * @name countSubtree
+         * @brief Count the hash-verified solutions below the current state, up to a budget.
+         * @param budget Stop once this many solutions have been counted.
+         * @param deadline Wall-clock limit.
+         * @param timedOut Set to true if the deadline passed (the returned count is then partial).
+         * @return Number of solutions counted (at most budget).
+         * @throws None
+         */
+        [[nodiscard]] std::uint32_t countSubtree(std::uint32_t budget,
+                                                 std::chrono::steady_clock::time_point deadline,
+                                                 bool &timedOut);
+
+
         /**
          * @name dfs
          * @brief Iterative DFS traversal for solution enumeration using an explicit stack.
@@ -93,10 +202,22 @@ namespace crsce::decompress::solvers {
          */
         std::unique_ptr<IHashVerifier> hasher_;
 
+        /**
+         * @name pruner_
+         * @brief Order-preserving CRC-32 completion and probing over the components above.
+         */
+        std::unique_ptr<LexPruner> pruner_;
+
         /**
          * @name pipeline_
          * @brief Async hash verification pipeline (created per enumeration call).
          */
         std::unique_ptr<AsyncHashPipeline> pipeline_;
+
+        /**
+         * @name rootFeasible_
+         * @brief Result of prepareRoot(), once it has run.
+         */
+        std::optional<bool> rootFeasible_;
     };
 } // namespace crsce::decompress::solvers
@@ -0,0 +1,46 @@
+/**
+ * @file ForcedBlock.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Solver-free reconstruction of blocks that initial propagation fully determines.
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name solveForced
+     * @brief Build a block directly when propagating its cross-sums once assigns every cell.
+     *
+     * Builds the ConstraintStore the solver starts from (padding included) and runs the
+     * PropagationEngine once over every line. Saturated lines of any family fix their cells,
+     * and each forced cell can force others in turn, so this covers constant and striped
+     * blocks as well as sparse and near-empty ones. If no cell is left unassigned the block
+     * has exactly one solution, so it is only valid for DI 0.
+     *
+     * When every row sum, or every column sum, is 0 or kS the block follows from that family
+     * alone; that sufficient case (constant and striped blocks) is built first, without the
+     * ConstraintStore, which costs as much as the solver's own setup.
+     *
+     * The result is checked against the payload's lateral hashes and block hash; a block with
+     * cells left open, contradictory sums or any hash mismatch returns nullopt, and the caller
+     * falls back to the solver, which reports the error.
+     *
+     * @param payload View over the block's serialized payload.
+     * @param validBits Data bits in the block; the padding after them is assigned 0 first.
+     * @param layout Layout of the block, which locates the padding cells.
+     * @return The block, or nullopt if propagation leaves it open (or it fails the checks).
+     * @throws None
+     */
+    [[nodiscard]] std::optional<common::Csm> solveForced(const common::format::CompressedPayloadView &payload,
+                                                         std::uint32_t validBits = common::Csm::kS * common::Csm::kS,
+                                                         common::csmlayout::Layout layout =
+                                                             common::csmlayout::Layout::RowMajor);
+
+} // namespace crsce::decompress::solvers
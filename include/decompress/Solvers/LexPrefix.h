@@ -0,0 +1,37 @@
+/**
+ * @file LexPrefix.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief A node of the lex-order DFS tree, named by the branch values taken from the root.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @struct LexPrefix
+     * @brief Subtree of the enumerateSolutionsLex() search, addressed by its decision path.
+     * @details The DFS picks branch cells deterministically (BranchingController::nextCell), so the
+     *          sequence of values assigned at successive branch cells identifies a node, and any
+     *          EnumerationController over the same constraints can replay it into the same state.
+     *          Prefixes compare in enumeration order when their paths are compared in branchOrder().
+     */
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    struct LexPrefix {
+        /**
+         * @name path
+         * @brief Value assigned at each branch cell, root first.
+         */
+        std::vector<std::uint8_t> path;
+
+        /**
+         * @name leaf
+         * @brief True if the node is a complete, hash-verified assignment (exactly one solution).
+         */
+        bool leaf{false};
+    };
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+} // namespace crsce::decompress::solvers
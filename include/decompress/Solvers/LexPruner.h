@@ -0,0 +1,233 @@
+/**
+ * @file LexPruner.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Order-preserving pruning stack (CRC-32 row completion, failed-literal probing) for lex enumeration.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "decompress/Solvers/BranchingController.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/Crc32RowCompleter.h"
+#include "decompress/Solvers/FailedLiteralProber.h"
+#include "decompress/Solvers/IHashVerifier.h"
+#include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/PropagationEngine.h"
+#include "decompress/Solvers/StallDetector.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @class LexPruner
+     * @name LexPruner
+     * @brief RowDecomposedController's value-order-independent pruning, packaged for EnumerationController.
+     *
+     * EnumerationController branches at the row-major first unassigned cell and tries 0 before 1,
+     * so it visits solutions in lex order however many cells are forced on the way. Any forcing
+     * that is sound -- a forced cell has that value in every solution below the node -- therefore
+     * keeps the order, and with it the DI the compressor computed. Three such steps are used:
+     *   - CRC-32 row completion (B.59g) whenever a row drops to <= 32 unknowns;
+     *   - failed-literal probing to fixpoint at the root (B.42);
+     *   - a k-level lookahead on each branch value while the StallDetector reports a stall.
+     *
+     * prepareRoot() and extend() are functions of the store state alone, so replaying a LexPrefix
+     * reaches the same node every time. The lookahead depends on search history and is only used
+     * by the DFS loops (enumerateSolutionsLex, dfs, countSubtree), never by replay or expandLex.
+     * BeliefPropagator is not used: it only reorders branch values, and lex order fixes them.
+     *
+     * All cells assigned here are recorded on the shared BranchingController, so the caller's
+     * undo removes them with the branch that caused them.
+     */
+    class LexPruner {
+    public:
+        /**
+         * @name kS
+         * @brief Matrix dimension.
+         */
+        static constexpr std::uint16_t kS = 127;
+
+        /**
+         * @name LexPruner
+         * @brief Construct a pruner over an enumeration controller's components.
+         * @param store Constraint store (must outlive this pruner).
+         * @param brancher Branching controller holding the undo stack (must outlive this pruner).
+         * @param hasher Row hash verifier; CRC-32 completion runs only if it is a Sha1HashVerifier.
+         * @throws None
+         */
+        LexPruner(ConstraintStore &store, BranchingController &brancher, IHashVerifier &hasher);
+
+        /**
+         * @name prepareRoot
+         * @brief Complete every row CRC-32 can determine, then probe to fixpoint.
+         *
+         * Call once after the initial propagation, with its forced cells recorded. Expected
+         * row digests must already be set on the hasher.
+         *
+         * @return false if the root has no solution.
+         * @throws None
+         */
+        [[nodiscard]] bool prepareRoot();
+
+        /**
+         * @name extend
+         * @brief Apply CRC-32 row completion to the rows touched by one DFS step, cascading.
+         * @param r Row of the branch cell.
+         * @param forced Cells the step's propagation forced (read before any further propagation).
+         * @return false if a touched row has no completion or a completion leads to a contradiction.
+         * @throws None
+         */
+        [[nodiscard]] bool extend(std::uint16_t r, std::span<const Assignment> forced);
+
+        /**
+         * @name observeDepth
+         * @brief Feed the DFS depth after a successful step to the StallDetector.
+         * @param depth Current DFS stack depth.
+         * @return void
+         * @throws None
+         */
+        void observeDepth(std::uint64_t depth);
+
+        /**
+         * @name admits
+         * @brief Stall-time lookahead: is value v of (r, c) feasible k levels deep?
+         *
+         * Returns true without probing while the StallDetector's probe depth k is at most 1
+         * (depth 1 is the branch step itself). Otherwise runs FailedLiteralProber::probeAlternateDeep
+         * at depth k, which leaves the state unchanged. A false result is sound: v has no
+         * solution below it.
+         *
+         * @param r Row of the branch cell.
+         * @param c Column of the branch cell.
+         * @param v Value about to be tried.
+         * @return false if v is proven infeasible.
+         * @throws None
+         */
+        [[nodiscard]] bool admits(std::uint16_t r, std::uint16_t c, std::uint8_t v);
+
+        /**
+         * @name crcForcedCells
+         * @brief Cells assigned by CRC-32 row completion.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t crcForcedCells() const { return crcForcedCells_; }
+
+        /**
+         * @name crcPrunes
+         * @brief Subtrees cut because a row had no CRC-32-consistent completion.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t crcPrunes() const { return crcPrunes_; }
+
+        /**
+         * @name stallProbes
+         * @brief Lookahead probes run while stalled.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t stallProbes() const { return stallProbes_; }
+
+        /**
+         * @name stallPrunes
+         * @brief Branch values rejected by the stall-time lookahead.
+         * @return Counter value.
+         */
+        [[nodiscard]] std::uint64_t stallPrunes() const { return stallPrunes_; }
+
+    private:
+        /**
+         * @name completeRow
+         * @brief Complete one row via CRC-32 if it has 1..32 unknowns; queue the rows it touches.
+         * @param r Row index.
+         * @return false on contradiction.
+         * @throws None
+         */
+        [[nodiscard]] bool completeRow(std::uint16_t r);
+
+        /**
+         * @name drainRows
+         * @brief Run completeRow over rows_ until no queued row is left.
+         * @return false on contradiction.
+         * @throws None
+         */
+        [[nodiscard]] bool drainRows();
+
+        /**
+         * @name store_
+         * @brief Constraint store shared with the controller.
+         */
+        ConstraintStore &store_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+        /**
+         * @name brancher_
+         * @brief Branching controller shared with the controller (owns the undo stack).
+         */
+        BranchingController &brancher_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+        /**
+         * @name hasher_
+         * @brief Row hash verifier shared with the controller.
+         */
+        IHashVerifier &hasher_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+        /**
+         * @name propagator_
+         * @brief CPU propagation engine for completions and probes.
+         *
+         * Separate from the controller's engine (which may be Metal) so that the forced list
+         * the controller is iterating is never overwritten underneath it.
+         */
+        PropagationEngine propagator_;
+
+        /**
+         * @name completer_
+         * @brief CRC-32 row completer, built by prepareRoot() from the expected digests (null if not CRC-32).
+         */
+        std::unique_ptr<Crc32RowCompleter> completer_;
+
+        /**
+         * @name prober_
+         * @brief Failed-literal prober over propagator_.
+         */
+        FailedLiteralProber prober_;
+
+        /**
+         * @name detector_
+         * @brief Stall detector that sets the lookahead depth.
+         */
+        StallDetector detector_;
+
+        /**
+         * @name rows_
+         * @brief Worklist of rows to try completing (reused across calls).
+         */
+        std::vector<std::uint16_t> rows_;
+
+        /**
+         * @name crcForcedCells_
+         * @brief Cells assigned by CRC-32 row completion.
+         */
+        std::uint64_t crcForcedCells_{0};
+
+        /**
+         * @name crcPrunes_
+         * @brief Rows with no CRC-32-consistent completion.
+         */
+        std::uint64_t crcPrunes_{0};
+
+        /**
+         * @name stallProbes_
+         * @brief Lookahead probes run.
+         */
+        std::uint64_t stallProbes_{0};
+
+        /**
+         * @name stallPrunes_
+         * @brief Branch values rejected by lookahead.
+         */
+        std::uint64_t stallPrunes_{0};
+    };
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,51 @@
+/**
+ * @file LexRank.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Result of ranking a known solution within the lex-order enumeration.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @struct LexRank
+     * @brief Outcome of EnumerationController::rankLex.
+     */
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    struct LexRank {
+        /**
+         * @enum Outcome
+         * @brief How the ranking walk ended.
+         */
+        enum class Outcome : std::uint8_t {
+            Found,    ///< The target was reached; rank is its 0-based position.
+            Overflow, ///< More than `limit` solutions precede the target.
+            NotFound, ///< The target is not a solution of this constraint system.
+            TimedOut  ///< The deadline passed before the walk finished.
+        };
+
+        /**
+         * @name outcome
+         * @brief How the walk ended.
+         */
+        Outcome outcome{Outcome::NotFound};
+
+        /**
+         * @name rank
+         * @brief Solutions counted before the target (exact when outcome is Found).
+         */
+        std::uint32_t rank{0};
+
+        /**
+         * @name trail
+         * @brief The target's value at each branch cell on the walk, root first. Complete when
+         *        outcome is Found: replaying it from the root reaches the target (DecodeHint).
+         */
+        std::vector<std::uint8_t> trail;
+    };
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,64 @@
+/**
+ * @file LineMaskTable.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Per-line membership masks over the matrix, in the layout of ConstraintStore's known plane.
+ *
+ * Forcing a line (rho == 0 or rho == u) used to walk every cell of the line through a
+ * switch on the line type and probe each one with getCellState(), although most of them are
+ * usually assigned already. A LineMask is the line's 16,129-bit membership set, laid out like
+ * the known plane (two LSB-first words per row). ANDing it with the complement of the known
+ * plane leaves exactly the line's unknown cells, which are then visited with countr_zero, so
+ * forcing costs one AND per row word plus one step per cell actually forced.
+ *
+ * The masks are the inverse of cellLineTable(): each cell sets its bit in the mask of every
+ * line in its entry. The LTP lines depend on the run-time LTP configuration, so the table is
+ * built on first use.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "decompress/Solvers/CellLineTable.h"
+#include "decompress/Solvers/LtpTable.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @struct LineMask
+     * @name LineMask
+     * @brief One line's cells as a bitset over the matrix, plus the rows it spans.
+     */
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    struct alignas(64) LineMask {
+        /**
+         * @name words
+         * @brief Membership bits: column c of row r is bit c % 64 of words[r][c / 64] (LSB-first).
+         */
+        std::array<std::array<std::uint64_t, 2>, kLtpS> words{};
+
+        /**
+         * @name rowLo
+         * @brief First row holding a cell of the line.
+         */
+        std::uint8_t rowLo{0};
+
+        /**
+         * @name rowHi
+         * @brief Last row holding a cell of the line (rowLo > rowHi for an empty line).
+         */
+        std::uint8_t rowHi{0};
+    };
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+    /**
+     * @name lineMaskTable
+     * @brief The process-wide line-mask table, indexed by flat stat index in [0, kCellLineNone).
+     * @details The first call builds the table from cellLineTable() (thread-safe); later calls
+     *          only return the pointer. Hot paths fetch it once and keep it.
+     * @return Pointer to kCellLineNone masks.
+     * @throws None
+     */
+    [[nodiscard]] const LineMask *lineMaskTable();
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,93 @@
+/**
+ * @file ParallelLexSelector.h
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Parallel "k-th solution in lex order" search over independent enumeration controllers.
+ */
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "common/Csm/Csm.h"
+#include "decompress/Solvers/EnumerationController.h"
+#include "decompress/Solvers/LexPrefix.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @class ParallelLexSelector
+     * @name ParallelLexSelector
+     * @brief Finds the k-th solution enumerateSolutionsLex() would yield, using several threads.
+     *
+     * Each round splits the current subtree into a frontier of prefixes (expanding whole levels
+     * until there are a few per worker), counts the solutions under each prefix on worker threads
+     * (capped at k + 1, and skipping prefixes once an earlier run of counts already passes k),
+     * then moves into the one prefix that contains solution k and subtracts the solutions before
+     * it. The walk ends at a leaf. Frontier order is enumeration order, so the result is exactly
+     * the serial k-th solution. Every worker owns a controller over the same constraints.
+     */
+    class ParallelLexSelector {
+    public:
+        /**
+         * @name ControllerFactory
+         * @brief Builds a fresh EnumerationController over the block's constraints.
+         */
+        using ControllerFactory = std::function<std::unique_ptr<EnumerationController>()>;
+
+        /**
+         * @name ParallelLexSelector
+         * @brief Build one controller per worker.
+         * @param factory Controller factory (called `threads` times).
+         * @param threads Number of counting workers (clamped to at least 1).
+         * @throws None
+         */
+        ParallelLexSelector(const ControllerFactory &factory, std::uint32_t threads);
+
+        /**
+         * @name select
+         * @brief Return the k-th (0-based) solution in enumerateSolutionsLex() order.
+         * @param k Solution index (the block's DI).
+         * @return The solution, or nullopt if there are k or fewer solutions.
+         * @throws None
+         */
+        [[nodiscard]] std::optional<crsce::common::Csm> select(std::uint32_t k);
+
+    private:
+        /**
+         * @name kPrefixesPerWorker
+         * @brief Frontier size per worker before a round is counted (load balance for uneven subtrees).
+         */
+        static constexpr std::size_t kPrefixesPerWorker = 4;
+
+        /**
+         * @name split
+         * @brief Expand a node level by level until the frontier is wide enough or all leaves.
+         * @param node Subtree to split.
+         * @return Frontier in enumeration order (empty if the subtree has no solution).
+         * @throws None
+         */
+        [[nodiscard]] std::vector<LexPrefix> split(const LexPrefix &node);
+
+        /**
+         * @name countFrontier
+         * @brief Count each prefix's solutions (capped at budget) on the worker threads.
+         * @param frontier Prefixes in enumeration order.
+         * @param budget Cap per prefix; counting also stops for prefixes past the one where the
+         *               running total first reaches budget.
+         * @return Counts aligned with frontier (0 for skipped prefixes).
+         * @throws None
+         */
+        [[nodiscard]] std::vector<std::uint32_t> countFrontier(const std::vector<LexPrefix> &frontier,
+                                                               std::uint32_t budget);
+
+        /**
+         * @name workers_
+         * @brief One controller per worker; workers_[0] also does the splitting between rounds.
+         */
+        std::vector<std::unique_ptr<EnumerationController>> workers_;
+    };
+
+} // namespace crsce::decompress::solvers
@@ -23,7 +23,8 @@ namespace crsce::decompress::solvers {
      *
      * When rho(L) = 0, all unknowns on L are forced to 0.
      * When rho(L) = u(L), all unknowns on L are forced to 1.
-     * Propagation cascades: each forced assignment may affect other lines.
+     * Propagation cascades: each forced assignment may affect other lines. Only the lines
+     * the store flags as forcing or in conflict (ConstraintStore line events) are revisited.
      */
     class PropagationEngine final : public IPropagationEngine {
     public:
@@ -109,6 +110,14 @@ namespace crsce::decompress::solvers {
          */
         std::uint8_t dirtyCount_{0};
 
+        /**
+         * @name dirtyListed_
+         * @brief Per-word flag: word is already in dirtyWords_. A word emptied by clearQueued()
+         *        stays listed, so re-marking it must not append it again (which would overrun
+         *        dirtyWords_ and leave stale queued bits behind for the next propagate()).
+         */
+        std::array<bool, kQueuedWords> dirtyListed_{};
+
         /**
          * @name markQueued
          * @brief Set a bit in the queued bitset, tracking the dirty word.
@@ -120,7 +129,8 @@ namespace crsce::decompress::solvers {
             const auto bit = idx % 64;
             const auto mask = std::uint64_t{1} << bit;
             if ((queued_[word] & mask) == 0) {
-                if (queued_[word] == 0) {
+                if (!dirtyListed_[word]) {
+                    dirtyListed_[word] = true;
                     dirtyWords_[dirtyCount_++] = static_cast<std::uint8_t>(word);
                 }
                 queued_[word] |= mask;
@@ -153,6 +163,7 @@ namespace crsce::decompress::solvers {
         void resetQueued() {
             for (std::uint8_t i = 0; i < dirtyCount_; ++i) {
                 queued_[dirtyWords_[i]] = 0;
+                dirtyListed_[dirtyWords_[i]] = false;
             }
             dirtyCount_ = 0;
         }
@@ -5,6 +5,7 @@
  */
 #include "compress/Cli/run.h"
 
+#include <cstdint>
 #include <iostream>
 #include <exception>
 #include <string>
@@ -17,11 +18,12 @@ namespace crsce::compress::cli {
      * @brief Run the compression CLI pipeline.
      * @param input input filename (source)
      * @param output output filename (target)
+     * @param threads number of blocks compressed concurrently (1 = serial)
      * @return Process exit code: 0 on success; non-zero on failure.
      */
-    int run(const std::string &input, const std::string &output) { // NOLINT(misc-use-internal-linkage)
+    int run(const std::string &input, const std::string &output, const std::uint32_t threads) { // NOLINT(misc-use-internal-linkage)
         try {
-            const Compressor compressor;
+            const Compressor compressor(threads);
             compressor.compress(input, output);
             return 0;
         } catch (const std::exception &e) {
@@ -5,24 +5,31 @@
  */
 #include "compress/Compressor/Compressor.h"
 
-#include <algorithm>
-#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <ios>
+#include <iostream>
+#include <optional>
+#include <ostream>
 #include <string>
+#include <system_error>
 #include <vector>
 
-#include "common/Util/crc32_ieee.h"
-#include "decompress/Solvers/LtpTable.h"
+#include "common/FileBitSerializer/FileBitSerializer.h"
+#include "common/Util/BlockCache.h"
+#include "common/Util/is_stdio_path.h"
+#include "common/Util/OrderedPipeline.h"
 
+#include "common/exceptions/CompressDINotFound.h"
+#include "common/exceptions/CompressDIOverflow.h"
 #include "common/exceptions/CompressInputOpenError.h"
 #include "common/exceptions/CompressInputReadError.h"
 #include "common/exceptions/CompressOutputOpenError.h"
 #include "common/exceptions/CompressOutputWriteError.h"
-#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/exceptions/CompressTimeoutException.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
 #include "common/Format/CompressedPayload/FileHeader.h"
 #include "common/O11y/O11y.h"
 
@@ -31,166 +38,199 @@ namespace crsce::compress {
     /**
      * @name compress
      * @brief Compress an input file and write the CRSCE output.
-     * @param inputPath Path to the input file.
-     * @param outputPath Path to the output CRSCE file.
+     * @details Either path may be "-" for stdin/stdout. A pipe's length is unknown until EOF, so
+     *          stdin input writes a streamed header (FileHeader::kStreamed) and marks the last
+     *          block's frame with BlockFrame::kFlagFinal and its valid bit count. A block whose
+     *          DI discovery times out, overflows, or fails is written as a stored block
+     *          (BlockFrame::kFlagStored, raw bits), so every block costs at most
+     *          MAX_COMPRESSION_TIME and the file as a whole never fails on one hard block.
+     *          Blocks whose bytes repeat an earlier block reuse its payload from an in-process
+     *          cache (CRSCE_DEDUP_BLOCKS entries; 0 disables it). With CRSCE_DECODE_HINTS, a
+     *          block carrying a search trail is framed with BlockFrame::kFlagHint. Each compressed
+     *          block's frame also names its layout transform (BlockFrame::layout()).
+     * @param inputPath Path to the input file, or "-" for stdin.
+     * @param outputPath Path to the output CRSCE file, or "-" for stdout.
      * @return void
      * @throws CompressInputOpenError if the input file cannot be opened.
      * @throws CompressInputReadError if the input file cannot be read.
      * @throws CompressOutputOpenError if the output file cannot be opened.
      * @throws CompressOutputWriteError if the output file write fails.
-     * @throws CompressDIOverflow if the DI exceeds 255 for any block.
-     * @throws CompressTimeoutException if the compression time limit is exceeded.
-     * @throws CompressDINotFound if enumeration exhausts without finding the original CSM.
      */
     void Compressor::compress(const std::string &inputPath, const std::string &outputPath) const {
-        // Read the entire input file into a byte vector.
-        std::ifstream in(inputPath, std::ios::binary | std::ios::ate);
-        if (!in.is_open()) {
+        const bool fromStdin = common::util::is_stdio_path(inputPath);
+        const bool toStdout = common::util::is_stdio_path(outputPath);
+
+        // Stream the input: only the file size is needed up front (for the header);
+        // block bits are pulled one block at a time, so peak memory is
+        // O(blocks in flight) rather than O(file).
+        std::optional<common::FileBitSerializer> reader;
+        if (fromStdin) {
+            reader.emplace(std::cin);
+        } else {
+            reader.emplace(inputPath);
+        }
+        if (!reader->good()) {
             throw common::exceptions::CompressInputOpenError("compress: cannot open input file: " + inputPath);
         }
-        const auto fileSize = static_cast<std::size_t>(in.tellg());
-        in.seekg(0, std::ios::beg);
 
-        std::vector<std::uint8_t> data(fileSize);
-        if (fileSize > 0) {
-            if (!in.read(reinterpret_cast<char *>(data.data()), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                         static_cast<std::streamsize>(fileSize))) {
+        // Compute the number of blocks: ceil(fileSizeBits / kBlockBits). Unknown for a pipe.
+        common::format::FileHeader header;
+        if (fromStdin) {
+            header.originalFileSizeBytes = common::format::FileHeader::kStreamed;
+            header.blockCount = common::format::FileHeader::kStreamed;
+        } else {
+            std::error_code sizeErr;
+            const auto fileSize = static_cast<std::uint64_t>(std::filesystem::file_size(inputPath, sizeErr));
+            if (sizeErr) {
                 throw common::exceptions::CompressInputReadError("compress: failed to read input file: " + inputPath);
             }
+            const std::uint64_t fileSizeBits = fileSize * 8;
+            header.originalFileSizeBytes = fileSize;
+            header.blockCount = (fileSizeBits == 0) ? 0 : (fileSizeBits + kBlockBits - 1) / kBlockBits;
         }
-        in.close();
-
-        // Compute the number of blocks: ceil(fileSizeBits / kBlockBits).
-        const std::uint64_t fileSizeBits = static_cast<std::uint64_t>(fileSize) * 8;
-        const std::uint64_t blockCount = (fileSizeBits == 0) ? 0 : (fileSizeBits + kBlockBits - 1) / kBlockBits;
-
-        // Open the output file.
-        std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
-        if (!out.is_open()) {
-            throw common::exceptions::CompressOutputOpenError("compress: cannot open output file: " + outputPath);
+        const std::uint64_t blockCount = header.blockCount;
+        const std::uint64_t fileSizeBits = header.originalFileSizeBytes * 8;
+
+        // Open the output file (or adopt stdout).
+        std::ofstream file;
+        if (!toStdout) {
+            file.open(outputPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                throw common::exceptions::CompressOutputOpenError("compress: cannot open output file: " + outputPath);
+            }
         }
+        std::ostream &out = toStdout ? std::cout : file;
 
         // Write the file header.
-        common::format::FileHeader header;
-        header.originalFileSizeBytes = fileSize;
-        header.blockCount = blockCount;
         const auto headerBytes = header.serialize();
         out.write(reinterpret_cast<const char *>(headerBytes.data()), // NOLINT
                   static_cast<std::streamsize>(headerBytes.size()));
 
         ::crsce::o11y::O11y::instance().event("compress_blocks",
-            {{"total", std::to_string(blockCount)}, {"file_bytes", std::to_string(fileSize)}});
-
-        // Process each block.
-        for (std::uint64_t b = 0; b < blockCount; ++b) {
-            ::crsce::o11y::O11y::instance().event("compress_block_start",
-                {{"block_id", std::to_string(b)}, {"block_count", std::to_string(blockCount)}});
-            // Determine the bit range for this block.
-            const std::uint64_t startBit = b * kBlockBits;
-            const std::uint64_t remainingBits = fileSizeBits - startBit;
-            const auto blockBitCount = static_cast<std::size_t>(
-                remainingBits < kBlockBits ? remainingBits : kBlockBits);
-
-            // Compute the byte range covering the needed bits.
-            // Extract bits from the source buffer, handling non-byte-aligned block starts.
-            // kBlockBits = 511*511 = 261121, and 261121 mod 8 = 1, so blocks after the
-            // first are NOT byte-aligned. We extract bits individually.
-            const auto neededBytes = (blockBitCount + 7) / 8;
-            std::vector<std::uint8_t> blockData(neededBytes, 0);
-
-            for (std::size_t i = 0; i < blockBitCount; ++i) {
-                const std::size_t srcBitPos = static_cast<std::size_t>(startBit) + i;
-                const std::size_t srcByteIdx = srcBitPos / 8;
-                const std::uint8_t srcBitInByte = 7 - static_cast<std::uint8_t>(srcBitPos % 8);
-
-                const std::size_t dstByteIdx = i / 8;
-                const std::uint8_t dstBitInByte = 7 - static_cast<std::uint8_t>(i % 8);
-
-                if (srcByteIdx < data.size()) {
-                    const std::uint8_t bit = (data[srcByteIdx] >> srcBitInByte) & 1;
-                    blockData[dstByteIdx] |= static_cast<std::uint8_t>(bit << dstBitInByte);
-                }
-            }
-
-            // Load the CSM from the block data.
-            auto csm = loadCsm(blockData.data(), blockBitCount);
-
-            // Create the compressed payload and fill it.
-            common::format::CompressedPayload payload;
-            computeCrossSums(csm, payload);
-            computeLH(csm, payload);
-            computeBH(csm, payload);
-
-            // B.44d: write sub-block CRC-32 sidecar for this block's CSM
-            {
-                const char *b44dPath = std::getenv("CRSCE_B44D_SUBBLOCK"); // NOLINT(concurrency-mt-unsafe)
-                if (b44dPath != nullptr && b44dPath[0] != '\0') { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    constexpr std::uint16_t bSize = 64;
-                    constexpr std::uint8_t  bPerRow = 8;
-                    std::ofstream sf(b44dPath, std::ios::binary | std::ios::trunc); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    if (sf.is_open()) {
-                        sf.write("B44D", 4);
-                        const auto dim = static_cast<std::uint16_t>(kS);
-                        sf.write(reinterpret_cast<const char *>(&dim), 2); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                        sf.write(reinterpret_cast<const char *>(&bPerRow), 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                        sf.write(reinterpret_cast<const char *>(&bSize), 2); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                        // Note: header is 4+2+1+2 = 9 bytes (slightly different from Python's 8)
-                        // Fix: use uint8 for bSize to match Python format
+            {{"total", fromStdin ? std::string("streamed") : std::to_string(blockCount)},
+             {"file_bytes", fromStdin ? std::string("streamed") : std::to_string(header.originalFileSizeBytes)}});
+
+        /**
+         * @struct BlockInput
+         * @brief Bits of one block as read, plus whether it closes a streamed input.
+         */
+        struct BlockInput {
+            std::vector<std::uint8_t> bits;
+            std::size_t bitCount{0};
+            bool final{false};
+        };
+        bool inputDone = false;
+        std::uint64_t streamedBits = 0;
+
+        /**
+         * @struct CachedBlock
+         * @brief A block's serialized payload and its payload flags (kFlagStored, or kFlagHint and layout).
+         */
+        struct CachedBlock {
+            std::vector<std::uint8_t> payload;
+            std::uint16_t flags{0};
+        };
+        common::util::BlockCache<CachedBlock> cache(common::util::BlockCache<CachedBlock>::capacityFromEnv());
+
+        // Blocks are read sequentially from the stream, compressed on a worker pool,
+        // and written in block order with at most 2 * threads_ blocks in flight.
+        common::util::runOrderedStream<BlockInput, std::vector<std::uint8_t>>(
+            threads_, 2ULL * threads_,
+            [&](const std::uint64_t b) -> std::optional<BlockInput> {
+                BlockInput block;
+                if (!fromStdin) {
+                    if (b >= blockCount) {
+                        return std::nullopt;
                     }
-                    // Rewrite with correct format matching Python tool
-                    sf.close();
-                    sf.open(b44dPath, std::ios::binary | std::ios::trunc); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    if (sf.is_open()) {
-                        sf.write("B44D", 4);
-                        const auto dim = static_cast<std::uint16_t>(kS);
-                        sf.write(reinterpret_cast<const char *>(&dim), 2); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                        const auto bpr = static_cast<std::uint8_t>(bPerRow);
-                        sf.write(reinterpret_cast<const char *>(&bpr), 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                        const auto bs = static_cast<std::uint8_t>(bSize);
-                        sf.write(reinterpret_cast<const char *>(&bs), 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                        for (std::uint16_t r = 0; r < kS; ++r) {
-                            const auto row = csm.getRow(r);
-                            for (std::uint8_t blk = 0; blk < bPerRow; ++blk) {
-                                const auto cStart = static_cast<std::uint16_t>(blk * bSize);
-                                const auto cEnd = std::min(static_cast<std::uint16_t>(cStart + bSize), kS);
-                                // Pack block bits MSB-first
-                                std::array<std::uint8_t, 8> blockBytes{};
-                                for (auto c = cStart; c < cEnd; ++c) {
-                                    const auto word = c / 64U;
-                                    const auto bit = 63U - (c % 64U);
-                                    if ((row[word] >> bit) & 1U) { // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-                                        const auto bitIdx = static_cast<std::uint16_t>(c - cStart);
-                                        const auto byteIdx = bitIdx / 8U;
-                                        const auto bitPos = 7U - (bitIdx % 8U);
-                                        blockBytes[byteIdx] |= (1U << bitPos); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-                                    }
-                                }
-                                const auto numBytes = static_cast<std::size_t>((cEnd - cStart) + 7) / 8;
-                                const auto crc = common::util::crc32_ieee(blockBytes.data(), numBytes);
-                                sf.write(reinterpret_cast<const char *>(&crc), 4); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                            }
-                        }
+                    // Determine the bit range for this block and pull exactly that many bits.
+                    const std::uint64_t remainingBits = fileSizeBits - (b * kBlockBits);
+                    block.bitCount = static_cast<std::size_t>(
+                        remainingBits < kBlockBits ? remainingBits : kBlockBits);
+                    if (reader->popBits(block.bits, block.bitCount) != block.bitCount) {
+                        throw common::exceptions::CompressInputReadError(
+                            "compress: input file truncated while reading: " + inputPath);
                     }
+                    return block;
                 }
-            }
-
-            // B.57: B.46 rLTP sidecar removed (only 2 uniform LTP sub-tables).
-
-            // Discover the disambiguation index (or skip if disabled).
-            const std::uint8_t di = disableDI_ ? std::uint8_t{0}
-                                                : discoverDI(csm, payload, maxTimeSeconds_);
-            payload.setDI(di);
-            ::crsce::o11y::O11y::instance().event("compress_block_done",
-                {{"block_id", std::to_string(b)}, {"block_count", std::to_string(blockCount)},
-                 {"di", std::to_string(di)}});
+                // Pipe: a short block, or a full one followed by EOF, is the last. An empty
+                // input still yields one final block (0 bits) so the reader can find the end.
+                if (inputDone) {
+                    return std::nullopt;
+                }
+                block.bitCount = reader->popBits(block.bits, kBlockBits);
+                block.final = block.bitCount < kBlockBits || !reader->has_next();
+                inputDone = block.final;
+                streamedBits += block.bitCount;
+                return block;
+            },
+            [&](const std::uint64_t b, BlockInput &&block) {
+                // v2 container: each payload is preceded by its BlockFrame (id + CRC-32).
+                common::format::BlockFrame frame;
+                frame.blockId = b;
+                if (block.final) {
+                    frame.flags = common::format::BlockFrame::kFlagFinal;
+                    frame.finalBits = static_cast<std::uint16_t>(block.bitCount);
+                }
+                // A full block seen earlier in this run reuses its payload: one SHA-256 and a
+                // lookup. A short final block stays out of the cache: read from a pipe, its
+                // zero-padded bytes can equal a full block's, but its payload and kFlagPadded
+                // only decode with its own bitCount.
+                std::optional<common::util::BlockCache<CachedBlock>::Key> key;
+                if (block.bitCount == kBlockBits) {
+                    key = common::util::BlockCache<CachedBlock>::keyOf(block.bits.data(), block.bits.size());
+                }
+                if (const auto hit = key ? cache.find(*key) : std::nullopt) {
+                    ::crsce::o11y::O11y::instance().event("compress_block_dedup", {{"block_id", std::to_string(b)}});
+                    frame.flags |= hit->flags;
+                    return frame.serialize(hit->payload);
+                }
+                // Fallback: a block with no usable DI is stored raw rather than aborting the file.
+                CachedBlock result;
+                auto store = [&](const char *reason) {
+                    ::crsce::o11y::O11y::instance().event("compress_block_stored",
+                        {{"block_id", std::to_string(b)}, {"reason", reason}});
+                    result = {storeBlock(block.bits, block.bitCount), common::format::BlockFrame::kFlagStored};
+                };
+                try {
+                    result.payload = compressBlock(block.bits, block.bitCount, b, fromStdin ? 0 : blockCount,
+                                                   result.flags);
+                } catch (const common::exceptions::CompressTimeoutException &e) {
+                    store(e.what());
+                } catch (const common::exceptions::CompressDIOverflow &e) {
+                    store(e.what());
+                } catch (const common::exceptions::CompressDINotFound &e) {
+                    store(e.what());
+                }
+                frame.flags |= result.flags;
+                auto framed = frame.serialize(result.payload);
+                if (key) {
+                    cache.insert(*key, std::move(result));
+                }
+                return framed;
+            },
+            [&](const std::uint64_t /*b*/, const std::vector<std::uint8_t> &blockBytes) {
+                out.write(reinterpret_cast<const char *>(blockBytes.data()), // NOLINT
+                          static_cast<std::streamsize>(blockBytes.size()));
+                if (!out.good()) {
+                    throw common::exceptions::CompressOutputWriteError("compress: error writing output file: " + outputPath);
+                }
+            });
 
-            // Serialize and write the block.
-            const auto blockBytes = payload.serializeBlock();
-            out.write(reinterpret_cast<const char *>(blockBytes.data()), // NOLINT
-                      static_cast<std::streamsize>(blockBytes.size()));
+        if (cache.enabled()) {
+            ::crsce::o11y::O11y::instance().metric("compress_dedup", {
+                {"hits",    cache.hits(),   ::crsce::o11y::O11y::MetricKind::Counter},
+                {"misses",  cache.misses(), ::crsce::o11y::O11y::MetricKind::Counter},
+                {"entries", cache.size(),   ::crsce::o11y::O11y::MetricKind::Gauge}});
+        }
+        if (fromStdin) {
+            ::crsce::o11y::O11y::instance().event("compress_streamed",
+                {{"file_bytes", std::to_string(streamedBits / 8)}});
+        }
+        if (toStdout) {
+            out.flush();
+        } else {
+            file.close();
         }
-
-        out.close();
         if (!out.good()) {
             throw common::exceptions::CompressOutputWriteError("compress: error writing output file: " + outputPath);
         }
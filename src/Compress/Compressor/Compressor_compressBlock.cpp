@@ -0,0 +1,174 @@
+/**
+ * @file Compressor_compressBlock.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Compressor::compressBlock -- per-block compression pipeline.
+ */
+#include "compress/Compressor/Compressor.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <ios>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/Csm/CsmLayout.h"
+#include "common/Util/crc32_ieee.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
+#include "common/O11y/O11y.h"
+
+namespace crsce::compress {
+
+    /**
+     * @name compressBlock
+     * @brief Run the full per-block pipeline (loadCsm through discoverDI) and serialize the payload.
+     * @details Safe to call concurrently from multiple threads: every call builds its own CSM,
+     *          payload, and solver stack.
+     * @param blockData Byte-aligned, zero-padded block bits (MSB-first).
+     * @param blockBitCount Number of valid bits in blockData.
+     * @param blockIndex Zero-based index of the block (for observability).
+     * @param blockCount Total number of blocks in the file (for observability).
+     * @param frameFlags Receives the BlockFrame flags the payload needs (kFlagHint, layout).
+     * @return The serialized block payload (CompressedPayload::kBlockPayloadBytes bytes), followed
+     *         by its DecodeHint section when decode hints are enabled and the trail fits.
+     * @throws CompressDIOverflow if the DI exceeds 255.
+     * @throws CompressTimeoutException if the compression time limit is exceeded.
+     * @throws CompressDINotFound if enumeration exhausts without finding the original CSM.
+     */
+    std::vector<std::uint8_t> Compressor::compressBlock(const std::vector<std::uint8_t> &blockData,
+                                                        const std::size_t blockBitCount,
+                                                        const std::uint64_t blockIndex,
+                                                        const std::uint64_t blockCount,
+                                                        std::uint16_t &frameFlags) const {
+        ::crsce::o11y::O11y::instance().event("compress_block_start",
+            {{"block_id", std::to_string(blockIndex)}, {"block_count", std::to_string(blockCount)}});
+
+        // Load the CSM from the block data.
+        auto csm = loadCsm(blockData.data(), blockBitCount);
+
+        // Create the compressed payload and fill it. A short (final) block's padding is known to
+        // be zero; the solver pre-assigns it here and, via kFlagPadded, in the decoder.
+        const auto validBits = static_cast<std::uint32_t>(blockBitCount);
+        common::format::CompressedPayload payload;
+        computeCrossSums(csm, payload);
+
+        // Lay the bits out the way that leaves the decoder the least to search: the layout
+        // whose cross-sums force the most cells (ties keep the earlier layout). DI=0 without
+        // discovery is only trusted for the layout the caller chose, so it stays row-major.
+        auto layout = common::csmlayout::Layout::RowMajor;
+        if (layouts_ && !disableDI_) {
+            const auto natural = csm;
+            auto best = forcedCells(payload, validBits, layout);
+            const auto rowMajorForced = best;
+            for (std::uint8_t l = 1; l < common::csmlayout::kLayoutCount; ++l) {
+                const auto candidate = static_cast<common::csmlayout::Layout>(l);
+                auto laid = common::csmlayout::apply(natural, candidate);
+                common::format::CompressedPayload laidPayload;
+                computeCrossSums(laid, laidPayload);
+                if (const auto forced = forcedCells(laidPayload, validBits, candidate); forced > best) {
+                    best = forced;
+                    layout = candidate;
+                    csm = std::move(laid);
+                    payload = laidPayload;
+                }
+            }
+            ::crsce::o11y::O11y::instance().event("compress_block_layout",
+                {{"block_id", std::to_string(blockIndex)}, {"layout", common::csmlayout::name(layout)},
+                 {"forced_cells", std::to_string(best)}, {"row_major_forced_cells", std::to_string(rowMajorForced)}});
+        }
+        frameFlags = common::format::BlockFrame::layoutFlags(static_cast<std::uint8_t>(layout));
+        if (validBits < kBlockBits) {
+            frameFlags |= common::format::BlockFrame::kFlagPadded;
+        }
+        computeLH(csm, payload);
+        computeBH(csm, payload);
+
+        // B.44d: write sub-block CRC-32 sidecar for this block's CSM.
+        // The sidecar is a single-block experiment file; serialize writers so
+        // concurrent blocks cannot interleave their bytes.
+        {
+            const char *b44dPath = std::getenv("CRSCE_B44D_SUBBLOCK"); // NOLINT(concurrency-mt-unsafe)
+            if (b44dPath != nullptr && b44dPath[0] != '\0') { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                static std::mutex b44dMtx; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+                const std::scoped_lock b44dLock(b44dMtx);
+                constexpr std::uint16_t bSize = 64;
+                constexpr std::uint8_t  bPerRow = 8;
+                std::ofstream sf(b44dPath, std::ios::binary | std::ios::trunc); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if (sf.is_open()) {
+                    sf.write("B44D", 4);
+                    const auto dim = static_cast<std::uint16_t>(kS);
+                    sf.write(reinterpret_cast<const char *>(&dim), 2); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    sf.write(reinterpret_cast<const char *>(&bPerRow), 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    sf.write(reinterpret_cast<const char *>(&bSize), 2); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    // Note: header is 4+2+1+2 = 9 bytes (slightly different from Python's 8)
+                    // Fix: use uint8 for bSize to match Python format
+                }
+                // Rewrite with correct format matching Python tool
+                sf.close();
+                sf.open(b44dPath, std::ios::binary | std::ios::trunc); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if (sf.is_open()) {
+                    sf.write("B44D", 4);
+                    const auto dim = static_cast<std::uint16_t>(kS);
+                    sf.write(reinterpret_cast<const char *>(&dim), 2); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    const auto bpr = static_cast<std::uint8_t>(bPerRow);
+                    sf.write(reinterpret_cast<const char *>(&bpr), 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    const auto bs = static_cast<std::uint8_t>(bSize);
+                    sf.write(reinterpret_cast<const char *>(&bs), 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    for (std::uint16_t r = 0; r < kS; ++r) {
+                        const auto row = csm.getRow(r);
+                        for (std::uint8_t blk = 0; blk < bPerRow; ++blk) {
+                            const auto cStart = static_cast<std::uint16_t>(blk * bSize);
+                            const auto cEnd = std::min(static_cast<std::uint16_t>(cStart + bSize), kS);
+                            // Pack block bits MSB-first
+                            std::array<std::uint8_t, 8> blockBytes{};
+                            for (auto c = cStart; c < cEnd; ++c) {
+                                const auto word = c / 64U;
+                                const auto bit = 63U - (c % 64U);
+                                if ((row[word] >> bit) & 1U) { // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                                    const auto bitIdx = static_cast<std::uint16_t>(c - cStart);
+                                    const auto byteIdx = bitIdx / 8U;
+                                    const auto bitPos = 7U - (bitIdx % 8U);
+                                    blockBytes[byteIdx] |= (1U << bitPos); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                                }
+                            }
+                            const auto numBytes = static_cast<std::size_t>((cEnd - cStart) + 7) / 8;
+                            const auto crc = common::util::crc32_ieee(blockBytes.data(), numBytes);
+                            sf.write(reinterpret_cast<const char *>(&crc), 4); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                        }
+                    }
+                }
+            }
+        }
+
+        // B.57: B.46 rLTP sidecar removed (only 2 uniform LTP sub-tables).
+
+        // Discover the disambiguation index (or skip if disabled).
+        std::vector<std::uint8_t> trail;
+        const std::uint8_t di = disableDI_ ? std::uint8_t{0}
+                                            : discoverDI(csm, payload, maxTimeSeconds_, validBits, layout,
+                                                         decodeHints_ ? &trail : nullptr);
+        payload.setDI(di);
+        // An empty trail means propagation alone solves the block: there is nothing to skip.
+        const bool hinted = decodeHints_ && !disableDI_ && !trail.empty() &&
+                            trail.size() <= common::format::DecodeHint::kMaxTrailBits;
+        ::crsce::o11y::O11y::instance().event("compress_block_done",
+            {{"block_id", std::to_string(blockIndex)}, {"block_count", std::to_string(blockCount)},
+             {"di", std::to_string(di)}, {"hint_bits", hinted ? std::to_string(trail.size()) : "none"}});
+
+        auto bytes = payload.serializeBlock();
+        if (hinted) {
+            frameFlags |= common::format::BlockFrame::kFlagHint;
+            const auto hint = common::format::DecodeHint::serialize(trail);
+            bytes.insert(bytes.end(), hint.begin(), hint.end());
+        }
+        return bytes;
+    }
+
+} // namespace crsce::compress
@@ -13,7 +13,8 @@ namespace crsce::compress {
 
     /**
      * @name Compressor
-     * @brief Construct a Compressor, reading MAX_COMPRESSION_TIME and DISABLE_COMPRESS_DI from the environment.
+     * @brief Construct a Compressor, reading MAX_COMPRESSION_TIME, DISABLE_COMPRESS_DI,
+     *        CRSCE_DECODE_HINTS and CRSCE_LAYOUT_TRANSFORMS from the environment.
      * @details If the environment variable MAX_COMPRESSION_TIME is set and is a valid
      *          positive integer, it is used as the per-block time limit in seconds.
      *          Otherwise the default of 1,800 seconds (30 minutes) is used.
@@ -21,6 +22,12 @@ namespace crsce::compress {
      *          If the environment variable DISABLE_COMPRESS_DI is set to "1" or "true",
      *          the compressor skips DI discovery and writes DI=0 for every block.
      *          This allows debugging/testing compress functionality without running the solver.
+     *
+     *          If CRSCE_DECODE_HINTS is set to "1" or "true", each block whose DI is found
+     *          also carries its search trail (kFlagHint) so the decoder can skip the search.
+     *
+     *          If CRSCE_LAYOUT_TRANSFORMS is set to "0" or "false", every block keeps the
+     *          row-major layout instead of the layout that forces the most cells.
      * @throws None
      */
     Compressor::Compressor() {
@@ -40,6 +47,16 @@ namespace crsce::compress {
         if (diEnv != nullptr) {
             disableDI_ = (std::strcmp(diEnv, "1") == 0 || std::strcmp(diEnv, "true") == 0);
         }
+
+        const char *hintEnv = std::getenv("CRSCE_DECODE_HINTS"); // NOLINT(concurrency-mt-unsafe)
+        if (hintEnv != nullptr) {
+            decodeHints_ = (std::strcmp(hintEnv, "1") == 0 || std::strcmp(hintEnv, "true") == 0);
+        }
+
+        const char *layoutEnv = std::getenv("CRSCE_LAYOUT_TRANSFORMS"); // NOLINT(concurrency-mt-unsafe)
+        if (layoutEnv != nullptr) {
+            layouts_ = !(std::strcmp(layoutEnv, "0") == 0 || std::strcmp(layoutEnv, "false") == 0);
+        }
     }
 
 } // namespace crsce::compress
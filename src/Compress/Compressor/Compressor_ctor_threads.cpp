@@ -0,0 +1,24 @@
+/**
+ * @file Compressor_ctor_threads.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Compressor constructor overload selecting the block-parallel worker count.
+ */
+#include "compress/Compressor/Compressor.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace crsce::compress {
+
+    /**
+     * @name Compressor
+     * @brief Construct a Compressor that processes up to `threads` blocks concurrently.
+     * @details Environment configuration is read exactly as for the default constructor.
+     * @param threads Worker thread count; 0 or 1 selects the serial path.
+     * @throws None
+     */
+    Compressor::Compressor(const std::uint32_t threads) : Compressor() {
+        threads_ = std::max<std::uint32_t>(threads, 1U);
+    }
+
+} // namespace crsce::compress
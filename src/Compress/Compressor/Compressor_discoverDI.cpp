@@ -1,11 +1,10 @@
 /**
  * @file Compressor_discoverDI.cpp
  * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
- * @brief Compressor::discoverDI -- discover the disambiguation index via solver enumeration.
+ * @brief Compressor::discoverDI -- discover the disambiguation index by ranking the original CSM.
  */
 #include "compress/Compressor/Compressor.h"
 
-#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cstdint>
@@ -14,13 +13,16 @@
 #include <vector>
 
 #include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
 #include "common/exceptions/CompressDINotFound.h"
 #include "common/exceptions/CompressDIOverflow.h"
 #include "common/exceptions/CompressTimeoutException.h"
 #include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "decompress/Solvers/BlockPadding.h"
 #include "decompress/Solvers/BranchingController.h"
 #include "decompress/Solvers/ConstraintStore.h"
 #include "decompress/Solvers/EnumerationController.h"
+#include "decompress/Solvers/LexRank.h"
 #include "decompress/Solvers/PropagationEngine.h"
 #include "decompress/Solvers/Sha1HashVerifier.h"
 
@@ -28,10 +30,13 @@ namespace crsce::compress {
 
     /**
      * @name discoverDI
-     * @brief Discover the disambiguation index via solver enumeration.
-     * @param original The original CSM to match against enumerated solutions.
+     * @brief Discover the disambiguation index: the original CSM's rank in lex solution order.
+     * @param original The original CSM to rank among the enumerated solutions.
      * @param payload The CompressedPayload containing cross-sums and lateral hashes.
      * @param maxTimeSeconds Maximum wall-clock time in seconds for enumeration.
+     * @param validBits Data bits in the block; the padding after them is pre-assigned 0.
+     * @param layout Layout the original was laid out with (locates the padding cells).
+     * @param trail If non-null, receives the original's branch trail (DecodeHint).
      * @return The zero-based DI (0..255).
      * @throws CompressTimeoutException if the time limit is exceeded.
      * @throws CompressDIOverflow if the DI exceeds 255.
@@ -39,9 +44,13 @@ namespace crsce::compress {
      */
     std::uint8_t Compressor::discoverDI(const common::Csm &original,
                                          const common::format::CompressedPayload &payload,
-                                         const std::uint64_t maxTimeSeconds) {
+                                         const std::uint64_t maxTimeSeconds,
+                                         const std::uint32_t validBits,
+                                         const common::csmlayout::Layout layout,
+                                         std::vector<std::uint8_t> *trail) {
         // Build the four cross-sum vectors from the payload.
         static constexpr std::uint16_t kDiagCount = (2 * kS) - 1;
+        static constexpr std::uint32_t kMaxDI = 255;
 
         std::vector<std::uint16_t> rowSums(kS);
         std::vector<std::uint16_t> colSums(kS);
@@ -67,6 +76,8 @@ namespace crsce::compress {
         auto store = std::make_unique<decompress::solvers::ConstraintStore>(
             rowSums, colSums, diagSums, antiDiagSums,
             ltp1Sums, ltp2Sums, ltp3Sums, ltp4Sums, ltp5Sums, ltp6Sums);
+        // The decoder knows where the data ends, so rank among solutions with zero padding.
+        static_cast<void>(decompress::solvers::assignPadding(*store, validBits, layout));
         auto propagator = std::make_unique<decompress::solvers::PropagationEngine>(*store);
         auto brancher = std::make_unique<decompress::solvers::BranchingController>(*store, *propagator);
         auto hasher = std::make_unique<decompress::solvers::Sha1HashVerifier>(kS);
@@ -85,34 +96,24 @@ namespace crsce::compress {
         decompress::solvers::EnumerationController enumerator(
             std::move(store), std::move(propagator), std::move(brancher), std::move(hasher));
 
-        // Enumerate solutions using the coroutine-based generator and find the original CSM.
-        const auto startTime = std::chrono::steady_clock::now();
-        const auto deadline = startTime + std::chrono::seconds(maxTimeSeconds);
-
-        // Serialize the original CSM for comparison.
-        const auto originalVec = original.vec();
-
-        std::uint16_t diCounter = 0;
-
-        for (const auto &candidate : enumerator.enumerateSolutionsLex()) {
-            // Check timeout.
-            if (std::chrono::steady_clock::now() >= deadline) {
-                throw common::exceptions::CompressTimeoutException("compress: DI enumeration timed out");
-            }
-
-            // Compare the candidate CSM to the original.
-            const auto candidateVec = candidate.vec();
-            if (originalVec.size() == candidateVec.size() &&
-                std::equal(originalVec.begin(), originalVec.end(), candidateVec.begin())) {
-                return static_cast<std::uint8_t>(diCounter);
-            }
-
-            ++diCounter;
-            if (diCounter >= 256) {
+        // Rank the original among the lex-ordered solutions by descending along its own bits:
+        // only subtrees that precede it are counted, and counting stops past the largest DI.
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(maxTimeSeconds);
+        const auto rank = enumerator.rankLex(original, kMaxDI, deadline);
+
+        switch (rank.outcome) {
+            case decompress::solvers::LexRank::Outcome::Found:
+                if (trail != nullptr) {
+                    *trail = std::move(rank.trail);
+                }
+                return static_cast<std::uint8_t>(rank.rank);
+            case decompress::solvers::LexRank::Outcome::Overflow:
                 throw common::exceptions::CompressDIOverflow("compress: DI exceeds 255; block is not compressible");
-            }
+            case decompress::solvers::LexRank::Outcome::TimedOut:
+                throw common::exceptions::CompressTimeoutException("compress: DI enumeration timed out");
+            case decompress::solvers::LexRank::Outcome::NotFound:
+                break;
         }
-
         throw common::exceptions::CompressDINotFound("compress: original CSM not found in enumeration");
     }
 
@@ -0,0 +1,79 @@
+/**
+ * @file Compressor_forcedCells.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Compressor::forcedCells -- cells fixed by initial propagation of a payload's cross-sums.
+ */
+#include "compress/Compressor/Compressor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/Csm/CsmLayout.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "decompress/Solvers/BlockPadding.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/PropagationEngine.h"
+
+namespace crsce::compress {
+
+    /**
+     * @name forcedCells
+     * @brief Count the cells the decoder's initial propagation fixes from a payload's cross-sums.
+     * @details Builds the same ConstraintStore the solver starts from and propagates every line
+     *          once, as the lex enumeration does before its first branch. More forced cells leave
+     *          fewer to search, so this is the compressor's predictor of decode hardness.
+     * @param payload Payload with its cross-sums filled in (hashes are not needed).
+     * @param validBits Data bits in the block; the padding after them is pre-assigned 0.
+     * @param layout Layout the payload's block was laid out with.
+     * @return Number of cells known before any branching, padding included.
+     * @throws None
+     */
+    std::size_t Compressor::forcedCells(const common::format::CompressedPayload &payload,
+                                        const std::uint32_t validBits,
+                                        const common::csmlayout::Layout layout) {
+        using decompress::solvers::LineType;
+        static constexpr std::uint16_t kDiagCount = (2 * kS) - 1;
+
+        std::vector<std::uint16_t> rowSums(kS);
+        std::vector<std::uint16_t> colSums(kS);
+        std::vector<std::uint16_t> diagSums(kDiagCount);
+        std::vector<std::uint16_t> antiDiagSums(kDiagCount);
+        std::vector<std::uint16_t> ltp1Sums(kS);
+        std::vector<std::uint16_t> ltp2Sums(kS);
+        for (std::uint16_t k = 0; k < kS; ++k) {
+            rowSums[k] = payload.getLSM(k);
+            colSums[k] = payload.getVSM(k);
+            ltp1Sums[k] = payload.getLTP1SM(k);
+            ltp2Sums[k] = payload.getLTP2SM(k);
+        }
+        for (std::uint16_t k = 0; k < kDiagCount; ++k) {
+            diagSums[k] = payload.getDSM(k);
+            antiDiagSums[k] = payload.getXSM(k);
+        }
+        const std::vector<std::uint16_t> ltp3Sums, ltp4Sums, ltp5Sums, ltp6Sums;
+        decompress::solvers::ConstraintStore store(rowSums, colSums, diagSums, antiDiagSums,
+                                                   ltp1Sums, ltp2Sums, ltp3Sums, ltp4Sums, ltp5Sums, ltp6Sums);
+        const auto padding = decompress::solvers::assignPadding(store, validBits, layout);
+        decompress::solvers::PropagationEngine propagator(store);
+
+        std::vector<decompress::solvers::LineID> allLines;
+        allLines.reserve((4 * kS) + (2 * kDiagCount));
+        for (const auto type : {LineType::Row, LineType::Column, LineType::LTP1, LineType::LTP2}) {
+            for (std::uint16_t i = 0; i < kS; ++i) {
+                allLines.push_back({.type = type, .index = i});
+            }
+        }
+        for (const auto type : {LineType::Diagonal, LineType::AntiDiagonal}) {
+            for (std::uint16_t i = 0; i < kDiagCount; ++i) {
+                allLines.push_back({.type = type, .index = i});
+            }
+        }
+        if (!propagator.propagate(allLines)) {
+            return padding; // cannot happen for sums computed from a real block
+        }
+        return padding + propagator.getForcedAssignments().size();
+    }
+
+} // namespace crsce::compress
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "common/BitKernels/BitKernels.h"
 #include "common/Csm/Csm.h"
 
 namespace crsce::compress {
@@ -15,6 +16,7 @@ namespace crsce::compress {
     /**
      * @name loadCsm
      * @brief Load raw bytes into a CSM, row-major, MSB-first per byte.
+     * @details Uses the word-level bitkernels::unpackRows kernel (two 64-bit loads per row).
      * @param data Pointer to the raw byte data.
      * @param bitCount Number of valid bits to load (may be less than kBlockBits for the last block).
      * @return A populated Csm instance (unaddressed cells remain zero).
@@ -22,14 +24,7 @@ namespace crsce::compress {
      */
     common::Csm Compressor::loadCsm(const std::uint8_t *data, const std::size_t bitCount) {
         common::Csm csm;
-        for (std::size_t i = 0; i < bitCount; ++i) {
-            const std::size_t byteIdx = i / 8;
-            const auto bitInByte = static_cast<std::uint8_t>(7 - (i % 8));
-            const auto r = static_cast<std::uint16_t>(i / kS);
-            const auto c = static_cast<std::uint16_t>(i % kS);
-            const auto v = static_cast<std::uint8_t>((data[byteIdx] >> bitInByte) & 1); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            csm.set(r, c, v);
-        }
+        common::bitkernels::unpackRows(data, (bitCount + 7) / 8, 0, bitCount, csm);
         return csm;
     }
 
@@ -0,0 +1,36 @@
+/**
+ * @file Compressor_storeBlock.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Compressor::storeBlock -- raw-bits payload for a stored (kFlagStored) block.
+ */
+#include "compress/Compressor/Compressor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/BitKernels/BitKernels.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+
+namespace crsce::compress {
+
+    /**
+     * @name storeBlock
+     * @brief Build a stored-block payload: the block's raw bits, for a BlockFrame::kFlagStored frame.
+     * @details Goes through loadCsm so the stored bits are exactly the CSM a compressed block
+     *          would have encoded (bits at or beyond blockBitCount are zero), in the row-major
+     *          MSB-first layout the decompressor writes out.
+     * @param blockData Byte-aligned, zero-padded block bits (MSB-first).
+     * @param blockBitCount Number of valid bits in blockData.
+     * @return BlockFrame::kStoredPayloadBytes bytes.
+     * @throws None
+     */
+    std::vector<std::uint8_t> Compressor::storeBlock(const std::vector<std::uint8_t> &blockData,
+                                                     const std::size_t blockBitCount) {
+        const auto csm = loadCsm(blockData.data(), blockBitCount);
+        std::vector<std::uint8_t> payload(common::format::BlockFrame::kStoredPayloadBytes, 0);
+        common::bitkernels::packRows(csm, payload.data(), payload.size(), 0);
+        return payload;
+    }
+
+} // namespace crsce::compress
@@ -17,10 +17,15 @@
 #include <string>
 #include <vector>
 
+#include "common/Csm/CsmLayout.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
 #include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
 #include "common/Format/CompressedPayload/FileHeader.h"
 
+using crsce::common::format::BlockFrame;
 using crsce::common::format::CompressedPayload;
+using crsce::common::format::DecodeHint;
 using crsce::common::format::FileHeader;
 
 namespace crsce::viewer {
@@ -74,27 +79,89 @@ int run_viewer(const std::string &path, std::ostream &out, std::ostream &err) {
         return 1;
     }
 
-    // Print header
+    // Print header. A streamed header (compressed from a pipe) leaves both sizes to the final block.
+    const bool streamed = header.streamed();
     out << "=== CRSCE Header ===\n"
-        << "  original_file_size: " << header.originalFileSizeBytes << " bytes\n"
-        << "  block_count:        " << header.blockCount << '\n'
-        << '\n';
+        << "  version:            " << header.version << '\n';
+    if (streamed) {
+        out << "  original_file_size: streamed\n"
+            << "  block_count:        streamed\n";
+    } else {
+        out << "  original_file_size: " << header.originalFileSizeBytes << " bytes\n"
+            << "  block_count:        " << header.blockCount << '\n';
+    }
+    out << '\n';
 
     // Read and print each block
-    for (std::uint64_t b = 0; b < header.blockCount; ++b) {
-        std::vector<std::uint8_t> blockBuf(CompressedPayload::kBlockPayloadBytes);
-        is.read(reinterpret_cast<char *>(blockBuf.data()), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                static_cast<std::streamsize>(blockBuf.size()));
-        if (is.gcount() != static_cast<std::streamsize>(blockBuf.size())) {
+    bool finalSeen = false;
+    for (std::uint64_t b = 0; !finalSeen && (streamed || b < header.blockCount); ++b) {
+        // v2: the frame comes first; its flags give the payload size (stored blocks are larger).
+        const bool framed = header.version != FileHeader::kVersionV1;
+        std::vector<std::uint8_t> blockBuf(framed ? BlockFrame::kFrameBytes : header.blockStride());
+        auto readInto = [&](const std::size_t offset, const std::size_t count) {
+            is.read(reinterpret_cast<char *>(blockBuf.data() + offset), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    static_cast<std::streamsize>(count));
+            return is.gcount() == static_cast<std::streamsize>(count);
+        };
+        bool complete = readInto(0, blockBuf.size());
+        if (framed && complete) {
+            const auto flags = BlockFrame::peekFlags(blockBuf.data());
+            const auto fixed = BlockFrame::kFrameBytes + BlockFrame::payloadBytes(flags);
+            blockBuf.resize(fixed);
+            complete = readInto(BlockFrame::kFrameBytes, fixed - BlockFrame::kFrameBytes);
+            // A hinted block's trail length is in the fixed part; read the trail after it.
+            const auto hint = complete ? BlockFrame::hintBytes(flags, blockBuf.data() + BlockFrame::kFrameBytes) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                       : std::size_t{0};
+            if (hint > 0) {
+                blockBuf.resize(fixed + hint);
+                complete = readInto(fixed, hint);
+            }
+        }
+        if (!complete) {
             err << "error: short read on block " << b << '\n';
             return 1;
         }
 
+        // v2: validate and strip the block frame.
+        bool stored = false;
+        std::uint8_t layout = 0;
+        if (framed) {
+            BlockFrame frame;
+            try {
+                frame = BlockFrame::deserialize(blockBuf.data(), blockBuf.size(), b);
+            } catch (const std::exception &e) {
+                err << "error: " << e.what() << '\n';
+                return 1;
+            }
+            blockBuf.erase(blockBuf.begin(), blockBuf.begin() + BlockFrame::kFrameBytes);
+            finalSeen = streamed && frame.final();
+            if (finalSeen) {
+                out << "=== Final block " << b << ": " << frame.finalBits << " data bits ===\n";
+            }
+            stored = frame.stored();
+            layout = frame.layout();
+        }
+
+        if (stored) {
+            // Stored block: raw bits, no cross-sums or hashes to show.
+            out << "=== Block " << b << " ===\n"
+                << "  stored: " << blockBuf.size() << " raw bytes (DI discovery fallback)\n\n";
+            continue;
+        }
+
         CompressedPayload payload;
         payload.deserializeBlock(blockBuf.data(), blockBuf.size());
 
         out << "=== Block " << b << " ===\n";
         out << "  DI: " << static_cast<unsigned>(payload.getDI()) << '\n';
+        if (layout != 0) {
+            out << "  layout: " << crsce::common::csmlayout::name(static_cast<crsce::common::csmlayout::Layout>(layout)) << '\n';
+        }
+        if (blockBuf.size() > CompressedPayload::kBlockPayloadBytes) {
+            const auto trail = DecodeHint::deserialize(blockBuf.data() + CompressedPayload::kBlockPayloadBytes, // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                                       blockBuf.size() - CompressedPayload::kBlockPayloadBytes);
+            out << "  hint: " << (trail ? trail->size() : 0U) << " trail bits\n";
+        }
 
         // LSM (row sums)
         out << "  LSM[0.." << (CompressedPayload::kS - 1) << "]:";
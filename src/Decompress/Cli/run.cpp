@@ -5,6 +5,7 @@
  */
 #include "decompress/Cli/run.h"
 
+#include <cstdint>
 #include <iostream>
 #include <exception>
 #include <string>
@@ -17,11 +18,13 @@ namespace crsce::decompress::cli {
      * @brief Run the decompression CLI pipeline.
      * @param input input filename (source)
      * @param output output filename (target)
+     * @param threads number of blocks reconstructed concurrently (1 = serial)
+     * @param resume checkpoint to a sidecar journal and continue from it
      * @return Process exit code: 0 on success; non-zero on failure.
      */
-    int run(const std::string &input, const std::string &output) {
+    int run(const std::string &input, const std::string &output, const std::uint32_t threads, const bool resume) {
         try {
-            Decompressor decompressor;
+            Decompressor decompressor(threads, resume);
             decompressor.decompress(input, output);
             return 0;
         } catch (const std::exception &e) {
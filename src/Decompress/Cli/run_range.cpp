@@ -0,0 +1,38 @@
+/**
+ * @file run_range.cpp
+ * @brief Decompressor CLI runner for -range (partial restore).
+ * @copyright (c) 2026 Sam Caldwell.  See LICENSE.txt for details.
+ */
+#include "decompress/Cli/run.h"
+
+#include <cstdint>
+#include <iostream>
+#include <exception>
+#include <string>
+
+#include "decompress/Decompressor/Decompressor.h"
+
+namespace crsce::decompress::cli {
+    /**
+     * @name run
+     * @brief Run the decompression CLI pipeline for a byte range of the original file.
+     * @param input input filename (source)
+     * @param output output filename (target)
+     * @param threads number of blocks reconstructed concurrently (1 = serial)
+     * @param start offset of the first original byte to recover
+     * @param length number of bytes to recover
+     * @param resume checkpoint to a sidecar journal and continue from it
+     * @return Process exit code: 0 on success; non-zero on failure.
+     */
+    int run(const std::string &input, const std::string &output, const std::uint32_t threads,
+            const std::uint64_t start, const std::uint64_t length, const bool resume) {
+        try {
+            Decompressor decompressor(threads, resume);
+            decompressor.decompressRange(input, output, start, length);
+            return 0;
+        } catch (const std::exception &e) {
+            std::cerr << "decompress error: " << e.what() << '\n';
+            return 1;
+        }
+    }
+} // namespace crsce::decompress::cli
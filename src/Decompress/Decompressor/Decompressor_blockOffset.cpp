@@ -0,0 +1,44 @@
+/**
+ * @file Decompressor_blockOffset.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::blockOffset -- locate a block in a container that may hold stored or hinted blocks.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <cstdint>
+#include <istream>
+#include <string>
+
+#include "common/Format/CompressedPayload/FileHeader.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name blockOffset
+     * @brief File offset of block b.
+     * @details Without extra bytes every block is blockStride() bytes. Otherwise frame
+     *          headers are read from block 0 until blocks accounting for all `extra` bytes have
+     *          been passed (or b is reached); the blocks after the last long one are fixed-size again.
+     * @param in Seekable input stream; its position is undefined on return.
+     * @param header Deserialized (or resolved) file header.
+     * @param b Block index.
+     * @param extra Result of extraBytes().
+     * @param inputPath Input path, used in error messages.
+     * @return Offset of block b's frame (or payload, for v1).
+     * @throws DecompressInputReadError if a frame header cannot be read.
+     */
+    std::uint64_t Decompressor::blockOffset(std::istream &in, const common::format::FileHeader &header,
+                                            const std::uint64_t b, const std::uint64_t extra,
+                                            const std::string &inputPath) {
+        const std::uint64_t stride = header.blockStride();
+        std::uint64_t offset = common::format::FileHeader::kHeaderBytes;
+        std::uint64_t i = 0;
+        for (std::uint64_t seen = 0; i < b && seen < extra; ++i) {
+            const auto size = frameBytesAt(in, offset, peekFlagsAt(in, offset, inputPath), inputPath);
+            seen += size - stride;
+            offset += size;
+        }
+        return offset + ((b - i) * stride);
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,24 @@
+/**
+ * @file Decompressor_ctor_resume.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor constructor overload selecting worker count and resume mode.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <cstdint>
+
+namespace crsce::decompress {
+
+    /**
+     * @name Decompressor
+     * @brief Construct a Decompressor with a thread count and resume mode.
+     * @param threads Worker thread count; 0 or 1 selects the serial path.
+     * @param resume If true, checkpoint progress to a sidecar journal and resume from it.
+     * @throws None
+     */
+    Decompressor::Decompressor(const std::uint32_t threads, const bool resume)
+        : Decompressor(threads) {
+        resume_ = resume;
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,22 @@
+/**
+ * @file Decompressor_ctor_threads.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor constructor overload selecting the block-parallel worker count.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace crsce::decompress {
+
+    /**
+     * @name Decompressor
+     * @brief Construct a Decompressor that reconstructs up to `threads` blocks concurrently.
+     * @param threads Worker thread count; 0 or 1 selects the serial path.
+     * @throws None
+     */
+    Decompressor::Decompressor(const std::uint32_t threads)
+        : threads_(std::max<std::uint32_t>(threads, 1U)) {}
+
+} // namespace crsce::decompress
@@ -0,0 +1,474 @@
+/**
+ * @file Decompressor_decompressRange.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::decompressRange -- main decompression pipeline (whole file or byte range).
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "common/BitKernels/BitKernels.h"
+#include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
+#include "common/Util/BlockCache.h"
+#include "common/Util/is_stdio_path.h"
+#include "common/Util/OrderedPipeline.h"
+
+#include "common/exceptions/DecompressHeaderInvalid.h"
+#include "common/exceptions/DecompressInputOpenError.h"
+#include "common/exceptions/DecompressInputReadError.h"
+#include "common/exceptions/DecompressOutputOpenError.h"
+#include "common/exceptions/DecompressOutputWriteError.h"
+#include "common/exceptions/DecompressRangeInvalid.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
+#include "common/Format/CompressedPayload/FileHeader.h"
+#include "common/O11y/O11y.h"
+#include "decompress/Decompressor/ResumeJournal.h"
+#include "decompress/Decompressor/SolveCache.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name decompressRange
+     * @brief Decompress bytes [start, start + length) of the original file and write only those bytes.
+     * @param inputPath Path to the CRSCE compressed input file, or "-" to read stdin.
+     * @param outputPath Path to the output (decompressed) file, or "-" to write stdout.
+     * @param start Offset of the first original byte to recover.
+     * @param length Number of bytes to recover; clamped to the end of the original file.
+     * @return void
+     * @throws DecompressInputOpenError if the input file cannot be opened.
+     * @throws DecompressInputReadError if the input file cannot be read.
+     * @throws DecompressHeaderInvalid if the header is invalid (too small, bad magic, CRC, or size mismatch).
+     * @throws DecompressOutputOpenError if the output file cannot be opened, or -resume is combined with "-".
+     * @throws DecompressOutputWriteError if the output file write fails.
+     * @throws DecompressRangeInvalid if start lies beyond the end of the original file.
+     * @throws DecompressBlockCorrupt if a v2 block frame fails its integrity check.
+     * @throws DecompressDIOutOfRange if a block cannot be reconstructed.
+     */
+    void Decompressor::decompressRange(const std::string &inputPath, const std::string &outputPath,
+                                       const std::uint64_t start, const std::uint64_t length) {
+        // "-" selects stdin/stdout. A pipe cannot seek, so stdin is read strictly in order:
+        // frames are checked as blocks arrive rather than in an up-front pass, and blocks
+        // ahead of the range are read and dropped instead of skipped.
+        const bool fromStdin = common::util::is_stdio_path(inputPath);
+        const bool toStdout = common::util::is_stdio_path(outputPath);
+        if (resume_ && (fromStdin || toStdout)) {
+            throw common::exceptions::DecompressOutputOpenError("decompress: -resume needs a file input and output");
+        }
+
+        // Open the input and determine its size; blocks are read one at a time, so memory
+        // stays flat regardless of size.
+        std::ifstream file;
+        std::size_t fileSize = 0;
+        std::uint64_t extra = 0;
+        if (!fromStdin) {
+            file.open(inputPath, std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                throw common::exceptions::DecompressInputOpenError("decompress: cannot open input file: " + inputPath);
+            }
+            fileSize = static_cast<std::size_t>(file.tellg());
+            file.seekg(0, std::ios::beg);
+
+            // Validate minimum size for the file header.
+            if (fileSize < common::format::FileHeader::kHeaderBytes) {
+                throw common::exceptions::DecompressHeaderInvalid("decompress: input file too small for header: " +
+                                                                  inputPath);
+            }
+        }
+        std::istream &in = fromStdin ? std::cin : file;
+
+        // Read and deserialize the file header (validates magic and CRC-32).
+        std::array<std::uint8_t, common::format::FileHeader::kHeaderBytes> headerBytes{};
+        if (!in.read(reinterpret_cast<char *>(headerBytes.data()), // NOLINT
+                     static_cast<std::streamsize>(headerBytes.size()))) {
+            if (fromStdin) {
+                throw common::exceptions::DecompressHeaderInvalid("decompress: input too small for header: " + inputPath);
+            }
+            throw common::exceptions::DecompressInputReadError("decompress: failed to read input file: " + inputPath);
+        }
+        auto header = common::format::FileHeader::deserialize(headerBytes.data(), headerBytes.size());
+
+        if (!fromStdin) {
+            // A streamed container's sizes follow from the file size and its final frame.
+            if (header.streamed()) {
+                header = resolveStreamedHeader(file, header, fileSize, inputPath);
+            }
+
+            // Validate file size matches header + blocks (v1: raw payloads; v2: framed payloads,
+            // stored and hinted blocks adding to the fixed layout). Without extra bytes, block b
+            // sits at kHeaderBytes + b * blockStride().
+            extra = extraBytes(header, fileSize);
+        }
+        // From stdin a streamed header's sizes stay unknown until the final frame arrives.
+        const bool sizeKnown = !header.streamed();
+
+        // Map the byte range onto the fixed block layout: block b holds original bits
+        // [b * kBlockBits, (b + 1) * kBlockBits), so only blocks [firstBlock, endBlock)
+        // are read and solved. An unknown size is capped where bit offsets stay in range.
+        std::uint64_t originalSize = header.originalFileSizeBytes;
+        const std::uint64_t sizeCap = sizeKnown ? originalSize : UINT64_MAX / 8;
+        if (start > sizeCap) {
+            throw common::exceptions::DecompressRangeInvalid(
+                "decompress: range start " + std::to_string(start) + " beyond original size " +
+                std::to_string(sizeCap));
+        }
+        // rangeEnd shrinks when a streamed final frame reveals the size; it is read by the
+        // in-order writer while the loader may be updating it.
+        std::atomic<std::uint64_t> rangeEnd{start + std::min(length, sizeCap - start)};
+        const std::uint64_t firstBlock = (start * 8) / kBlockBits;
+        std::uint64_t endBlock = (rangeEnd > start) ? (((rangeEnd * 8) - 1) / kBlockBits) + 1 : firstBlock;
+        // -resume: a sidecar journal binds the output to this input header and range, and
+        // records the writer state (and a digest of the input blocks behind it) after every
+        // block written. A matching journal lets this run truncate the output to the last
+        // checkpoint and continue from there.
+        ResumeJournal journal(ResumeJournal::pathFor(outputPath));
+        const auto identityHeader = header.serialize();
+        const auto identity = ResumeJournal::identity(identityHeader.data(), identityHeader.size(), start, rangeEnd);
+
+        // Streaming writer state. Blocks are kBlockBits long and not byte-aligned, so
+        // each block is spliced after the carried partial byte (tailBits < 8 valid bits).
+        // tail[0] is original byte tailBase; every completed byte is written immediately
+        // if it falls inside [start, rangeEnd). When firstBlock starts mid-byte the leading
+        // bits belong to an unsolved block, but that byte always precedes start.
+        ResumeJournal::Checkpoint state;
+        state.nextBlock = firstBlock;
+        state.tailBase = (firstBlock * kBlockBits) / 8;
+        state.tailBits = (firstBlock * kBlockBits) % 8;
+
+        std::error_code existsEc;
+        const bool outputExists = !toStdout && std::filesystem::exists(outputPath, existsEc);
+        const auto checkpoint = resume_ ? journal.load(identity) : std::nullopt;
+        if (checkpoint) {
+            const auto onDisk = std::filesystem::file_size(outputPath, existsEc);
+            if (existsEc || checkpoint->nextBlock < firstBlock || checkpoint->nextBlock > endBlock ||
+                checkpoint->outputBytes > onDisk) {
+                throw common::exceptions::DecompressOutputOpenError(
+                    "decompress: resume journal is inconsistent with output file: " + outputPath);
+            }
+            if (!fromStdin) {
+                // Same header is not the same archive: the blocks behind the checkpoint must
+                // still be the ones its output came from.
+                in.clear();
+                in.seekg(static_cast<std::streamoff>(blockOffset(in, header, firstBlock, extra, inputPath)),
+                         std::ios::beg);
+                std::uint32_t digest = 0;
+                for (auto b = firstBlock; b < checkpoint->nextBlock; ++b) {
+                    common::format::BlockFrame frame;
+                    const auto payload = readBlock(in, header, b, inputPath, &frame);
+                    digest = ResumeJournal::extend(digest, frame.flags, payload.data(), payload.size());
+                }
+                if (digest != checkpoint->digest) {
+                    throw common::exceptions::DecompressOutputOpenError(
+                        "decompress: resume journal was written for different input content: " + outputPath);
+                }
+            }
+            // Drop anything written after the last checkpoint (block in progress when killed).
+            std::filesystem::resize_file(outputPath, checkpoint->outputBytes, existsEc);
+            if (existsEc) {
+                throw common::exceptions::DecompressOutputOpenError("decompress: cannot truncate output file: " + outputPath);
+            }
+            state = *checkpoint;
+            ::crsce::o11y::O11y::instance().event("decompress_resume",
+                {{"next_block", std::to_string(state.nextBlock)}, {"output_bytes", std::to_string(state.outputBytes)}});
+        } else if (resume_ && outputExists) {
+            throw common::exceptions::DecompressOutputOpenError(
+                "decompress: output exists but has no resume journal: " + outputPath);
+        }
+        const auto resumeBlock = state.nextBlock;
+
+        if (!fromStdin) {
+            // v2: reject damaged blocks up front, before any solver time is spent.
+            const auto resumeOffset =
+                static_cast<std::streamoff>(blockOffset(in, header, resumeBlock, extra, inputPath));
+            in.clear();
+            in.seekg(resumeOffset, std::ios::beg);
+            validateFrames(in, header, resumeBlock, endBlock, inputPath);
+            in.clear();
+            in.seekg(resumeOffset, std::ios::beg);
+        }
+
+        // Open the output up front so recovered bytes reach it as blocks complete.
+        std::ofstream fileOut;
+        if (!toStdout) {
+            fileOut.open(outputPath, std::ios::binary | (checkpoint ? std::ios::app : std::ios::trunc));
+            if (!fileOut.is_open()) {
+                throw common::exceptions::DecompressOutputOpenError("decompress: cannot open output file: " + outputPath);
+            }
+        }
+        std::ostream &out = toStdout ? std::cout : fileOut;
+        if (resume_) {
+            journal.begin(identity, state);
+        }
+
+        ::crsce::o11y::O11y::instance().event("decompress_blocks",
+            {{"total", sizeKnown ? std::to_string(header.blockCount) : std::string("streamed")},
+             {"first", std::to_string(resumeBlock)},
+             {"count", sizeKnown ? std::to_string(endBlock - resumeBlock) : std::string("streamed")},
+             {"original_bytes", sizeKnown ? std::to_string(originalSize) : std::string("streamed")}});
+
+        std::uint64_t tailBase = state.tailBase;
+        std::uint64_t tailBits = state.tailBits;
+        std::uint64_t outputBytes = state.outputBytes;
+        std::vector<std::uint8_t> tail;
+        if (tailBits > 0) {
+            tail.push_back(state.tailByte);
+        }
+        auto emit = [&](const std::uint64_t byteCount) {
+            const auto lo = std::max(tailBase, start);
+            const auto hi = std::min(tailBase + byteCount, rangeEnd.load());
+            if (lo < hi) {
+                out.write(reinterpret_cast<const char *>(tail.data() + (lo - tailBase)), // NOLINT
+                          static_cast<std::streamsize>(hi - lo));
+                outputBytes += hi - lo;
+            }
+            tailBase += byteCount;
+        };
+
+        // Blocks whose payload repeats an earlier one reuse its CSM (CRSCE_DEDUP_BLOCKS entries).
+        common::util::BlockCache<common::Csm> cache(common::util::BlockCache<common::Csm>::capacityFromEnv());
+        // Blocks solved by an earlier run are read back from CRSCE_SOLVE_CACHE (off if unset).
+        SolveCache solveCache(SolveCache::dirFromEnv(), SolveCache::maxEntriesFromEnv());
+
+        // Sequential reader state for stdin: the next block index on the pipe, and whether
+        // the final frame has been seen.
+        std::uint64_t nextRead = 0;
+        bool streamEnded = false;
+
+        // -resume: content digest of the blocks loaded so far (ResumeJournal::extend); the loader
+        // reads blocks in order, so each block carries the digest through to its checkpoint.
+        std::uint32_t loadDigest = state.digest;
+
+        /**
+         * @struct BlockInput
+         * @brief A block's payload, its frame flags (0 for v1, which has no frames), the data
+         *        bits the solver must leave open (the rest of a kFlagPadded block is zero), and
+         *        the -resume content digest through this block.
+         */
+        struct BlockInput {
+            std::vector<std::uint8_t> payload;
+            std::uint16_t flags{0};
+            std::uint32_t validBits{kBlockBits};
+            std::uint32_t digest{0};
+        };
+
+        /**
+         * @struct BlockOutput
+         * @brief A reconstructed block and the content digest its checkpoint records.
+         */
+        struct BlockOutput {
+            common::Csm csm;
+            std::uint32_t digest{0};
+        };
+        auto inputOf = [&](const std::uint64_t b, std::vector<std::uint8_t> &&payload,
+                           const common::format::BlockFrame &frame) {
+            if (resume_) {
+                loadDigest = ResumeJournal::extend(loadDigest, frame.flags, payload.data(), payload.size());
+            }
+            BlockInput input{std::move(payload), frame.flags, kBlockBits, loadDigest};
+            if (frame.padded()) {
+                const std::uint64_t dataBits = sizeKnown ? (originalSize * 8) - std::min(originalSize * 8, b * kBlockBits)
+                                                         : kBlockBits;
+                input.validBits = frame.final() ? frame.finalBits
+                                                : static_cast<std::uint32_t>(std::min<std::uint64_t>(dataBits, kBlockBits));
+            }
+            return input;
+        };
+
+        // Blocks solved at once share the thread budget with their DI-th solution searches, so
+        // a block's search gets threads_ divided by the blocks that can be in flight beside it.
+        const std::uint64_t blocksInFlight =
+            sizeKnown ? std::clamp<std::uint64_t>(endBlock - resumeBlock, 1, threads_) : threads_;
+        const auto selectThreads = static_cast<std::uint32_t>(std::max<std::uint64_t>(1, threads_ / blocksInFlight));
+
+        try {
+            // Payloads are read sequentially, reconstructed on a worker pool (each worker
+            // owns its own solver stack, built inside reconstructBlock), and appended to
+            // the output in block order with at most 2 * threads_ blocks in flight.
+            common::util::runOrderedStream<BlockInput, BlockOutput>(
+                threads_, 2ULL * threads_,
+                [&](const std::uint64_t i) -> std::optional<BlockInput> {
+                    const auto b = resumeBlock + i;
+                    if (b >= endBlock) {
+                        return std::nullopt;
+                    }
+                    if (!fromStdin) {
+                        // Frames are re-checked as they are read, so a file modified after
+                        // validateFrames() still cannot feed a damaged payload to the solver.
+                        common::format::BlockFrame frame;
+                        auto payload = readBlock(in, header, b, inputPath, &frame);
+                        return inputOf(b, std::move(payload), frame);
+                    }
+                    // Pipe: read forward to block b, dropping blocks ahead of the range.
+                    while (!streamEnded) {
+                        common::format::BlockFrame frame;
+                        auto payload = readBlock(in, header, nextRead, inputPath, &frame);
+                        const auto got = nextRead++;
+                        if (frame.final()) {
+                            streamEnded = true;
+                            if (!sizeKnown) {
+                                originalSize = streamedSize(got, frame);
+                                if (start > originalSize) {
+                                    throw common::exceptions::DecompressRangeInvalid(
+                                        "decompress: range start " + std::to_string(start) +
+                                        " beyond original size " + std::to_string(originalSize));
+                                }
+                                rangeEnd = std::min(rangeEnd.load(), originalSize);
+                                endBlock = got + 1;
+                            }
+                        }
+                        if (got == b) {
+                            return inputOf(got, std::move(payload), frame);
+                        }
+                    }
+                    return std::nullopt;
+                },
+                [&](const std::uint64_t i, BlockInput &&input) {
+                    const auto b = resumeBlock + i;
+                    const auto &blockData = input.payload;
+                    const common::format::BlockFrame frame{.flags = input.flags};
+                    ::crsce::o11y::O11y::instance().event("decompress_block_start",
+                        {{"block_id", std::to_string(b)}, {"block_count", std::to_string(header.blockCount)}});
+
+                    common::Csm csm;
+                    if (frame.stored()) {
+                        // Stored block (readBlock sized it to kStoredPayloadBytes): the raw bits,
+                        // copied through with no solver work.
+                        common::bitkernels::unpackRows(blockData.data(), blockData.size(), 0, kBlockBits, csm);
+                        ::crsce::o11y::O11y::instance().event("decompress_block_stored",
+                            {{"block_id", std::to_string(b)}});
+                    } else if (const auto key = common::util::BlockCache<common::Csm>::keyOf(blockData.data(),
+                                                                                          blockData.size());
+                               auto hit = cache.find(key)) {
+                        // Same payload as an earlier block in this run: same CSM, no solve.
+                        csm = std::move(hit.value());
+                        ::crsce::o11y::O11y::instance().event("decompress_block_dedup",
+                            {{"block_id", std::to_string(b)}});
+                    } else {
+                        // View the payload in place; reconstructBlock decodes the sums it needs.
+                        const common::format::CompressedPayloadView payload(blockData.data(), blockData.size());
+
+                        if (auto solved = solveCache.load(key, payload)) {
+                            // Solved by an earlier run (CRSCE_SOLVE_CACHE); BH already checked.
+                            csm = std::move(solved.value());
+                            ::crsce::o11y::O11y::instance().event("decompress_block_solve_cache",
+                                {{"block_id", std::to_string(b)}});
+                        } else {
+                            // A hinted block (kFlagHint) carries its DecodeHint section after the payload.
+                            static constexpr std::size_t kPayloadBytes =
+                                common::format::CompressedPayload::kBlockPayloadBytes;
+                            const auto trail = blockData.size() > kPayloadBytes
+                                ? common::format::DecodeHint::deserialize(blockData.data() + kPayloadBytes, // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                                                          blockData.size() - kPayloadBytes)
+                                : std::nullopt;
+
+                            // Reconstruct the original CSM via solver enumeration.
+                            csm = reconstructBlock(payload, selectThreads, trail ? &trail.value() : nullptr,
+                                                   input.validBits, frame.layout());
+                            solveCache.store(key, csm);
+                        }
+                        cache.insert(key, csm);
+
+                        // The payload describes the block as laid out (BlockFrame::layout()); the
+                        // caches above hold it that way, so the layout is undone only here.
+                        if (frame.layout() != 0) {
+                            csm = common::csmlayout::invert(
+                                csm, static_cast<common::csmlayout::Layout>(frame.layout()));
+                        }
+                    }
+
+                    ::crsce::o11y::O11y::instance().event("decompress_block_done",
+                        {{"block_id", std::to_string(b)}, {"block_count", std::to_string(header.blockCount)}});
+                    return BlockOutput{std::move(csm), input.digest};
+                },
+                [&](const std::uint64_t i, const BlockOutput &done) {
+                    const auto &csm = done.csm;
+                    // Pack the block's rows directly after the carried bits.
+                    tail.resize(static_cast<std::size_t>((tailBits + kBlockBits + 7) / 8), 0);
+                    common::bitkernels::packRows(csm, tail.data(), tail.size(), tailBits);
+                    tailBits += kBlockBits;
+                    const auto fullBytes = tailBits / 8;
+                    emit(fullBytes);
+                    // Carry the trailing partial byte (if any) into the next block.
+                    tail.erase(tail.begin(), tail.begin() + static_cast<std::ptrdiff_t>(fullBytes));
+                    tailBits %= 8;
+                    if (!out.good()) {
+                        throw common::exceptions::DecompressOutputWriteError(
+                            "decompress: error writing output file: " + outputPath);
+                    }
+                    if (resume_) {
+                        // Block bytes reach the disk before the checkpoint naming them.
+                        out.flush();
+                        ResumeJournal::syncFile(outputPath);
+                        journal.record({resumeBlock + i + 1, outputBytes, tailBase, tailBits,
+                                        tail.empty() ? std::uint8_t{0} : tail.front(), done.digest});
+                    }
+                });
+
+            if (cache.enabled()) {
+                ::crsce::o11y::O11y::instance().metric("decompress_dedup", {
+                    {"hits",    cache.hits(),   ::crsce::o11y::O11y::MetricKind::Counter},
+                    {"misses",  cache.misses(), ::crsce::o11y::O11y::MetricKind::Counter},
+                    {"entries", cache.size(),   ::crsce::o11y::O11y::MetricKind::Gauge}});
+            }
+            if (solveCache.enabled()) {
+                solveCache.trim();
+                ::crsce::o11y::O11y::instance().metric("decompress_solve_cache", {
+                    {"hits",    solveCache.hits(),   ::crsce::o11y::O11y::MetricKind::Counter},
+                    {"misses",  solveCache.misses(), ::crsce::o11y::O11y::MetricKind::Counter},
+                    {"writes",  solveCache.writes(), ::crsce::o11y::O11y::MetricKind::Counter},
+                    {"evicted", solveCache.evicted(), ::crsce::o11y::O11y::MetricKind::Counter}});
+            }
+
+            // Flush the final partial byte; anything beyond rangeEnd is padding or unrequested.
+            if (tailBits > 0) {
+                emit(1);
+            }
+            if (toStdout) {
+                out.flush();
+            } else {
+                fileOut.close();
+            }
+            if (!out.good()) {
+                throw common::exceptions::DecompressOutputWriteError("decompress: error writing output file: " + outputPath);
+            }
+            if (!toStdout) {
+                journal.remove();
+            }
+        } catch (...) {
+            // Entries written before the failure still count against CRSCE_SOLVE_CACHE_MAX.
+            solveCache.trim();
+            if (toStdout) {
+                // Bytes already sent down the pipe cannot be withdrawn; the exit status reports the failure.
+                throw;
+            }
+            fileOut.close();
+            if (resume_) {
+                // Keep the checkpointed prefix and journal so the next -resume run continues.
+                throw;
+            }
+            // Fail hard: do not leave a partially recovered file behind.
+            std::error_code ec;
+            std::filesystem::remove(outputPath, ec);
+            throw;
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,47 @@
+/**
+ * @file Decompressor_extraBytes.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::extraBytes -- container bytes beyond the fixed block layout.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <cstdint>
+#include <string>
+
+#include "common/exceptions/DecompressHeaderInvalid.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/FileHeader.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name extraBytes
+     * @brief Bytes a container with a known block count holds beyond the fixed block layout.
+     * @details A file of n blocks is kHeaderBytes + n * blockStride() bytes plus, for each stored
+     *          block, kStoredPayloadBytes - kBlockPayloadBytes and, for each hinted block, its
+     *          DecodeHint section. A stored block is the largest a block can grow, which bounds
+     *          the total. v1 files have no frames and therefore no extra bytes.
+     * @param header Deserialized (or resolved) file header.
+     * @param fileSize Size of the input file in bytes.
+     * @return The extra bytes.
+     * @throws DecompressHeaderInvalid if the file is shorter than the fixed layout, or longer
+     *         than every block being stored would make it.
+     */
+    std::uint64_t Decompressor::extraBytes(const common::format::FileHeader &header, const std::uint64_t fileSize) {
+        static constexpr std::uint64_t kStoredExtra =
+            common::format::BlockFrame::kStoredPayloadBytes - common::format::CompressedPayload::kBlockPayloadBytes;
+        const std::uint64_t fixedSize =
+            common::format::FileHeader::kHeaderBytes + (header.blockCount * header.blockStride());
+        const std::uint64_t extra = fileSize - fixedSize;
+        if (fileSize < fixedSize ||
+            (extra != 0 && (header.version == common::format::FileHeader::kVersionV1 ||
+                            extra > header.blockCount * kStoredExtra))) {
+            throw common::exceptions::DecompressHeaderInvalid(
+                "decompress: file size mismatch: expected " + std::to_string(fixedSize) +
+                " bytes (plus stored or hinted blocks), got " + std::to_string(fileSize));
+        }
+        return extra;
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,51 @@
+/**
+ * @file Decompressor_frameBytesAt.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::frameBytesAt -- length of a framed block, reading a hint's length field if needed.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <array>
+#include <cstdint>
+#include <ios>
+#include <istream>
+#include <string>
+
+#include "common/exceptions/DecompressInputReadError.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name frameBytesAt
+     * @brief Length of the (not yet validated) framed block at a file offset: frame plus payload.
+     * @details Only a hinted block needs another read: its DecodeHint length field sits right
+     *          after the CompressedPayload.
+     * @param in Seekable input stream; its position is undefined on return.
+     * @param offset Offset of the frame.
+     * @param flags The frame's flags (from peekFlagsAt()).
+     * @param inputPath Input path, used in error messages.
+     * @return kFrameBytes + payloadBytes(flags) + hintBytes().
+     * @throws DecompressInputReadError if a hinted block's length field cannot be read.
+     */
+    std::uint64_t Decompressor::frameBytesAt(std::istream &in, const std::uint64_t offset, const std::uint16_t flags,
+                                             const std::string &inputPath) {
+        using common::format::BlockFrame;
+        const std::uint64_t fixed = BlockFrame::kFrameBytes + BlockFrame::payloadBytes(flags);
+        if ((flags & BlockFrame::kFlagHint) == 0 || (flags & BlockFrame::kFlagStored) != 0) {
+            return fixed;
+        }
+        std::array<std::uint8_t, common::format::DecodeHint::kHeaderBytes> field{};
+        in.seekg(static_cast<std::streamoff>(offset + BlockFrame::kFrameBytes +
+                                             common::format::CompressedPayload::kBlockPayloadBytes),
+                 std::ios::beg);
+        if (!in.read(reinterpret_cast<char *>(field.data()), // NOLINT
+                     static_cast<std::streamsize>(field.size()))) {
+            throw common::exceptions::DecompressInputReadError("decompress: failed to read input file: " + inputPath);
+        }
+        return fixed + common::format::DecodeHint::trailBytes(field.data());
+    }
+
+} // namespace crsce::decompress
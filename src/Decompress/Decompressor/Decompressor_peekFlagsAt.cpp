@@ -0,0 +1,41 @@
+/**
+ * @file Decompressor_peekFlagsAt.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::peekFlagsAt -- read the flags of a frame header without validating it.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <array>
+#include <cstdint>
+#include <ios>
+#include <istream>
+#include <string>
+
+#include "common/exceptions/DecompressInputReadError.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name peekFlagsAt
+     * @brief Flags of the (not yet validated) frame at a file offset.
+     * @details Only used to find where the next frame starts; readBlock() validates the frame
+     *          when the block itself is read, so a damaged flags field still surfaces as corruption.
+     * @param in Seekable input stream; left positioned after the frame header.
+     * @param offset Offset of the frame.
+     * @param inputPath Input path, used in error messages.
+     * @return The raw flags field.
+     * @throws DecompressInputReadError if the frame header cannot be read.
+     */
+    std::uint16_t Decompressor::peekFlagsAt(std::istream &in, const std::uint64_t offset,
+                                            const std::string &inputPath) {
+        std::array<std::uint8_t, common::format::BlockFrame::kFrameBytes> frameBytes{};
+        in.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+        if (!in.read(reinterpret_cast<char *>(frameBytes.data()), // NOLINT
+                     static_cast<std::streamsize>(frameBytes.size()))) {
+            throw common::exceptions::DecompressInputReadError("decompress: failed to read input file: " + inputPath);
+        }
+        return common::format::BlockFrame::peekFlags(frameBytes.data());
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,81 @@
+/**
+ * @file Decompressor_readBlock.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::readBlock -- read one on-disk block and strip/validate its frame.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "common/exceptions/DecompressBlockCorrupt.h"
+#include "common/exceptions/DecompressInputReadError.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/FileHeader.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name readBlock
+     * @brief Read block b at the stream's current position and return its payload bytes.
+     * @details v1 blocks are raw payloads. v2 blocks carry a BlockFrame, which is checked
+     *          (CRC-32, block id, flags) and stripped, so a damaged block is rejected in O(1)
+     *          instead of sending the solver into a search that cannot succeed. The frame is
+     *          read first: its flags say whether a CompressedPayload or a stored block follows,
+     *          and a hinted block's length field then gives the size of its DecodeHint section.
+     * @param in Input stream positioned at the start of block b.
+     * @param header Deserialized file header (selects v1 or v2 layout).
+     * @param b Block index expected at this position.
+     * @param inputPath Input path, used in error messages.
+     * @param frame If non-null, receives the v2 frame (left untouched for v1).
+     * @return The payload: kBlockPayloadBytes bytes (plus its DecodeHint section for a hinted
+     *         block), or kStoredPayloadBytes for a stored block.
+     * @throws DecompressInputReadError if the block cannot be read.
+     * @throws DecompressBlockCorrupt if a v2 frame fails validation, or a final frame is not the
+     *         last block of a file whose block count is known.
+     */
+    std::vector<std::uint8_t> Decompressor::readBlock(std::istream &in, const common::format::FileHeader &header,
+                                                      const std::uint64_t b, const std::string &inputPath,
+                                                      common::format::BlockFrame *frame) {
+        const bool framed = header.version != common::format::FileHeader::kVersionV1;
+        const std::size_t frameBytes = framed ? common::format::BlockFrame::kFrameBytes : 0;
+        std::vector<std::uint8_t> block(header.blockStride());
+        auto readInto = [&](const std::size_t offset, const std::size_t count) {
+            if (!in.read(reinterpret_cast<char *>(block.data() + offset), // NOLINT
+                         static_cast<std::streamsize>(count))) {
+                throw common::exceptions::DecompressInputReadError("decompress: failed to read input file: " +
+                                                                   inputPath);
+            }
+        };
+        std::uint16_t flags = 0;
+        if (framed) {
+            readInto(0, frameBytes);
+            flags = common::format::BlockFrame::peekFlags(block.data());
+            block.resize(frameBytes + common::format::BlockFrame::payloadBytes(flags));
+        }
+        readInto(frameBytes, block.size() - frameBytes);
+        if (const auto hint = common::format::BlockFrame::hintBytes(flags, block.data() + frameBytes); hint > 0) { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto have = block.size();
+            block.resize(have + hint);
+            readInto(have, hint);
+        }
+        if (framed) {
+            const auto parsed = common::format::BlockFrame::deserialize(block.data(), block.size(), b);
+            if (parsed.final() && !header.streamed() && b + 1 != header.blockCount) {
+                throw common::exceptions::DecompressBlockCorrupt(
+                    "decompress: block " + std::to_string(b) + " carries a final frame before the last block in " +
+                    inputPath);
+            }
+            if (frame != nullptr) {
+                *frame = parsed;
+            }
+            block.erase(block.begin(), block.begin() + static_cast<std::ptrdiff_t>(frameBytes));
+        }
+        return block;
+    }
+
+} // namespace crsce::decompress
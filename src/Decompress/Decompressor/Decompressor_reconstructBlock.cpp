@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -15,13 +16,17 @@
 
 #include "common/BlockHash/BlockHash.h"
 #include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
 #include "common/exceptions/DecompressDIOutOfRange.h"
-#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
 #include "common/O11y/O11y.h"
+#include "decompress/Solvers/BlockPadding.h"
 #include "decompress/Solvers/BranchingController.h"
 #include "decompress/Solvers/ConstraintStore.h"
 #include "decompress/Solvers/EnumerationController.h"
+#include "decompress/Solvers/ForcedBlock.h"
 #include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/ParallelLexSelector.h"
 #include "decompress/Solvers/PropagationEngine.h"
 #include "decompress/Solvers/RowDecomposedController.h"
 #include "decompress/Solvers/Sha1HashVerifier.h"
@@ -36,80 +41,142 @@ namespace crsce::decompress {
     /**
      * @name reconstructBlock
      * @brief Reconstruct the original CSM for a single block from its compressed payload.
-     * @param payload The deserialized CompressedPayload for the block.
+     * @param payload View over the block's serialized payload bytes.
+     * @param selectThreads Workers for the DI-th solution search when DI > 0 (1 = serial enumeration).
+     * @param trail Decode-hint branch trail to try before searching, or nullptr.
+     * @param validBits Data bits of the block; the padding cells after them are assigned 0 first.
+     * @param layout Layout of the block (csmlayout::Layout), which locates the padding cells.
      * @return The reconstructed Csm matching the DI-th enumerated solution.
      * @throws DecompressDIOutOfRange if enumeration does not reach the DI-th solution.
      */
-    common::Csm Decompressor::reconstructBlock(const common::format::CompressedPayload &payload) {
+    common::Csm Decompressor::reconstructBlock(const common::format::CompressedPayloadView &payload,
+                                               const std::uint32_t selectThreads,
+                                               const std::vector<std::uint8_t> *trail,
+                                               const std::uint32_t validBits,
+                                               const std::uint8_t layout) {
         // Extract the disambiguation index.
         const auto di = static_cast<std::uint32_t>(payload.getDI());
 
-        // Build the four original cross-sum vectors from the payload.
-        std::vector<std::uint16_t> lsm(kS);
-        std::vector<std::uint16_t> vsm(kS);
-        for (std::uint16_t k = 0; k < kS; ++k) {
-            lsm[k] = payload.getLSM(k);
-            vsm[k] = payload.getVSM(k);
+        // Constant, striped, sparse and near-empty blocks: when one propagation pass over the
+        // cross-sums assigns every cell, the block is built directly, skipping the solver.
+        if (di == 0) {
+            if (auto csm = solvers::solveForced(payload, validBits, static_cast<common::csmlayout::Layout>(layout))) {
+                ::crsce::o11y::O11y::instance().event("reconstruct_done",
+                    {{"di_target", "0"}, {"solutions_examined", "1"}, {"solver", "forced"},
+                     {"bh_verified", "true"}});
+                return std::move(csm.value());
+            }
         }
 
-        static constexpr std::uint16_t kDiagCount = (2 * kS) - 1;
-        std::vector<std::uint16_t> dsm(kDiagCount);
-        std::vector<std::uint16_t> xsm(kDiagCount);
-        for (std::uint16_t k = 0; k < kDiagCount; ++k) {
-            dsm[k] = payload.getDSM(k);
-            xsm[k] = payload.getXSM(k);
-        }
+        // Decode the cross-sum vectors straight from the payload bytes into the
+        // vectors the ConstraintStore is built from (no intermediate payload copy).
+        std::vector<std::uint16_t> lsm;
+        std::vector<std::uint16_t> vsm;
+        std::vector<std::uint16_t> dsm;
+        std::vector<std::uint16_t> xsm;
+        payload.unpackLSM(lsm);
+        payload.unpackVSM(vsm);
+        payload.unpackDSM(dsm);
+        payload.unpackXSM(xsm);
 
         // B.57: 2 LTP partition sum vectors from the payload.
-        std::vector<std::uint16_t> ltp1(kS);
-        std::vector<std::uint16_t> ltp2(kS);
-        for (std::uint16_t k = 0; k < kS; ++k) {
-            ltp1[k] = payload.getLTP1SM(k);
-            ltp2[k] = payload.getLTP2SM(k);
-        }
+        std::vector<std::uint16_t> ltp1;
+        std::vector<std::uint16_t> ltp2;
+        payload.unpackLTP1SM(ltp1);
+        payload.unpackLTP2SM(ltp2);
         // Empty vectors for unused LTP3-6 parameters
         const std::vector<std::uint16_t> ltp3, ltp4, ltp5, ltp6;
 
-        // Create solver components.
-        auto store = std::make_unique<solvers::ConstraintStore>(
-            lsm, vsm, dsm, xsm, ltp1, ltp2, ltp3, ltp4, ltp5, ltp6);
-
-        // Select propagation engine: Metal GPU or CPU-only.
-        std::unique_ptr<solvers::IPropagationEngine> propagator;
+        // Solver components are built per controller: DI > 0 with several threads gives each
+        // selection worker its own stack over the same sums and lateral hashes.
+        struct SolverStack {
+            std::unique_ptr<solvers::ConstraintStore> store;
+            std::unique_ptr<solvers::IPropagationEngine> propagator;
+            std::unique_ptr<solvers::BranchingController> brancher;
+            std::unique_ptr<solvers::Sha1HashVerifier> hasher;
+        };
+        const auto makeStack = [&](const bool cpuOnly = false) {
+            SolverStack stack;
+            stack.store = std::make_unique<solvers::ConstraintStore>(
+                lsm, vsm, dsm, xsm, ltp1, ltp2, ltp3, ltp4, ltp5, ltp6);
+            // kFlagPadded: the padding is zero and was assigned before discoverDI ranked the block.
+            static_cast<void>(solvers::assignPadding(*stack.store, validBits,
+                                                     static_cast<common::csmlayout::Layout>(layout)));
+
+            // Select propagation engine: Metal GPU or CPU-only.
 #ifdef CRSCE_ENABLE_METAL
-        const char *disableGpu = std::getenv("CRSCE_DISABLE_GPU"); // NOLINT(concurrency-mt-unsafe)
-        if (disableGpu == nullptr || std::string(disableGpu) != "1") {
-            propagator = std::make_unique<solvers::MetalPropagationEngine>(
-                *store, lsm, vsm, dsm, xsm);
-        } else {
-            propagator = std::make_unique<solvers::PropagationEngine>(*store);
-        }
+            const char *disableGpu = std::getenv("CRSCE_DISABLE_GPU"); // NOLINT(concurrency-mt-unsafe)
+            if (!cpuOnly && (disableGpu == nullptr || std::string(disableGpu) != "1")) {
+                stack.propagator = std::make_unique<solvers::MetalPropagationEngine>(
+                    *stack.store, lsm, vsm, dsm, xsm);
+            } else {
+                stack.propagator = std::make_unique<solvers::PropagationEngine>(*stack.store);
+            }
 #else
-        propagator = std::make_unique<solvers::PropagationEngine>(*store);
+            static_cast<void>(cpuOnly);
+            stack.propagator = std::make_unique<solvers::PropagationEngine>(*stack.store);
 #endif
-        auto brancher = std::make_unique<solvers::BranchingController>(*store, *propagator);
-
-        // Build hash verifier: CRC-32 for per-row verification (B.57).
-        // getLH() returns 4-byte CRC-32 arrays; setExpected() takes 32-byte arrays (IHashVerifier interface).
-        auto hasher = std::make_unique<solvers::Sha1HashVerifier>(kS);
-        for (std::uint16_t r = 0; r < kS; ++r) {
-            const auto lh4 = payload.getLH(r);
-            std::array<std::uint8_t, 32> lh32{};
-            for (std::size_t i = 0; i < lh4.size(); ++i) {
-                lh32[i] = lh4[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            stack.brancher = std::make_unique<solvers::BranchingController>(*stack.store, *stack.propagator);
+
+            // Build hash verifier: CRC-32 for per-row verification (B.57).
+            // lh() spans 4-byte CRC-32 digests; setExpected() takes 32-byte arrays (IHashVerifier interface).
+            stack.hasher = std::make_unique<solvers::Sha1HashVerifier>(kS);
+            for (std::uint16_t r = 0; r < kS; ++r) {
+                const auto lh4 = payload.lh(r);
+                std::array<std::uint8_t, 32> lh32{};
+                for (std::size_t i = 0; i < lh4.size(); ++i) {
+                    lh32[i] = lh4[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                }
+                stack.hasher->setExpected(r, lh32);
+            }
+            return stack;
+        };
+        const auto makeEnumerator = [&]() {
+            auto stack = makeStack();
+            return std::make_unique<solvers::EnumerationController>(
+                std::move(stack.store), std::move(stack.propagator),
+                std::move(stack.brancher), std::move(stack.hasher));
+        };
+
+        // Decode hint (kFlagHint): replay the compressor's branch trail on the same CPU stack it
+        // ranked with, then check every lateral hash and the block hash. Any failure falls back
+        // to the search below, which the payload supports on its own.
+        if (trail != nullptr) {
+            auto stack = makeStack(true);
+            solvers::EnumerationController replayer(
+                std::move(stack.store), std::move(stack.propagator),
+                std::move(stack.brancher), std::move(stack.hasher));
+            if (auto csm = replayer.solutionAt({.path = *trail, .leaf = true})) {
+                const solvers::Sha1HashVerifier rowHasher(kS);
+                bool verified = common::BlockHash::verify(csm.value(), payload.getBH());
+                for (std::uint16_t r = 0; r < kS && verified; ++r) {
+                    const auto digest = rowHasher.computeHash(csm->getRow(r));
+                    const auto expected = payload.lh(r);
+                    verified = std::equal(expected.begin(), expected.end(), digest.begin());
+                }
+                if (verified) {
+                    ::crsce::o11y::O11y::instance().event("reconstruct_done",
+                        {{"di_target", std::to_string(di)}, {"solutions_examined", "1"}, {"solver", "hint"},
+                         {"trail_bits", std::to_string(trail->size())}, {"bh_verified", "true"}});
+                    return std::move(csm.value());
+                }
             }
-            hasher->setExpected(r, lh32);
+            ::crsce::o11y::O11y::instance().event("reconstruct_hint_rejected",
+                {{"di_target", std::to_string(di)}, {"trail_bits", std::to_string(trail->size())}});
         }
 
         // Enumerate solutions until we reach the DI-th one (0-based).
         ::crsce::o11y::O11y::instance().event("reconstruct_start",
             {{"di_target", std::to_string(di)},
-             {"solver", di == 0 ? "row_decomposed" : "lex_enumeration"}});
+             {"solver", di == 0 ? "row_decomposed" : (selectThreads > 1 ? "parallel_select" : "lex_enumeration")},
+             {"padding_cells", std::to_string(kBlockBits - validBits)}});
         std::uint32_t count = 0;
 
         if (di == 0) {
+            auto stack = makeStack();
             solvers::RowDecomposedController solver(
-                std::move(store), std::move(propagator), std::move(brancher), std::move(hasher));
+                std::move(stack.store), std::move(stack.propagator),
+                std::move(stack.brancher), std::move(stack.hasher));
 
             for (const auto &csm : solver.enumerateSolutionsLex()) {
                 const bool bhOk = common::BlockHash::verify(csm, payload.getBH());
@@ -118,11 +185,24 @@ namespace crsce::decompress {
                      {"bh_verified", bhOk ? "true" : "false"}});
                 return csm;
             }
+        } else if (selectThreads > 1) {
+            // Count subtrees on several workers and descend only into the one holding solution DI.
+            solvers::ParallelLexSelector selector(makeEnumerator, selectThreads);
+            if (auto csm = selector.select(di)) {
+                const bool bhOk = common::BlockHash::verify(csm.value(), payload.getBH());
+                ::crsce::o11y::O11y::instance().event("reconstruct_done",
+                    {{"di_target", std::to_string(di)},
+                     {"solutions_examined", "parallel"},
+                     {"bh_verified", bhOk ? "true" : "false"}});
+                return std::move(csm.value());
+            }
+            throw common::exceptions::DecompressDIOutOfRange(
+                "decompress: enumeration did not reach DI=" + std::to_string(di) +
+                " (at most " + std::to_string(di) + " solutions)");
         } else {
-            solvers::EnumerationController enumerator(
-                std::move(store), std::move(propagator), std::move(brancher), std::move(hasher));
+            const auto enumerator = makeEnumerator();
 
-            for (const auto &csm : enumerator.enumerateSolutionsLex()) {
+            for (const auto &csm : enumerator->enumerateSolutionsLex()) {
                 if (count == di) {
                     const bool bhOk = common::BlockHash::verify(csm, payload.getBH());
                     ::crsce::o11y::O11y::instance().event("reconstruct_done",
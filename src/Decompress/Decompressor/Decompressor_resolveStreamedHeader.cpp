@@ -0,0 +1,93 @@
+/**
+ * @file Decompressor_resolveStreamedHeader.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::resolveStreamedHeader -- recover the sizes of a streamed container on disk.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <cstdint>
+#include <ios>
+#include <istream>
+#include <string>
+
+#include "common/exceptions/DecompressBlockCorrupt.h"
+#include "common/exceptions/DecompressHeaderInvalid.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/FileHeader.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name resolveStreamedHeader
+     * @brief Fill in the sizes of a streamed header from a seekable file.
+     * @details A streamed container (compressed from a pipe) without stored blocks is a whole
+     *          number of fixed-stride blocks, so the block count follows from the file size.
+     *          If the last fixed slot does not hold a final frame, stored or hinted blocks have shifted
+     *          the layout and the frames are walked instead. Only the last block may carry a
+     *          final frame, and it must: without one the file was cut short. Once resolved,
+     *          the header behaves like any other, so -range and -resume work on streamed files.
+     * @param in Seekable input stream; its position is undefined on return.
+     * @param header Deserialized streamed header.
+     * @param fileSize Size of the input file in bytes.
+     * @param inputPath Input path, used in error messages.
+     * @return The header with originalFileSizeBytes and blockCount filled in.
+     * @throws DecompressHeaderInvalid if the file is not a whole number of blocks or lacks a final frame.
+     * @throws DecompressBlockCorrupt if the last block's frame fails validation.
+     */
+    common::format::FileHeader Decompressor::resolveStreamedHeader(std::istream &in, common::format::FileHeader header,
+                                                                   const std::uint64_t fileSize,
+                                                                   const std::string &inputPath) {
+        using common::format::BlockFrame;
+        const std::uint64_t stride = header.blockStride();
+        const std::uint64_t body = fileSize - common::format::FileHeader::kHeaderBytes;
+        if (body == 0 || body < stride) {
+            throw common::exceptions::DecompressHeaderInvalid(
+                "decompress: streamed container is not a whole number of blocks: " + inputPath);
+        }
+        header.originalFileSizeBytes = 0; // no longer streamed(): final frames are position-checked
+
+        // The final frame is at `offset` as block `last`; validate it and take the size from it.
+        auto finish = [&](const std::uint64_t last, const std::uint64_t offset) {
+            header.blockCount = last + 1;
+            in.clear();
+            in.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+            BlockFrame frame;
+            static_cast<void>(readBlock(in, header, last, inputPath, &frame));
+            header.originalFileSizeBytes = streamedSize(last, frame);
+            return header;
+        };
+
+        // Common case: no stored or hinted blocks, so the last fixed slot holds a plain final frame.
+        if (body % stride == 0) {
+            const auto last = (body / stride) - 1;
+            const auto offset = common::format::FileHeader::kHeaderBytes + (last * stride);
+            const auto flags = peekFlagsAt(in, offset, inputPath);
+            if ((flags & BlockFrame::kFlagFinal) != 0 && (flags & (BlockFrame::kFlagStored | BlockFrame::kFlagHint)) == 0) {
+                try {
+                    return finish(last, offset);
+                } catch (const common::exceptions::DecompressBlockCorrupt &) {
+                    // Longer blocks can add up to whole strides, putting the real final frame
+                    // here under a different block id; the walk below settles it either way.
+                }
+            }
+        }
+
+        // Stored or hinted blocks (or truncation): walk the frame headers to the final frame.
+        std::uint64_t offset = common::format::FileHeader::kHeaderBytes;
+        for (std::uint64_t b = 0; offset + BlockFrame::kFrameBytes <= fileSize; ++b) {
+            const auto flags = peekFlagsAt(in, offset, inputPath);
+            const auto next = offset + frameBytesAt(in, offset, flags, inputPath);
+            if ((flags & BlockFrame::kFlagFinal) != 0 && next == fileSize) {
+                return finish(b, offset);
+            }
+            if ((flags & BlockFrame::kFlagFinal) != 0 && next < fileSize) {
+                throw common::exceptions::DecompressHeaderInvalid(
+                    "decompress: streamed container has data after its final block: " + inputPath);
+            }
+            offset = next;
+        }
+        throw common::exceptions::DecompressHeaderInvalid(
+            "decompress: streamed container has no final block (truncated?): " + inputPath);
+    }
+
+} // namespace crsce::decompress
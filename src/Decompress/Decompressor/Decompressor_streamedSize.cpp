@@ -0,0 +1,36 @@
+/**
+ * @file Decompressor_streamedSize.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::streamedSize -- original size implied by a streamed container's final frame.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <cstdint>
+#include <string>
+
+#include "common/exceptions/DecompressBlockCorrupt.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name streamedSize
+     * @brief Original size in bytes implied by a final frame at block index b.
+     * @details Blocks before b are full (kBlockBits each); the final block holds frame.finalBits
+     *          data bits. The input was a whole number of bytes, so the total must be too.
+     * @param b Index of the final block.
+     * @param frame The final block's frame.
+     * @return (b * kBlockBits + frame.finalBits) / 8.
+     * @throws DecompressBlockCorrupt if that bit count is not a whole number of bytes.
+     */
+    std::uint64_t Decompressor::streamedSize(const std::uint64_t b, const common::format::BlockFrame &frame) {
+        const std::uint64_t totalBits = (b * kBlockBits) + frame.finalBits;
+        if (totalBits % 8 != 0) {
+            throw common::exceptions::DecompressBlockCorrupt(
+                "decompress: final block " + std::to_string(b) + " ends mid-byte (" +
+                std::to_string(frame.finalBits) + " bits)");
+        }
+        return totalBits / 8;
+    }
+
+} // namespace crsce::decompress
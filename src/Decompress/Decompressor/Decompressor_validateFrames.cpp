@@ -0,0 +1,63 @@
+/**
+ * @file Decompressor_validateFrames.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Decompressor::validateFrames -- integrity pass over v2 block frames before solving.
+ */
+#include "decompress/Decompressor/Decompressor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+
+#include "common/exceptions/DecompressBlockCorrupt.h"
+#include "common/Format/CompressedPayload/FileHeader.h"
+#include "common/O11y/O11y.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name validateFrames
+     * @brief Check the frame of every block in [firstBlock, endBlock) without solving anything.
+     * @details Costs one sequential read and one CRC-32 per block, which is negligible next to a
+     *          single block solve, and lets a damaged file be reported before any solver time is
+     *          spent. v1 files carry no frames and pass trivially. All corrupt blocks are logged
+     *          (decompress_block_corrupt) and the first few are named in the exception.
+     * @param in Input stream positioned at the start of block firstBlock.
+     * @param header Deserialized file header.
+     * @param firstBlock First block index to check.
+     * @param endBlock One past the last block index to check.
+     * @param inputPath Input path, used in error messages.
+     * @return void
+     * @throws DecompressBlockCorrupt if any frame fails validation.
+     * @throws DecompressInputReadError if a block cannot be read.
+     */
+    void Decompressor::validateFrames(std::istream &in, const common::format::FileHeader &header,
+                                      const std::uint64_t firstBlock, const std::uint64_t endBlock,
+                                      const std::string &inputPath) {
+        if (header.version == common::format::FileHeader::kVersionV1) {
+            return;
+        }
+        static constexpr std::size_t kMaxNamed = 8;
+        std::uint64_t corrupt = 0;
+        std::string detail;
+        for (std::uint64_t b = firstBlock; b < endBlock; ++b) {
+            try {
+                static_cast<void>(readBlock(in, header, b, inputPath));
+            } catch (const common::exceptions::DecompressBlockCorrupt &e) {
+                ::crsce::o11y::O11y::instance().event("decompress_block_corrupt",
+                    {{"block_id", std::to_string(b)}, {"detail", e.what()}});
+                if (corrupt < kMaxNamed) {
+                    detail += (corrupt == 0 ? "" : ", ") + std::to_string(b);
+                }
+                ++corrupt;
+            }
+        }
+        if (corrupt > 0) {
+            throw common::exceptions::DecompressBlockCorrupt(
+                "decompress: " + std::to_string(corrupt) + " corrupt block(s) in " + inputPath + ": " + detail +
+                (corrupt > kMaxNamed ? ", ..." : ""));
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,62 @@
+/**
+ * @file ResumeJournal_begin.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::begin implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include "common/exceptions/DecompressOutputWriteError.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name begin
+     * @brief (Re)write the journal with the identity line and a starting checkpoint.
+     * @details Rewriting on resume compacts the journal to a single checkpoint. The new journal
+     *          is written and fsync'd as <path>.tmp, then renamed over the old one (and the
+     *          directory synced), so a crash mid-rewrite leaves one complete journal or the other.
+     * @param identity Identity string of the current run.
+     * @param start Writer state to start (or resume) from.
+     * @return void
+     * @throws DecompressOutputWriteError if the journal cannot be written.
+     */
+    void ResumeJournal::begin(const std::string &identity, const Checkpoint &start) {
+        close();
+        const auto tmp = path_ + ".tmp";
+        fd_ = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        if (fd_ < 0) {
+            throw common::exceptions::DecompressOutputWriteError("decompress: cannot write resume journal: " + tmp);
+        }
+        std::error_code ec;
+        try {
+            writeAll("crsce-resume-journal 2 " + identity + '\n');
+            record(start);
+        } catch (...) {
+            close();
+            std::filesystem::remove(tmp, ec);
+            throw;
+        }
+        close();
+        std::filesystem::rename(tmp, path_, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+            throw common::exceptions::DecompressOutputWriteError("decompress: cannot replace resume journal: " + path_);
+        }
+        // Make the rename itself durable.
+        auto dir = std::filesystem::path(path_).parent_path();
+        syncFile(dir.empty() ? std::string(".") : dir.string());
+
+        fd_ = ::open(path_.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        if (fd_ < 0) {
+            throw common::exceptions::DecompressOutputWriteError("decompress: cannot write resume journal: " + path_);
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,25 @@
+/**
+ * @file ResumeJournal_close.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::close implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <unistd.h>
+
+namespace crsce::decompress {
+
+    /**
+     * @name close
+     * @brief Close the journal descriptor if open.
+     * @return void
+     * @throws None
+     */
+    void ResumeJournal::close() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,21 @@
+/**
+ * @file ResumeJournal_ctor.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal constructor.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <string>
+#include <utility>
+
+namespace crsce::decompress {
+
+    /**
+     * @name ResumeJournal
+     * @brief Bind a journal to a path; nothing is opened until begin().
+     * @param path Journal file path.
+     * @throws None
+     */
+    ResumeJournal::ResumeJournal(std::string path) : path_(std::move(path)) {}
+
+} // namespace crsce::decompress
@@ -0,0 +1,19 @@
+/**
+ * @file ResumeJournal_dtor.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal destructor implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name ~ResumeJournal
+     * @brief Close the journal if open; the file itself is kept.
+     * @throws None
+     */
+    ResumeJournal::~ResumeJournal() {
+        close();
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,34 @@
+/**
+ * @file ResumeJournal_extend.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::extend implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "common/Util/crc32_ieee.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name extend
+     * @brief Extend a content digest with the next input block (CRC-32 over flags, then payload).
+     * @param digest Digest of the preceding blocks (0 for none).
+     * @param flags The block's frame flags (0 for v1).
+     * @param payload The block's payload bytes.
+     * @param len Number of payload bytes.
+     * @return The digest covering this block too.
+     * @throws None
+     */
+    std::uint32_t ResumeJournal::extend(const std::uint32_t digest, const std::uint16_t flags,
+                                        const std::uint8_t *payload, const std::size_t len) {
+        const std::array<std::uint8_t, 2> flagBytes{static_cast<std::uint8_t>(flags & 0xFFU),
+                                                    static_cast<std::uint8_t>(flags >> 8U)};
+        const auto withFlags = common::util::crc32_ieee(flagBytes.data(), flagBytes.size(), ~digest);
+        return common::util::crc32_ieee(payload, len, ~withFlags);
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,42 @@
+/**
+ * @file ResumeJournal_identity.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::identity implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <ios>
+#include <sstream>
+#include <string>
+
+namespace crsce::decompress {
+
+    /**
+     * @name identity
+     * @brief Identity string binding a journal to one container header and output range.
+     * @details The header carries the format version, original size and block count, so a
+     *          journal for a different -range or a differently sized input never matches. It
+     *          says nothing about the data: archives of same-size inputs share it, which is
+     *          why each checkpoint also carries a content digest (see extend()).
+     * @param header Serialized file header bytes.
+     * @param headerLen Number of header bytes.
+     * @param start First original byte of the output range.
+     * @param end One past the last original byte of the output range.
+     * @return Hex header bytes followed by "start:end".
+     * @throws None
+     */
+    std::string ResumeJournal::identity(const std::uint8_t *header, const std::size_t headerLen,
+                                        const std::uint64_t start, const std::uint64_t end) {
+        std::ostringstream oss;
+        oss << std::hex << std::setfill('0');
+        for (std::size_t i = 0; i < headerLen; ++i) {
+            oss << std::setw(2) << static_cast<unsigned>(header[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        oss << std::dec << ' ' << start << ':' << end;
+        return oss.str();
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,56 @@
+/**
+ * @file ResumeJournal_load.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::load implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include "common/exceptions/DecompressOutputOpenError.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name load
+     * @brief Read the last complete checkpoint from an existing journal.
+     * @details Line 1 must be "crsce-resume-journal 2 <identity>"; each further line is
+     *          "cp <nextBlock> <outputBytes> <tailBase> <tailBits> <tailByte> <digest>". Only
+     *          lines terminated by a newline count, so a torn final append is ignored.
+     * @param identity Identity string of the current run.
+     * @return The checkpoint, or std::nullopt if no journal exists.
+     * @throws DecompressOutputOpenError on an identity mismatch or if no checkpoint is readable.
+     */
+    std::optional<ResumeJournal::Checkpoint> ResumeJournal::load(const std::string &identity) const {
+        std::ifstream in(path_);
+        if (!in.is_open()) {
+            return std::nullopt;
+        }
+        std::string line;
+        if (!std::getline(in, line) || in.eof() || line != "crsce-resume-journal 2 " + identity) {
+            throw common::exceptions::DecompressOutputOpenError(
+                "decompress: resume journal does not match this input/range: " + path_);
+        }
+        std::optional<Checkpoint> last;
+        while (std::getline(in, line) && !in.eof()) {
+            std::istringstream fields(line);
+            std::string tag;
+            Checkpoint cp;
+            unsigned tailByte = 0;
+            if (fields >> tag >> cp.nextBlock >> cp.outputBytes >> cp.tailBase >> cp.tailBits >> tailByte >> cp.digest &&
+                tag == "cp" && cp.tailBits < 8 && tailByte <= 0xFFU) {
+                cp.tailByte = static_cast<std::uint8_t>(tailByte);
+                last = cp;
+            }
+        }
+        if (!last) {
+            throw common::exceptions::DecompressOutputOpenError(
+                "decompress: resume journal has no checkpoint: " + path_);
+        }
+        return last;
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,23 @@
+/**
+ * @file ResumeJournal_pathFor.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::pathFor implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <string>
+
+namespace crsce::decompress {
+
+    /**
+     * @name pathFor
+     * @brief Journal path for a given output path.
+     * @param outputPath Decompressor output path.
+     * @return outputPath + ".journal".
+     * @throws None
+     */
+    std::string ResumeJournal::pathFor(const std::string &outputPath) {
+        return outputPath + ".journal";
+    }
+
+} // namespace crsce::decompress
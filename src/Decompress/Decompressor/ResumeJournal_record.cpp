@@ -0,0 +1,33 @@
+/**
+ * @file ResumeJournal_record.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::record implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <unistd.h>
+
+#include <string>
+
+#include "common/exceptions/DecompressOutputWriteError.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name record
+     * @brief Append and fsync a checkpoint after a block has been synced to the output.
+     * @param checkpoint Writer state after the block.
+     * @return void
+     * @throws DecompressOutputWriteError if the journal cannot be written.
+     */
+    void ResumeJournal::record(const Checkpoint &checkpoint) {
+        writeAll("cp " + std::to_string(checkpoint.nextBlock) + ' ' + std::to_string(checkpoint.outputBytes) + ' ' +
+                 std::to_string(checkpoint.tailBase) + ' ' + std::to_string(checkpoint.tailBits) + ' ' +
+                 std::to_string(static_cast<unsigned>(checkpoint.tailByte)) + ' ' +
+                 std::to_string(checkpoint.digest) + '\n');
+        if (::fsync(fd_) != 0) {
+            throw common::exceptions::DecompressOutputWriteError("decompress: cannot sync resume journal: " + path_);
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,25 @@
+/**
+ * @file ResumeJournal_remove.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::remove implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <filesystem>
+#include <system_error>
+
+namespace crsce::decompress {
+
+    /**
+     * @name remove
+     * @brief Close and delete the journal (called once the output is complete).
+     * @return void
+     * @throws None
+     */
+    void ResumeJournal::remove() {
+        close();
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+
+} // namespace crsce::decompress
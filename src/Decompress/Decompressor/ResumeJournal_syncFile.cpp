@@ -0,0 +1,39 @@
+/**
+ * @file ResumeJournal_syncFile.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::syncFile implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "common/exceptions/DecompressOutputWriteError.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name syncFile
+     * @brief fsync a file's data to stable storage.
+     * @details fsync applies to the file, not the descriptor, so a read-only descriptor opened
+     *          here also syncs bytes written through another stream (after that stream's flush).
+     *          Also accepts a directory, to make a rename in it durable.
+     * @param path File to sync.
+     * @return void
+     * @throws DecompressOutputWriteError if the file cannot be opened or synced.
+     */
+    void ResumeJournal::syncFile(const std::string &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        if (fd < 0) {
+            throw common::exceptions::DecompressOutputWriteError("decompress: cannot open for sync: " + path);
+        }
+        const bool synced = ::fsync(fd) == 0;
+        ::close(fd);
+        if (!synced) {
+            throw common::exceptions::DecompressOutputWriteError("decompress: cannot sync: " + path);
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,40 @@
+/**
+ * @file ResumeJournal_writeAll.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ResumeJournal::writeAll implementation.
+ */
+#include "decompress/Decompressor/ResumeJournal.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+
+#include "common/exceptions/DecompressOutputWriteError.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name writeAll
+     * @brief Write text to the open journal descriptor, retrying short writes.
+     * @param text Bytes to write.
+     * @return void
+     * @throws DecompressOutputWriteError on a write error.
+     */
+    void ResumeJournal::writeAll(const std::string &text) const {
+        std::size_t done = 0;
+        while (done < text.size()) {
+            const auto n = ::write(fd_, text.data() + done, text.size() - done);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                throw common::exceptions::DecompressOutputWriteError("decompress: cannot write resume journal: " +
+                                                                     path_);
+            }
+            done += static_cast<std::size_t>(n);
+        }
+    }
+
+} // namespace crsce::decompress
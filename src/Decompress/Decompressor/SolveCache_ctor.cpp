@@ -0,0 +1,37 @@
+/**
+ * @file SolveCache_ctor.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief SolveCache constructor.
+ */
+#include "decompress/Decompressor/SolveCache.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace crsce::decompress {
+
+    /**
+     * @name SolveCache
+     * @brief Bind the cache to a directory, creating it if needed.
+     * @param dir Cache directory; empty (or not creatable) disables the cache.
+     * @param maxEntries Entries kept by trim().
+     * @throws None
+     */
+    SolveCache::SolveCache(std::string dir, const std::uint64_t maxEntries)
+        : dir_(std::move(dir)), maxEntries_(maxEntries),
+          trimEvery_(std::max<std::uint64_t>(maxEntries / kTrimShare, 1)) {
+        if (dir_.empty()) {
+            return;
+        }
+        std::error_code ec;
+        std::filesystem::create_directories(dir_, ec);
+        if (!std::filesystem::is_directory(dir_, ec)) {
+            dir_.clear();
+        }
+    }
+
+} // namespace crsce::decompress
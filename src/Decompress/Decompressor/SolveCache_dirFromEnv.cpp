@@ -0,0 +1,26 @@
+/**
+ * @file SolveCache_dirFromEnv.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief SolveCache::dirFromEnv implementation.
+ */
+#include "decompress/Decompressor/SolveCache.h"
+
+#include <cstdlib>
+#include <string>
+
+namespace crsce::decompress {
+
+    /**
+     * @name dirFromEnv
+     * @brief Cache directory from CRSCE_SOLVE_CACHE, or empty if unset.
+     * @return Directory path.
+     * @throws None
+     */
+    std::string SolveCache::dirFromEnv() {
+        if (const char *p = std::getenv("CRSCE_SOLVE_CACHE") /* NOLINT(concurrency-mt-unsafe) */; p && *p) {
+            return std::string(p);
+        }
+        return {};
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,78 @@
+/**
+ * @file SolveCache_load.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief SolveCache::load implementation.
+ */
+#include "decompress/Decompressor/SolveCache.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <optional>
+#include <string>
+#include <system_error>
+
+#include "common/BitKernels/BitKernels.h"
+#include "common/BlockHash/BlockHash.h"
+#include "common/Csm/Csm.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name load
+     * @brief Look up a block by payload digest and check it against the payload's block hash.
+     * @details A hit also refreshes the entry's modification time, which trim() uses as its
+     *          recency order.
+     * @param key SHA-256 of the serialized payload.
+     * @param payload The payload itself (supplies the expected BH).
+     * @return The block, or nullopt on a miss, a short entry or a BH mismatch (the entry is removed).
+     * @throws None
+     */
+    std::optional<common::Csm> SolveCache::load(const Key &key,
+                                                const common::format::CompressedPayloadView &payload) {
+        if (!enabled()) {
+            return std::nullopt;
+        }
+        static constexpr std::size_t kBytes = common::format::BlockFrame::kStoredPayloadBytes;
+        static constexpr std::uint64_t kBlockBits =
+            static_cast<std::uint64_t>(common::Csm::kS) * common::Csm::kS;
+
+        const auto path = pathOf(key);
+        std::array<std::uint8_t, kBytes> bytes{};
+        {
+            std::ifstream in(path, std::ios::binary);
+            if (!in.is_open()) {
+                ++misses_;
+                return std::nullopt;
+            }
+            in.read(reinterpret_cast<char *>(bytes.data()), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    static_cast<std::streamsize>(bytes.size()));
+            // Exactly kBytes: a short read or trailing bytes mean a damaged entry.
+            if (in.gcount() != static_cast<std::streamsize>(bytes.size()) || in.peek() != std::ifstream::traits_type::eof()) {
+                in.close();
+                std::error_code ec;
+                std::filesystem::remove(path, ec);
+                ++misses_;
+                return std::nullopt;
+            }
+        }
+
+        common::Csm csm;
+        common::bitkernels::unpackRows(bytes.data(), bytes.size(), 0, kBlockBits, csm);
+        std::error_code ec;
+        if (!common::BlockHash::verify(csm, payload.getBH())) {
+            std::filesystem::remove(path, ec);
+            ++misses_;
+            return std::nullopt;
+        }
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+        ++hits_;
+        return csm;
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,32 @@
+/**
+ * @file SolveCache_maxEntriesFromEnv.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief SolveCache::maxEntriesFromEnv implementation.
+ */
+#include "decompress/Decompressor/SolveCache.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+namespace crsce::decompress {
+
+    /**
+     * @name maxEntriesFromEnv
+     * @brief Entry limit from CRSCE_SOLVE_CACHE_MAX, or kDefaultMaxEntries if unset or invalid.
+     * @return Entry limit.
+     * @throws None
+     */
+    std::uint64_t SolveCache::maxEntriesFromEnv() {
+        const char *p = std::getenv("CRSCE_SOLVE_CACHE_MAX"); // NOLINT(concurrency-mt-unsafe)
+        if (p == nullptr || *p == '\0') {
+            return kDefaultMaxEntries;
+        }
+        try {
+            return static_cast<std::uint64_t>(std::stoull(std::string(p)));
+        } catch (...) {
+            return kDefaultMaxEntries;
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,32 @@
+/**
+ * @file SolveCache_pathOf.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief SolveCache::pathOf implementation.
+ */
+#include "decompress/Decompressor/SolveCache.h"
+
+#include <cstdint>
+#include <string>
+
+namespace crsce::decompress {
+
+    /**
+     * @name pathOf
+     * @brief Entry path for a key: <dir>/<hex key>.blk.
+     * @param key Payload digest.
+     * @return File path.
+     */
+    std::string SolveCache::pathOf(const Key &key) const {
+        static constexpr char kHex[] = "0123456789abcdef"; // NOLINT(*-avoid-c-arrays)
+        std::string path = dir_;
+        path.reserve(dir_.size() + 1 + (key.size() * 2) + 4);
+        path.push_back('/');
+        for (const std::uint8_t b : key) {
+            path.push_back(kHex[b >> 4U]);   // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            path.push_back(kHex[b & 0x0FU]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        path += ".blk";
+        return path;
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,73 @@
+/**
+ * @file SolveCache_store.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief SolveCache::store implementation.
+ */
+#include "decompress/Decompressor/SolveCache.h"
+
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <system_error>
+
+#include "common/BitKernels/BitKernels.h"
+#include "common/Csm/Csm.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+
+namespace crsce::decompress {
+
+    /**
+     * @name store
+     * @brief Write a solved block atomically (temporary file, then rename), trimming the
+     *        directory every trimEvery_ writes.
+     * @details The temporary name carries the pid and a per-process sequence number, so
+     *          concurrent writers (threads or processes) never share one. rename() replaces
+     *          an existing entry atomically; both writers hold the same bytes anyway.
+     * @param key SHA-256 of the serialized payload.
+     * @param csm The reconstructed block.
+     * @return void
+     * @throws None
+     */
+    void SolveCache::store(const Key &key, const common::Csm &csm) {
+        if (!enabled()) {
+            return;
+        }
+        static constexpr std::size_t kBytes = common::format::BlockFrame::kStoredPayloadBytes;
+
+        std::array<std::uint8_t, kBytes> bytes{};
+        common::bitkernels::packRows(csm, bytes.data(), bytes.size(), 0);
+
+        const auto path = pathOf(key);
+        const auto tmp = path + ".tmp." + std::to_string(static_cast<std::uint64_t>(::getpid())) + "." +
+                         std::to_string(seq_.fetch_add(1));
+        std::error_code ec;
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                return;
+            }
+            out.write(reinterpret_cast<const char *>(bytes.data()), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                      static_cast<std::streamsize>(bytes.size()));
+            out.close();
+            if (!out.good()) {
+                std::filesystem::remove(tmp, ec);
+                return;
+            }
+        }
+        std::filesystem::rename(tmp, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+        if (++writes_ % trimEvery_ == 0) {
+            trim();
+        }
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,71 @@
+/**
+ * @file SolveCache_trim.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief SolveCache::trim implementation.
+ */
+#include "decompress/Decompressor/SolveCache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace crsce::decompress {
+
+    /**
+     * @name trim
+     * @brief Remove the least recently used entries until at most maxEntries remain, and
+     *        temporary files older than kTmpGrace.
+     * @details Recency is the entry's modification time (set on write, refreshed on every hit).
+     *          Runs every trimEvery_ writes and when a run ends, not on every store, so a scan
+     *          of the directory is spread over that many writes. A temporary file
+     *          (<key>.blk.tmp.<pid>.<seq>) still in use by a live writer is seconds old at most,
+     *          so the grace period never races a store() in progress.
+     * @return Number of entries removed (temporary files not included).
+     * @throws None
+     */
+    std::uint64_t SolveCache::trim() {
+        if (!enabled()) {
+            return 0;
+        }
+        std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> entries;
+        const auto staleBefore = std::filesystem::file_time_type::clock::now() - kTmpGrace;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(dir_, ec), end; !ec && it != end; it.increment(ec)) {
+            const bool entry = it->path().extension() == ".blk";
+            if (!entry && it->path().filename().string().find(".blk.tmp.") == std::string::npos) {
+                continue;
+            }
+            std::error_code tec;
+            const auto mtime = it->last_write_time(tec);
+            if (tec) {
+                continue;
+            }
+            if (entry) {
+                entries.emplace_back(mtime, it->path());
+            } else if (mtime < staleBefore) {
+                std::filesystem::remove(it->path(), tec);
+            }
+        }
+        if (entries.size() <= maxEntries_) {
+            return 0;
+        }
+        const auto excess = static_cast<std::ptrdiff_t>(entries.size() - maxEntries_);
+        std::ranges::nth_element(entries, entries.begin() + excess,
+                                 [](const auto &a, const auto &b) { return a.first < b.first; });
+        std::uint64_t removed = 0;
+        for (auto it = entries.begin(); it != entries.begin() + excess; ++it) {
+            std::error_code rec;
+            if (std::filesystem::remove(it->second, rec)) {
+                ++removed;
+            }
+        }
+        evicted_ += removed;
+        return removed;
+    }
+
+} // namespace crsce::decompress
@@ -0,0 +1,38 @@
+/**
+ * @file BlockPadding.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief assignPadding() -- pre-assign a partial block's zero padding.
+ */
+#include "decompress/Solvers/BlockPadding.h"
+
+#include <cstdint>
+
+#include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
+#include "decompress/Solvers/ConstraintStore.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name assignPadding
+     * @brief Assign 0 to every cell that holds padding rather than data, before initial propagation.
+     * @param store Freshly built constraint store with nothing assigned.
+     * @param validBits Stream bits that hold data; bits [validBits, kS * kS) are padding.
+     * @param layout Layout the block was laid out with (padding bits go where it puts them).
+     * @return Number of cells assigned.
+     * @throws None
+     */
+    std::uint32_t assignPadding(ConstraintStore &store, const std::uint32_t validBits,
+                                const common::csmlayout::Layout layout) {
+        static constexpr std::uint16_t kS = common::Csm::kS;
+        static constexpr std::uint32_t kBlockBits = kS * kS;
+        std::uint32_t assigned = 0;
+        for (std::uint32_t i = validBits; i < kBlockBits; ++i) {
+            const auto p = common::csmlayout::cellOf(layout, static_cast<std::uint16_t>(i));
+            store.assign(static_cast<std::uint16_t>(p / kS), static_cast<std::uint16_t>(p % kS), 0);
+            ++assigned;
+        }
+        return assigned;
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,87 @@
+/**
+ * @file CellLineTable.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief cellLineTable() -- compile-time geometry, run-time LTP slots.
+ */
+#include "decompress/Solvers/CellLineTable.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "decompress/Solvers/LtpTable.h"
+
+namespace crsce::decompress::solvers {
+    namespace {
+        /**
+         * @name kS
+         * @brief Matrix dimension.
+         */
+        constexpr std::uint16_t kS = kLtpS;
+
+        /**
+         * @name kCells
+         * @brief Entries in the table.
+         */
+        constexpr std::size_t kCells = static_cast<std::size_t>(kS) * kS;
+
+        /**
+         * @name makeGeometry
+         * @brief Row, column, diagonal and anti-diagonal flat indices of every cell, LTP slots empty.
+         * @return The table with its LTP slots set to kCellLineNone.
+         */
+        constexpr std::array<CellLineIndex, kCells> makeGeometry() {
+            constexpr std::uint32_t kNumDiags = (2U * kS) - 1U;
+            std::array<CellLineIndex, kCells> table{};
+            for (std::uint16_t r = 0; r < kS; ++r) {
+                for (std::uint16_t c = 0; c < kS; ++c) {
+                    auto &e = table[(static_cast<std::size_t>(r) * kS) + c]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    e.flat = {r,
+                              static_cast<std::uint16_t>(kS + c),
+                              static_cast<std::uint16_t>((2U * kS) + c - r + (kS - 1U)),
+                              static_cast<std::uint16_t>((2U * kS) + kNumDiags + r + c),
+                              kCellLineNone,
+                              kCellLineNone};
+                    e.count = 4;
+                }
+            }
+            return table;
+        }
+
+        /**
+         * @name kGeometry
+         * @brief The compile-time half of the table.
+         */
+        constexpr auto kGeometry = makeGeometry();
+
+        static_assert(kGeometry[0].flat[2] == (2U * kS) + (kS - 1U), "cell (0,0) is on the main diagonal");
+        static_assert(kGeometry[kCells - 1].flat[3] == kLtp1Base - 1U, "the last cell closes the anti-diagonals");
+        static_assert(kGeometry[kS - 1].flat[2] == (2U * kS) + (2U * kS) - 2U, "cell (0,kS-1) is on the last diagonal");
+    } // anonymous namespace
+
+    /**
+     * @name cellLineTable
+     * @brief The process-wide cell-line table, row-major, with its LTP slots filled on first use.
+     * @return Pointer to kLtpS * kLtpS entries.
+     * @throws None
+     */
+    const CellLineIndex *cellLineTable() {
+        alignas(64) static std::array<CellLineIndex, kCells> table = kGeometry;
+        static const bool filled = [] {
+            for (std::uint16_t r = 0; r < kS; ++r) {
+                for (std::uint16_t c = 0; c < kS; ++c) {
+                    const auto &mem = ltpMembership(r, c);
+                    auto &e = table[(static_cast<std::size_t>(r) * kS) + c]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    for (std::uint8_t j = 0; j < mem.count && j < 2; ++j) {
+                        e.flat[4U + j] = mem.flat[j]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                        ++e.count;
+                    }
+                }
+            }
+            return true;
+        }();
+        static_cast<void>(filled);
+        return table.data();
+    }
+
+} // namespace crsce::decompress::solvers
@@ -9,7 +9,6 @@
 #include <cstdint>
 
 #include "decompress/Solvers/CellState.h"
-#include "decompress/Solvers/LtpTable.h"
 
 namespace crsce::decompress::solvers {
     /**
@@ -21,46 +20,37 @@ namespace crsce::decompress::solvers {
      * @throws None
      */
     void ConstraintStore::assign(const std::uint16_t r, const std::uint16_t c, const std::uint8_t v) {
-        cells_[(static_cast<std::size_t>(r) * kS) + c] = (v != 0) ? CellState::One : CellState::Zero;
+        const auto one = static_cast<std::uint16_t>(v != 0 ? 1U : 0U);
 
-        // Update row bits (MSB-first: column c maps to word c/64, bit 63-(c%64))
-        if (v != 0) {
-            const auto word = c / 64;
-            const auto bit = 63 - (c % 64);
-            rowBits_[r][word] |= (static_cast<std::uint64_t>(1) << bit); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
+        // Value plane (MSB-first: column c maps to word c/64, bit 63-(c%64))
+        rowBits_[r][c / 64] |= (static_cast<std::uint64_t>(one) << (63 - (c % 64))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        // Update assigned bitset (LSB-first for ctzll scanning)
+        // Known plane (LSB-first for ctzll scanning)
         assigned_[r][c / 64] |= (std::uint64_t{1} << (c % 64)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        // Compute flat indices for the 4 basic lines
-        const auto ri = static_cast<std::uint32_t>(r);
-        const auto ci = static_cast<std::uint32_t>(kS) + c;
-        const auto di = (2U * kS) + static_cast<std::uint32_t>(c - r + (kS - 1));
-        const auto xi = (2U * kS) + kNumDiags + static_cast<std::uint32_t>(r + c);
+        // Undo log for rollback(), kept only while a mark is outstanding
+        if (trailing_) {
+            trail_.push_back(static_cast<std::uint16_t>((r * kS) + c));
+        }
 
-        // B.22: LTP membership is always 4 sub-tables (full coverage)
-        const auto &mem = ltpMembership(r, c);
+        // The six lines through the cell (CellLineTable); an empty LTP slot lands on the spare stat.
+        const auto &lines = cellLines(r, c).flat;
 
         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        // Decrement unknown counts for all lines
-        stats_[ri].unknown--;
-        stats_[ci].unknown--;
-        stats_[di].unknown--;
-        stats_[xi].unknown--;
-        for (std::uint8_t j = 0; j < mem.count; ++j) {
-            stats_[mem.flat[j]].unknown--;
-        }
-
-        // Increment assigned counts if value is 1
-        if (v != 0) {
-            stats_[ri].assigned++;
-            stats_[ci].assigned++;
-            stats_[di].assigned++;
-            stats_[xi].assigned++;
-            for (std::uint8_t j = 0; j < mem.count; ++j) {
-                stats_[mem.flat[j]].assigned++;
+        // Decrement unknown counts and count the one (a fixed six-slot loop), then raise a line
+        // event if the line can now force or is in conflict: rho <= 0 or rho >= u, except a
+        // finished, satisfied line (rho == u == 0).
+        for (const auto idx : lines) {
+            auto &st = stats_[idx];
+            st.unknown--;
+            st.assigned += one;
+            const auto rho = static_cast<std::int32_t>(st.target) - static_cast<std::int32_t>(st.assigned);
+            const auto u = static_cast<std::int32_t>(st.unknown);
+            const bool actionable = (rho <= 0 || rho >= u) && (rho != 0 || u != 0);
+            if (actionable && eventPending_[idx] == 0) {
+                eventPending_[idx] = 1;
+                lineEvents_.push_back(idx);
             }
         }
 
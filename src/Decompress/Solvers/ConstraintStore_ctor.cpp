@@ -41,8 +41,7 @@ namespace crsce::decompress::solvers {
                                      const std::vector<std::uint16_t> &ltp4Sums,
                                      const std::vector<std::uint16_t> &ltp5Sums,
                                      const std::vector<std::uint16_t> &ltp6Sums)
-        : cells_(static_cast<std::size_t>(kS) * kS, CellState::Unassigned),
-          rowBits_(kS, std::array<std::uint64_t, 2>{}) {
+        : rowBits_(kS, std::array<std::uint64_t, 2>{}) {
 
         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
 
@@ -95,6 +94,10 @@ namespace crsce::decompress::solvers {
             stats_[kLTP2Base + k].assigned = 0;
         }
 
+        // Line events: at most one pending per line; the spare stat slot never raises one.
+        lineEvents_.reserve(kStatSlots);
+        eventPending_[kCellLineNone] = 1;
+
         // B.57: only 2 LTP sub-tables. LTP3-6 parameters are unused.
         (void)ltp3Sums; (void)ltp4Sums; (void)ltp5Sums; (void)ltp6Sums;
 
@@ -0,0 +1,68 @@
+/**
+ * @file ConstraintStore_trail.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ConstraintStore mark/rollback: trail-based undo for row-level backtracking.
+ */
+#include "decompress/Solvers/ConstraintStore.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "decompress/Solvers/CellState.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name mark
+     * @brief Turn the trail on, open one more mark, and return the current trail position.
+     * @return The trail position to pass to rollback().
+     * @throws None
+     */
+    std::size_t ConstraintStore::mark() {
+        ++markDepth_;
+        trailing_ = true;
+        return trail_.size();
+    }
+
+    /**
+     * @name closeMark
+     * @brief Close the innermost mark; closing the last one turns the trail off and empties it.
+     * @throws None
+     */
+    void ConstraintStore::closeMark() {
+        if (markDepth_ > 0 && --markDepth_ == 0) {
+            trailing_ = false;
+            trail_.clear();
+        }
+    }
+
+    /**
+     * @name commit
+     * @brief Keep the assigns made since the innermost mark and close that mark.
+     * @throws None
+     */
+    void ConstraintStore::commit() {
+        closeMark();
+    }
+
+    /**
+     * @name rollback
+     * @brief Unassign the cells trailed since trailMark, newest first, and close that mark.
+     * @param trailMark A value returned by mark().
+     * @throws None
+     */
+    void ConstraintStore::rollback(const std::size_t trailMark) {
+        while (trail_.size() > trailMark) {
+            const auto cell = trail_.back();
+            trail_.pop_back();
+            const auto r = static_cast<std::uint16_t>(cell / kS);
+            const auto c = static_cast<std::uint16_t>(cell % kS);
+            // A cell another caller already unassigned stays that way.
+            if (getCellState(r, c) != CellState::Unassigned) {
+                unassign(r, c);
+            }
+        }
+        closeMark();
+    }
+
+} // namespace crsce::decompress::solvers
@@ -9,7 +9,6 @@
 #include <cstdint>
 
 #include "decompress/Solvers/CellState.h"
-#include "decompress/Solvers/LtpTable.h"
 
 namespace crsce::decompress::solvers {
     /**
@@ -20,48 +19,23 @@ namespace crsce::decompress::solvers {
      * @throws None
      */
     void ConstraintStore::unassign(const std::uint16_t r, const std::uint16_t c) {
-        const auto wasOne = (cells_[(static_cast<std::size_t>(r) * kS) + c] == CellState::One);
-        cells_[(static_cast<std::size_t>(r) * kS) + c] = CellState::Unassigned;
+        const auto word = c / 64;
+        const auto valueMask = static_cast<std::uint64_t>(1) << (63 - (c % 64));
+        const auto wasOne = static_cast<std::uint16_t>((rowBits_[r][word] & valueMask) != 0 ? 1U : 0U); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        // Clear row bit if it was set
-        if (wasOne) {
-            const auto word = c / 64;
-            const auto bit = 63 - (c % 64);
-            rowBits_[r][word] &= ~(static_cast<std::uint64_t>(1) << bit); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
-
-        // Clear assigned bitset (LSB-first for ctzll scanning)
-        assigned_[r][c / 64] &= ~(std::uint64_t{1} << (c % 64)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-
-        // Compute flat indices for the 4 basic lines
-        const auto ri = static_cast<std::uint32_t>(r);
-        const auto ci = static_cast<std::uint32_t>(kS) + c;
-        const auto di = (2U * kS) + static_cast<std::uint32_t>(c - r + (kS - 1));
-        const auto xi = (2U * kS) + kNumDiags + static_cast<std::uint32_t>(r + c);
+        // Clear the cell in both planes
+        rowBits_[r][word] &= ~valueMask; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        assigned_[r][word] &= ~(std::uint64_t{1} << (c % 64)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        // B.22: LTP membership is always 4 sub-tables (full coverage)
-        const auto &mem = ltpMembership(r, c);
+        // The six lines through the cell (CellLineTable); an empty LTP slot lands on the spare stat.
+        const auto &lines = cellLines(r, c).flat;
 
         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        // Increment unknown counts for all lines
-        stats_[ri].unknown++;
-        stats_[ci].unknown++;
-        stats_[di].unknown++;
-        stats_[xi].unknown++;
-        for (std::uint8_t j = 0; j < mem.count; ++j) {
-            stats_[mem.flat[j]].unknown++;
-        }
-
-        // Decrement assigned counts if was one
-        if (wasOne) {
-            stats_[ri].assigned--;
-            stats_[ci].assigned--;
-            stats_[di].assigned--;
-            stats_[xi].assigned--;
-            for (std::uint8_t j = 0; j < mem.count; ++j) {
-                stats_[mem.flat[j]].assigned--;
-            }
+        // Increment unknown counts and uncount the one (a fixed six-slot loop: no branch)
+        for (const auto idx : lines) {
+            stats_[idx].unknown++;
+            stats_[idx].assigned -= wasOne;
         }
 
         // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
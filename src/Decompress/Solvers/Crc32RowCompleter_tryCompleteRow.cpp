@@ -41,11 +41,11 @@ namespace crsce::decompress::solvers {
         // Collect free column indices for this row
         std::array<std::uint16_t, 32> freeCols{};
         std::uint8_t freeCount = 0;
-        for (std::uint16_t c = 0; c < kS && freeCount < 32; ++c) {
-            if (cs.getCellState(r, c) == CellState::Unassigned) {
+        cs.forEachUnassignedInRow(r, [&](const std::uint16_t c) {
+            if (freeCount < 32) {
                 freeCols[freeCount++] = c; // NOLINT
             }
-        }
+        });
 
         // Compute CRC-32 target residual: expected XOR contribution_of_known_cells
         // The expected CRC includes the affine constant. The generator matrix is the linear part.
@@ -149,8 +149,11 @@ namespace crsce::decompress::solvers {
         for (std::uint8_t i = 0; i < pivotRow; ++i) {
             if (pivotCol[i] >= 0) { pivotMask |= (1U << static_cast<std::uint8_t>(pivotCol[i])); } // NOLINT
         }
-        const std::uint32_t freeMask = ((1U << freeCount) - 1U) & ~pivotMask;
+        // freeCount may be 32, where 1U << freeCount is undefined
+        const std::uint32_t unknownMask = (freeCount >= 32) ? ~std::uint32_t{0} : ((1U << freeCount) - 1U);
+        const std::uint32_t freeMask = unknownMask & ~pivotMask;
         const auto nFree = static_cast<std::uint8_t>(__builtin_popcount(freeMask));
+        result.freeVariables = nFree;
 
         if (nFree == 0) {
             // Fully determined by CRC-32: assign all pivots directly
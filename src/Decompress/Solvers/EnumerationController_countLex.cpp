@@ -0,0 +1,37 @@
+/**
+ * @file EnumerationController_countLex.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::countLex -- budgeted solution count for a lex search node.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <chrono>
+#include <cstdint>
+
+#include "decompress/Solvers/LexPrefix.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name countLex
+     * @brief Count the solutions in a node's subtree, stopping at a budget.
+     * @param node Node whose subtree to count.
+     * @param budget Stop once this many solutions have been counted.
+     * @return Number of solutions counted (at most budget).
+     * @throws None
+     */
+    std::uint32_t EnumerationController::countLex(const LexPrefix &node, const std::uint32_t budget) {
+        if (node.leaf) {
+            return budget > 0 ? 1U : 0U;
+        }
+        const auto root = replay(node.path);
+        if (!root.has_value()) {
+            return 0;
+        }
+        bool timedOut = false;
+        const auto count = countSubtree(budget, std::chrono::steady_clock::time_point::max(), timedOut);
+        brancher_->undoToSavePoint(root.value());
+        return count;
+    }
+
+} // namespace crsce::decompress::solvers
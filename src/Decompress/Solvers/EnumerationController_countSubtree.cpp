@@ -0,0 +1,111 @@
+/**
+ * @file EnumerationController_countSubtree.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::countSubtree -- budgeted solution count below the current DFS state.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "decompress/Solvers/IBranchingController.h"
+#include "decompress/Solvers/LexPruner.h"
+
+namespace crsce::decompress::solvers {
+
+    namespace {
+        /**
+         * @struct CountFrame
+         * @brief One level of the explicit DFS stack used for counting.
+         */
+        struct CountFrame {
+            std::uint16_t r;        ///< Row index of the branching cell.
+            std::uint16_t c;        ///< Column index of the branching cell.
+            std::uint8_t nextValue;  ///< Next value to try: 0, 1, or 2 (exhausted).
+            IBranchingController::UndoToken token; ///< Save point before the current value's assignment.
+        };
+
+        /**
+         * @name kDeadlineCheckInterval
+         * @brief DFS iterations between wall-clock checks.
+         */
+        constexpr std::uint64_t kDeadlineCheckInterval = 4096;
+    } // anonymous namespace
+
+    /**
+     * @name countSubtree
+     * @brief Count the hash-verified solutions below the current state, up to a budget.
+     *
+     * Walks the subtree in the same order as enumerateSolutionsLex() but never builds a Csm:
+     * a complete assignment is verified row by row in place (the check AsyncHashPipeline
+     * makes) and counted. The state is restored to the caller's on return.
+     *
+     * @param budget Stop once this many solutions have been counted.
+     * @param deadline Wall-clock limit.
+     * @param timedOut Set to true if the deadline passed (the returned count is then partial).
+     * @return Number of solutions counted (at most budget).
+     * @throws None
+     */
+    std::uint32_t EnumerationController::countSubtree(const std::uint32_t budget,
+                                                      const std::chrono::steady_clock::time_point deadline,
+                                                      bool &timedOut) {
+        const auto verifyAllRows = [this]() {
+            for (std::uint16_t r = 0; r < kS; ++r) {
+                if (!hasher_->verifyRow(r, store_->getRow(r))) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        const auto firstCell = brancher_->nextCell();
+        if (!firstCell.has_value()) {
+            return verifyAllRows() ? 1U : 0U;
+        }
+
+        const std::array<std::uint8_t, 2> order = brancher_->branchOrder();
+        std::vector<CountFrame> stack;
+        stack.push_back({firstCell->first, firstCell->second, 0, 0});
+        std::uint32_t count = 0;
+        std::uint64_t iterations = 0;
+
+        while (!stack.empty()) {
+            auto &frame = stack.back();
+            if (frame.nextValue > 0) {
+                brancher_->undoToSavePoint(frame.token);
+            }
+            if (frame.nextValue >= 2 || count >= budget) {
+                stack.pop_back();
+                continue;
+            }
+            if (++iterations % kDeadlineCheckInterval == 0 && std::chrono::steady_clock::now() >= deadline) {
+                timedOut = true;
+                break;
+            }
+
+            const std::uint8_t v = order[frame.nextValue++]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            frame.token = brancher_->saveUndoPoint();
+            if (!pruner_->admits(frame.r, frame.c, v) || !tryAssign(frame.r, frame.c, v)) {
+                continue;
+            }
+            pruner_->observeDepth(stack.size());
+
+            const auto nextCell = brancher_->nextCell();
+            if (!nextCell.has_value()) {
+                if (verifyAllRows()) {
+                    ++count;
+                }
+                continue;
+            }
+            stack.push_back({nextCell->first, nextCell->second, 0, 0});
+        }
+
+        if (!stack.empty()) {
+            brancher_->undoToSavePoint(stack.front().token);
+        }
+        return count;
+    }
+
+} // namespace crsce::decompress::solvers
@@ -13,8 +13,9 @@
 #include "decompress/Solvers/IConstraintStore.h"
 #include "decompress/Solvers/IHashVerifier.h"
 #include "decompress/Solvers/IPropagationEngine.h"
-#ifndef NDEBUG
 #include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/LexPruner.h"
+#ifndef NDEBUG
 #include "decompress/Solvers/Sha256HashVerifier.h"
 #endif
 
@@ -40,5 +41,8 @@ namespace crsce::decompress::solvers {
         assert(dynamic_cast<ConstraintStore *>(store_.get()));
         assert(dynamic_cast<Sha256HashVerifier *>(hasher_.get()));
 #endif
+        pruner_ = std::make_unique<LexPruner>(
+            static_cast<ConstraintStore &>(*store_), // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+            *brancher_, *hasher_);
     }
 } // namespace crsce::decompress::solvers
@@ -14,6 +14,7 @@
 #include "decompress/Solvers/ConstraintStore.h"
 #include "decompress/Solvers/IBranchingController.h"
 #include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/LexPruner.h"
 #include "decompress/Solvers/LineID.h"
 #include "decompress/Solvers/PropagationEngine.h"
 
@@ -92,6 +93,11 @@ namespace crsce::decompress::solvers {
             const std::uint8_t v = order[frame.nextValue++]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
             frame.token = brancher_->saveUndoPoint();
 
+            // Stall-time lookahead (a no-op until the StallDetector escalates)
+            if (!pruner_->admits(frame.r, frame.c, v)) {
+                continue;
+            }
+
             // Assign the cell and record it on the undo stack
             cs.assign(frame.r, frame.c, v);
             brancher_->recordAssignment(frame.r, frame.c);
@@ -109,11 +115,8 @@ namespace crsce::decompress::solvers {
                     std::span<const LineID>{lines.lines.data(), static_cast<std::size_t>(lines.count)});
             }
 
-            if (!feasible) {
-                continue;
-            }
-
-            // Record forced assignments on the undo stack
+            // Record forced assignments on the undo stack, including those made before a
+            // contradiction was found, so the undo at the top of the loop removes them too
             const auto &forced = (cpuProp != nullptr)
                 ? cpuProp->getForcedAssignments()
                 : propagator_->getForcedAssignments();
@@ -121,6 +124,10 @@ namespace crsce::decompress::solvers {
                 brancher_->recordAssignment(a.r, a.c);
             }
 
+            if (!feasible) {
+                continue;
+            }
+
             // Inline row-hash verification: when a row becomes fully assigned,
             // immediately check its SHA-256 against the expected lateral hash.
             bool hashFailed = false;
@@ -143,6 +150,12 @@ namespace crsce::decompress::solvers {
                 continue;
             }
 
+            // B.59g: complete the rows CRC-32 now determines, cascading through propagation
+            if (!pruner_->extend(frame.r, std::span<const Assignment>{forced.data(), forced.size()})) {
+                continue;
+            }
+            pruner_->observeDepth(stack.size());
+
             // Find the next unassigned cell
             const auto nextCell = brancher_->nextCell();
             if (!nextCell.has_value()) {
@@ -11,6 +11,7 @@
 
 #include "decompress/Solvers/AsyncHashPipeline.h"
 #include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/LexPruner.h"
 #include "decompress/Solvers/LineID.h"
 
 namespace crsce::decompress::solvers {
@@ -53,6 +54,13 @@ namespace crsce::decompress::solvers {
             brancher_->recordAssignment(a.r, a.c);
         }
 
+        // Root pruning: CRC-32 row completion and failed-literal probing to fixpoint
+        if (!pruner_->prepareRoot()) {
+            pipeline_->shutdown();
+            pipeline_.reset();
+            return;
+        }
+
         bool stop = false;
         dfs(callback, stop);
         pipeline_.reset();
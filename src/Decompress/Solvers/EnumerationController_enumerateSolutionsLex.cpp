@@ -24,6 +24,7 @@
 #include "decompress/Solvers/ConstraintStore.h"
 #include "decompress/Solvers/IBranchingController.h"
 #include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/LexPruner.h"
 #include "decompress/Solvers/LineID.h"
 #include "decompress/Solvers/PropagationEngine.h"
 
@@ -53,7 +54,9 @@ namespace crsce::decompress::solvers {
      * hash verification during DFS. When a row becomes fully assigned (u(row)=0),
      * its hash is immediately compared to the expected lateral hash (LH[r]).
      * A mismatch prunes the entire subtree, enabling deep search into random data.
-     * Final full-matrix verification is offloaded to AsyncHashPipeline.
+     * Final full-matrix verification is offloaded to AsyncHashPipeline. LexPruner adds
+     * CRC-32 row completion and probing; both only force cells every solution below the
+     * node shares, so the yield order is unchanged.
      *
      * @return A Generator<Csm> that yields solutions one at a time.
      * @throws None
@@ -109,6 +112,15 @@ namespace crsce::decompress::solvers {
         ::crsce::o11y::O11y::instance().event("solver_initial_propagation",
             {{"forced_cells", std::to_string(initialForced.size())}});
 
+        // Root pruning: CRC-32 row completion and failed-literal probing to fixpoint
+        if (!pruner_->prepareRoot()) {
+            ::crsce::o11y::O11y::instance().event("solver_infeasible",
+                {{"phase", "root_pruning"}});
+            pipeline_->shutdown();
+            pipeline_.reset();
+            co_return;
+        }
+
         // Find the first unassigned cell
         const auto firstCell = brancher_->nextCell();
         if (!firstCell.has_value()) {
@@ -156,6 +168,7 @@ namespace crsce::decompress::solvers {
         std::uint64_t dfsIterations = 0;
         std::uint64_t failedNotFeasible = 0;
         std::uint64_t failedHashMismatch = 0;
+        std::uint64_t failedRowCompletion = 0;
         std::uint64_t candidatesSubmitted = 0;
 
         const auto dfsStart = std::chrono::steady_clock::now();
@@ -206,6 +219,12 @@ namespace crsce::decompress::solvers {
             const std::uint8_t v = order[frame.nextValue++]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
             frame.token = brancher_->saveUndoPoint();
 
+            // Stall-time lookahead (a no-op until the StallDetector escalates)
+            if (!pruner_->admits(frame.r, frame.c, v)) {
+                ++failedNotFeasible;
+                continue;
+            }
+
             // Assign the cell and record it on the undo stack
             cs.assign(frame.r, frame.c, v);
             brancher_->recordAssignment(frame.r, frame.c);
@@ -223,12 +242,8 @@ namespace crsce::decompress::solvers {
                     std::span<const LineID>{lines.lines.data(), static_cast<std::size_t>(lines.count)});
             }
 
-            if (!feasible) {
-                ++failedNotFeasible;
-                continue;
-            }
-
-            // Record forced assignments on the undo stack
+            // Record forced assignments on the undo stack, including those made before a
+            // contradiction was found, so the undo at the top of the loop removes them too
             const auto &forced = (cpuProp != nullptr)
                 ? cpuProp->getForcedAssignments()
                 : propagator_->getForcedAssignments();
@@ -236,6 +251,11 @@ namespace crsce::decompress::solvers {
                 brancher_->recordAssignment(a.r, a.c);
             }
 
+            if (!feasible) {
+                ++failedNotFeasible;
+                continue;
+            }
+
             // Inline row-hash verification: when a row becomes fully assigned,
             // immediately check its SHA-256 against the expected lateral hash.
             // This is the primary pruning mechanism for random data -- a hash
@@ -266,6 +286,13 @@ namespace crsce::decompress::solvers {
                 continue;
             }
 
+            // B.59g: complete the rows CRC-32 now determines, cascading through propagation
+            if (!pruner_->extend(frame.r, std::span<const Assignment>{forced.data(), forced.size()})) {
+                ++failedRowCompletion;
+                continue;
+            }
+            pruner_->observeDepth(stack.size());
+
             // Find the next unassigned cell
             const auto nextCell = brancher_->nextCell();
             if (!nextCell.has_value()) {
@@ -303,6 +330,10 @@ namespace crsce::decompress::solvers {
                  {"avg_iter_per_sec", std::to_string(static_cast<std::uint64_t>(avgRate))},
                  {"failed_not_feasible", std::to_string(failedNotFeasible)},
                  {"failed_hash_mismatch", std::to_string(failedHashMismatch)},
+                 {"failed_row_completion", std::to_string(failedRowCompletion)},
+                 {"crc_forced_cells", std::to_string(pruner_->crcForcedCells())},
+                 {"stall_probes", std::to_string(pruner_->stallProbes())},
+                 {"stall_prunes", std::to_string(pruner_->stallPrunes())},
                  {"candidates_submitted", std::to_string(candidatesSubmitted)}});
         }
 
@@ -0,0 +1,64 @@
+/**
+ * @file EnumerationController_expandLex.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::expandLex -- feasible children of a lex search node.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "decompress/Solvers/LexPrefix.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name expandLex
+     * @brief Children of a search node, in enumeration order.
+     * @param node Node to expand (must not be a leaf).
+     * @return Feasible children, earliest first; empty if the node is a dead end.
+     * @throws None
+     */
+    std::vector<LexPrefix> EnumerationController::expandLex(const LexPrefix &node) {
+        std::vector<LexPrefix> children;
+        const auto root = replay(node.path);
+        if (!root.has_value()) {
+            return children;
+        }
+
+        const auto cell = brancher_->nextCell();
+        if (!cell.has_value()) {
+            brancher_->undoToSavePoint(root.value());
+            children.push_back({.path = node.path, .leaf = true});
+            return children;
+        }
+
+        const std::array<std::uint8_t, 2> order = brancher_->branchOrder();
+        for (const auto v : order) {
+            const auto token = brancher_->saveUndoPoint();
+            if (tryAssign(cell->first, cell->second, v)) {
+                LexPrefix child{.path = node.path, .leaf = false};
+                child.path.push_back(v);
+                if (!brancher_->nextCell().has_value()) {
+                    // Complete: a solution only if every row passes (the AsyncHashPipeline check).
+                    bool verified = true;
+                    for (std::uint16_t r = 0; r < kS && verified; ++r) {
+                        verified = hasher_->verifyRow(r, store_->getRow(r));
+                    }
+                    child.leaf = verified;
+                    if (verified) {
+                        children.push_back(std::move(child));
+                    }
+                } else {
+                    children.push_back(std::move(child));
+                }
+            }
+            brancher_->undoToSavePoint(token);
+        }
+        brancher_->undoToSavePoint(root.value());
+        return children;
+    }
+
+} // namespace crsce::decompress::solvers
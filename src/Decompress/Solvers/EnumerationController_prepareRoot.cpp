@@ -0,0 +1,62 @@
+/**
+ * @file EnumerationController_prepareRoot.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::prepareRoot -- one-time initial propagation for rank/select walks.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "decompress/Solvers/LexPruner.h"
+#include "decompress/Solvers/LineID.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name prepareRoot
+     * @brief Run the initial propagation over every line once and record its forced cells.
+     *
+     * Same initial propagation and root pruning as enumerateSolutionsLex (6 line families, B.57,
+     * then LexPruner::prepareRoot). The forced cells stay recorded below every later save point,
+     * so walks that undo to their own save points keep returning to this root state.
+     *
+     * @return true if the root state is feasible.
+     * @throws None
+     */
+    bool EnumerationController::prepareRoot() {
+        if (rootFeasible_.has_value()) {
+            return rootFeasible_.value();
+        }
+
+        std::vector<LineID> allLines;
+        allLines.reserve(kS + kS + ((2 * kS) - 1) + ((2 * kS) - 1) + (2 * kS));
+        for (std::uint16_t i = 0; i < kS; ++i) {
+            allLines.push_back({.type = LineType::Row, .index = i});
+        }
+        for (std::uint16_t i = 0; i < kS; ++i) {
+            allLines.push_back({.type = LineType::Column, .index = i});
+        }
+        for (std::uint16_t i = 0; i < (2 * kS) - 1; ++i) {
+            allLines.push_back({.type = LineType::Diagonal, .index = i});
+        }
+        for (std::uint16_t i = 0; i < (2 * kS) - 1; ++i) {
+            allLines.push_back({.type = LineType::AntiDiagonal, .index = i});
+        }
+        for (std::uint16_t i = 0; i < kS; ++i) {
+            allLines.push_back({.type = LineType::LTP1, .index = i});
+        }
+        for (std::uint16_t i = 0; i < kS; ++i) {
+            allLines.push_back({.type = LineType::LTP2, .index = i});
+        }
+
+        (*propagator_).reset();
+        const bool feasible = propagator_->propagate(allLines);
+        for (const auto &a : propagator_->getForcedAssignments()) {
+            brancher_->recordAssignment(a.r, a.c);
+        }
+        rootFeasible_ = feasible && pruner_->prepareRoot();
+        return rootFeasible_.value();
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,107 @@
+/**
+ * @file EnumerationController_rankLex.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::rankLex -- rank a known solution by guided descent instead of enumeration.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/Csm/Csm.h"
+#include "common/O11y/O11y.h"
+#include "decompress/Solvers/IBranchingController.h"
+#include "decompress/Solvers/LexRank.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name rankLex
+     * @brief Position of a known solution in the enumerateSolutionsLex() order, without enumerating it.
+     *
+     * enumerateSolutionsLex() visits cells in nextCell() order and tries branchOrder()[0] before
+     * branchOrder()[1], so every solution it yields before the target diverges from the target at
+     * some branch cell by taking the earlier value. Following the target's bits from the root and
+     * counting only those earlier sibling subtrees gives the target's rank; later siblings, which
+     * full enumeration would also have to exhaust before reaching solution 256, are never touched.
+     *
+     * @param target The solution to rank (normally the compressor's original CSM).
+     * @param limit Largest rank the caller can encode.
+     * @param deadline Wall-clock limit for the walk.
+     * @return Found with the 0-based rank and the target's branch trail, or Overflow, NotFound, or TimedOut.
+     * @throws None
+     */
+    LexRank EnumerationController::rankLex(const crsce::common::Csm &target, const std::uint32_t limit,
+                                           const std::chrono::steady_clock::time_point deadline) {
+        if (!prepareRoot()) {
+            return {.outcome = LexRank::Outcome::NotFound, .rank = 0, .trail = {}};
+        }
+
+        const std::array<std::uint8_t, 2> order = brancher_->branchOrder();
+        std::vector<IBranchingController::UndoToken> path;
+        LexRank result{.outcome = LexRank::Outcome::NotFound, .rank = 0, .trail = {}};
+        std::uint64_t siblingsCounted = 0;
+
+        // Each iteration fixes one branch cell to the target's bit; the loop ends at a leaf
+        // (Found), on a dead end (NotFound), or once the count passes the limit.
+        bool walking = true;
+        while (walking) {
+            const auto cell = brancher_->nextCell();
+            if (!cell.has_value()) {
+                bool matches = true;
+                for (std::uint16_t r = 0; r < kS && matches; ++r) {
+                    matches = store_->getRow(r) == target.getRow(r);
+                }
+                if (matches) {
+                    result.outcome = LexRank::Outcome::Found;
+                }
+                break;
+            }
+            const auto [r, c] = cell.value();
+            const std::uint8_t want = target.get(r, c);
+
+            // Count the earlier sibling (if the target took the later branch).
+            if (order[0] != want) {
+                const auto token = brancher_->saveUndoPoint();
+                if (tryAssign(r, c, order[0])) {
+                    bool timedOut = false;
+                    result.rank += countSubtree(limit + 1 - result.rank, deadline, timedOut);
+                    ++siblingsCounted;
+                    if (timedOut) {
+                        result.outcome = LexRank::Outcome::TimedOut;
+                        walking = false;
+                    } else if (result.rank > limit) {
+                        result.outcome = LexRank::Outcome::Overflow;
+                        walking = false;
+                    }
+                }
+                brancher_->undoToSavePoint(token);
+                if (!walking) {
+                    break;
+                }
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                result.outcome = LexRank::Outcome::TimedOut;
+                break;
+            }
+
+            path.push_back(brancher_->saveUndoPoint());
+            result.trail.push_back(want);
+            walking = tryAssign(r, c, want);
+        }
+
+        ::crsce::o11y::O11y::instance().event("solver_rank_lex",
+            {{"depth", std::to_string(path.size())},
+             {"siblings_counted", std::to_string(siblingsCounted)},
+             {"rank", std::to_string(result.rank)}});
+
+        if (!path.empty()) {
+            brancher_->undoToSavePoint(path.front());
+        }
+        return result;
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,39 @@
+/**
+ * @file EnumerationController_replay.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::replay -- re-enter a lex search node from the root.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "decompress/Solvers/IBranchingController.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name replay
+     * @brief Re-enter a node from the root by assigning its path at successive branch cells.
+     * @param path Branch values, root first.
+     * @return Undo point to return to the root, or nullopt (state unchanged) if the path is infeasible.
+     * @throws None
+     */
+    std::optional<IBranchingController::UndoToken>
+    EnumerationController::replay(const std::vector<std::uint8_t> &path) {
+        if (!prepareRoot()) {
+            return std::nullopt;
+        }
+        const auto root = brancher_->saveUndoPoint();
+        for (const auto v : path) {
+            const auto cell = brancher_->nextCell();
+            if (!cell.has_value() || !tryAssign(cell->first, cell->second, v)) {
+                brancher_->undoToSavePoint(root);
+                return std::nullopt;
+            }
+        }
+        return root;
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,35 @@
+/**
+ * @file EnumerationController_solutionAt.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::solutionAt -- materialize the matrix of a lex search leaf.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <optional>
+
+#include "common/Csm/Csm.h"
+#include "decompress/Solvers/LexPrefix.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name solutionAt
+     * @brief Materialize the matrix of a leaf node.
+     * @param node A leaf returned by expandLex().
+     * @return The solution, or nullopt if the path does not replay to a complete assignment.
+     * @throws None
+     */
+    std::optional<crsce::common::Csm> EnumerationController::solutionAt(const LexPrefix &node) {
+        const auto root = replay(node.path);
+        if (!root.has_value()) {
+            return std::nullopt;
+        }
+        std::optional<crsce::common::Csm> csm;
+        if (!brancher_->nextCell().has_value()) {
+            csm = buildCsm();
+        }
+        brancher_->undoToSavePoint(root.value());
+        return csm;
+    }
+
+} // namespace crsce::decompress::solvers
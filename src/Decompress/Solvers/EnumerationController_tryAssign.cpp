@@ -0,0 +1,69 @@
+/**
+ * @file EnumerationController_tryAssign.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief EnumerationController::tryAssign -- one DFS step: assign, propagate, verify completed rows.
+ */
+#include "decompress/Solvers/EnumerationController.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/LexPruner.h"
+#include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/PropagationEngine.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name tryAssign
+     * @brief Assign one branch cell, propagate, and verify every row the assignment completes.
+     * @param r Row of the branch cell.
+     * @param c Column of the branch cell.
+     * @param v Value to assign (0 or 1).
+     * @return false if propagation is infeasible, a completed row fails its hash, or CRC-32
+     *         row completion finds a contradiction.
+     * @throws None
+     */
+    bool EnumerationController::tryAssign(const std::uint16_t r, const std::uint16_t c, const std::uint8_t v) {
+        auto &cs = static_cast<ConstraintStore &>(*store_); // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+        auto *cpuProp = dynamic_cast<PropagationEngine *>(propagator_.get());
+
+        cs.assign(r, c, v);
+        brancher_->recordAssignment(r, c);
+
+        bool feasible = false;
+        if (cpuProp != nullptr) {
+            feasible = cpuProp->tryPropagateCell(r, c);
+        } else {
+            const auto lines = cs.getLinesForCell(r, c);
+            (*propagator_).reset();
+            feasible = propagator_->propagate(
+                std::span<const LineID>{lines.lines.data(), static_cast<std::size_t>(lines.count)});
+        }
+        // A failed propagate() may already have forced some cells; record them so the caller's
+        // undo removes them along with the branch cell.
+        const auto &forced = (cpuProp != nullptr)
+            ? cpuProp->getForcedAssignments()
+            : propagator_->getForcedAssignments();
+        for (const auto &a : forced) {
+            brancher_->recordAssignment(a.r, a.c);
+        }
+        if (!feasible) {
+            return false;
+        }
+
+        if (cs.getStatDirect(r).unknown == 0 && !hasher_->verifyRow(r, cs.getRow(r))) {
+            return false;
+        }
+        for (const auto &a : forced) {
+            if (a.r != r && cs.getStatDirect(a.r).unknown == 0 && !hasher_->verifyRow(a.r, cs.getRow(a.r))) {
+                return false;
+            }
+        }
+        return pruner_->extend(r, std::span<const Assignment>{forced.data(), forced.size()});
+    }
+
+} // namespace crsce::decompress::solvers
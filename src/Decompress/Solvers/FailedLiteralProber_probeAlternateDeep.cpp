@@ -48,16 +48,17 @@ namespace crsce::decompress::solvers {
         brancher_.recordAssignment(r, c);
 
         // 3. Propagate
-        if (!propagator_.tryPropagateCell(r, c)) {
-            brancher_.undoToSavePoint(token);
-            return false;
-        }
+        const bool propagated = propagator_.tryPropagateCell(r, c);
 
-        // 4. Record forced assignments
+        // 4. Record forced assignments (including any made before a contradiction)
         const auto &forced = propagator_.getForcedAssignments();
         for (const auto &a : forced) {
             brancher_.recordAssignment(a.r, a.c);
         }
+        if (!propagated) {
+            brancher_.undoToSavePoint(token);
+            return false;
+        }
 
         // 5. Hash-check completed rows
         if (store_.getStatDirect(r).unknown == 0) {
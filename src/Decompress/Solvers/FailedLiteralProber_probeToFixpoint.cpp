@@ -64,6 +64,13 @@ namespace crsce::decompress::solvers {
 
                         // Propagate the forced assignment
                         const bool feasible = propagator_.tryPropagateCell(r, c);
+
+                        // Record forced assignments from propagation on undo stack, even on
+                        // contradiction, so the caller's undo removes every cell assigned here
+                        const auto &forced = propagator_.getForcedAssignments();
+                        for (const auto &a : forced) {
+                            brancher_.recordAssignment(a.r, a.c);
+                        }
                         if (!feasible) {
                             ::crsce::o11y::O11y::instance().event("prober_contradiction",
                                 {{"round", std::to_string(round)},
@@ -72,12 +79,6 @@ namespace crsce::decompress::solvers {
                             return -1;
                         }
 
-                        // Record forced assignments from propagation on undo stack
-                        const auto &forced = propagator_.getForcedAssignments();
-                        for (const auto &a : forced) {
-                            brancher_.recordAssignment(a.r, a.c);
-                        }
-
                         ++passForced;
                         ++totalForced;
                         madeProgress = true;
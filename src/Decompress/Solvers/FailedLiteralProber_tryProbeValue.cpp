@@ -40,16 +40,17 @@ namespace crsce::decompress::solvers {
 
         // 3. Propagate
         const bool feasible = propagator_.tryPropagateCell(r, c);
-        if (!feasible) {
-            brancher_.undoToSavePoint(token);
-            return false;
-        }
 
-        // 4. Record forced assignments on undo stack
+        // 4. Record forced assignments on undo stack (a failed propagation may already
+        //    have forced some cells; the undo below must remove them too)
         const auto &forced = propagator_.getForcedAssignments();
         for (const auto &a : forced) {
             brancher_.recordAssignment(a.r, a.c);
         }
+        if (!feasible) {
+            brancher_.undoToSavePoint(token);
+            return false;
+        }
 
         // 5. Hash-check completed rows
         bool hashOk = true;
@@ -0,0 +1,180 @@
+/**
+ * @file ForcedBlock.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief solveForced() -- build blocks that initial propagation fully determines, without the solver.
+ */
+#include "decompress/Solvers/ForcedBlock.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "common/BlockHash/BlockHash.h"
+#include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+#include "decompress/Solvers/BlockPadding.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/PropagationEngine.h"
+#include "decompress/Solvers/Sha1HashVerifier.h"
+
+namespace crsce::decompress::solvers {
+
+    namespace {
+        constexpr std::uint16_t kS = common::Csm::kS;
+        constexpr std::uint16_t kDiagCount = (2 * kS) - 1;
+
+        /**
+         * @name saturated
+         * @brief True if every sum is 0 or kS.
+         */
+        bool saturated(const std::vector<std::uint16_t> &sums) {
+            return std::ranges::all_of(sums, [](const std::uint16_t s) { return s == 0 || s == kS; });
+        }
+
+        /**
+         * @name kFullRow
+         * @brief Row words with bits 0..kS-1 set (MSB-first, as Csm::getRow).
+         */
+        constexpr std::array<std::uint64_t, 2> kFullRow{~std::uint64_t{0}, ~std::uint64_t{0} << 1U};
+
+        /**
+         * @name fromSaturatedFamily
+         * @brief Build the block from the row sums when every one is 0 or kS, or from the column
+         *        sums when every one is, checking the other family against it.
+         * @details A sufficient condition (constant and row- or column-striped blocks) that needs
+         *          no ConstraintStore, so it is tried before propagation.
+         * @return The block, or nullopt if neither family is saturated or the other disagrees.
+         */
+        std::optional<common::Csm> fromSaturatedFamily(const std::vector<std::uint16_t> &lsm,
+                                                       const std::vector<std::uint16_t> &vsm) {
+            common::Csm csm;
+            if (saturated(lsm)) {
+                // Each row is all zeros or all ones; every column then holds the number of full rows.
+                const auto fullRows = static_cast<std::uint16_t>(std::ranges::count(lsm, kS));
+                if (!std::ranges::all_of(vsm, [fullRows](const std::uint16_t s) { return s == fullRows; })) {
+                    return std::nullopt;
+                }
+                for (std::uint16_t r = 0; r < kS; ++r) {
+                    if (lsm[r] == kS) {
+                        csm.setRow(r, kFullRow);
+                    }
+                }
+                return csm;
+            }
+            if (saturated(vsm)) {
+                // Every row is the same: the mask of full columns.
+                std::array<std::uint64_t, 2> row{};
+                std::uint16_t fullCols = 0;
+                for (std::uint16_t c = 0; c < kS; ++c) {
+                    if (vsm[c] == kS) {
+                        row[c / 64U] |= std::uint64_t{1} << (63U - (c % 64U)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                        ++fullCols;
+                    }
+                }
+                if (!std::ranges::all_of(lsm, [fullCols](const std::uint16_t s) { return s == fullCols; })) {
+                    return std::nullopt;
+                }
+                for (std::uint16_t r = 0; r < kS; ++r) {
+                    csm.setRow(r, row);
+                }
+                return csm;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @name fromPropagation
+         * @brief Build the solver's ConstraintStore (padding included), propagate every line once,
+         *        and read the block off it if no cell is left unassigned.
+         * @return The block, or nullopt if cells stay open or the sums contradict each other.
+         */
+        std::optional<common::Csm> fromPropagation(const common::format::CompressedPayloadView &payload,
+                                                   const std::vector<std::uint16_t> &lsm,
+                                                   const std::vector<std::uint16_t> &vsm,
+                                                   const std::uint32_t validBits,
+                                                   const common::csmlayout::Layout layout) {
+            std::vector<std::uint16_t> dsm;
+            std::vector<std::uint16_t> xsm;
+            std::vector<std::uint16_t> ltp1;
+            std::vector<std::uint16_t> ltp2;
+            payload.unpackDSM(dsm);
+            payload.unpackXSM(xsm);
+            payload.unpackLTP1SM(ltp1);
+            payload.unpackLTP2SM(ltp2);
+            const std::vector<std::uint16_t> ltp3, ltp4, ltp5, ltp6;
+            ConstraintStore store(lsm, vsm, dsm, xsm, ltp1, ltp2, ltp3, ltp4, ltp5, ltp6);
+            static_cast<void>(assignPadding(store, validBits, layout));
+
+            // One pass over every line, as the solver's initial propagation does before branching.
+            std::vector<LineID> allLines;
+            allLines.reserve((4 * kS) + (2 * kDiagCount));
+            for (const auto type : {LineType::Row, LineType::Column, LineType::LTP1, LineType::LTP2}) {
+                for (std::uint16_t i = 0; i < kS; ++i) {
+                    allLines.push_back({.type = type, .index = i});
+                }
+            }
+            for (const auto type : {LineType::Diagonal, LineType::AntiDiagonal}) {
+                for (std::uint16_t i = 0; i < kDiagCount; ++i) {
+                    allLines.push_back({.type = type, .index = i});
+                }
+            }
+            PropagationEngine propagator(store);
+            if (!propagator.propagate(allLines)) {
+                return std::nullopt;
+            }
+
+            common::Csm csm;
+            for (std::uint16_t r = 0; r < kS; ++r) {
+                if (store.getRowUnknownCount(r) != 0) {
+                    return std::nullopt;
+                }
+                csm.setRow(r, store.getRow(r));
+            }
+            return csm;
+        }
+    } // namespace
+
+    /**
+     * @name solveForced
+     * @brief Build a block directly when propagating its cross-sums once assigns every cell.
+     * @param payload View over the block's serialized payload.
+     * @param validBits Data bits in the block; the padding after them is assigned 0 first.
+     * @param layout Layout of the block, which locates the padding cells.
+     * @return The block, or nullopt if propagation leaves it open (or it fails the checks).
+     * @throws None
+     */
+    std::optional<common::Csm> solveForced(const common::format::CompressedPayloadView &payload,
+                                           const std::uint32_t validBits,
+                                           const common::csmlayout::Layout layout) {
+        std::vector<std::uint16_t> lsm;
+        std::vector<std::uint16_t> vsm;
+        payload.unpackLSM(lsm);
+        payload.unpackVSM(vsm);
+        auto csm = fromSaturatedFamily(lsm, vsm);
+        if (!csm) {
+            csm = fromPropagation(payload, lsm, vsm, validBits, layout);
+        }
+        if (!csm) {
+            return std::nullopt;
+        }
+
+        // Lateral hashes (the first kLHDigestBytes bytes of the verifier's digest), then BH.
+        const Sha1HashVerifier hasher(kS);
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            const auto digest = hasher.computeHash(csm->getRow(r));
+            const auto expected = payload.lh(r);
+            if (!std::equal(expected.begin(), expected.end(), digest.begin())) {
+                return std::nullopt;
+            }
+        }
+        if (!common::BlockHash::verify(csm.value(), payload.getBH())) {
+            return std::nullopt;
+        }
+        return csm;
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,86 @@
+/**
+ * @file LexPruner_completeRow.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief LexPruner::completeRow -- CRC-32 completion of one row with its propagation.
+ */
+#include "decompress/Solvers/LexPruner.h"
+
+#include <cstdint>
+
+#include "decompress/Solvers/CellState.h"
+#include "decompress/Solvers/Crc32RowCompleter.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name completeRow
+     * @brief Complete one row via CRC-32 if it has 1..32 unknowns; queue the rows it touches.
+     *
+     * Only a unique completion is applied (an infeasible result is exhaustive, so it always
+     * prunes). Each determined cell is assigned and propagated like a branch cell. Propagation of an
+     * earlier cell may already have assigned a later one: an equal value is skipped, a
+     * different value is a contradiction.
+     *
+     * @param r Row index.
+     * @return false on contradiction.
+     * @throws None
+     */
+    bool LexPruner::completeRow(const std::uint16_t r) {
+        if (completer_ == nullptr) {
+            return true;
+        }
+        const auto unknown = store_.getStatDirect(r).unknown;
+        if (unknown == 0 || unknown > Crc32RowCompleter::kThreshold) {
+            return true;
+        }
+
+        const auto result = completer_->tryCompleteRow(r, store_);
+        if (!result.feasible) {
+            ++crcPrunes_;
+            return false;
+        }
+        // With free variables the completer picks one candidate; forcing it could skip a solution
+        if (result.freeVariables != 0) {
+            return true;
+        }
+
+        for (std::uint8_t i = 0; i < result.numAssigned; ++i) {
+            const auto [c, v] = result.assignments[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            if (store_.getCellState(r, c) != CellState::Unassigned) {
+                if (store_.getCellValue(r, c) != v) {
+                    ++crcPrunes_;
+                    return false;
+                }
+                continue;
+            }
+
+            store_.assign(r, c, v);
+            brancher_.recordAssignment(r, c);
+            ++crcForcedCells_;
+
+            const bool feasible = propagator_.tryPropagateCell(r, c);
+            const auto &forced = propagator_.getForcedAssignments();
+            for (const auto &a : forced) {
+                brancher_.recordAssignment(a.r, a.c);
+            }
+            if (!feasible) {
+                return false;
+            }
+            for (const auto &a : forced) {
+                if (a.r == r) {
+                    continue;
+                }
+                if (store_.getStatDirect(a.r).unknown == 0) {
+                    if (!hasher_.verifyRow(a.r, store_.getRow(a.r))) {
+                        return false;
+                    }
+                } else {
+                    rows_.push_back(a.r);
+                }
+            }
+        }
+
+        return store_.getStatDirect(r).unknown != 0 || hasher_.verifyRow(r, store_.getRow(r));
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,31 @@
+/**
+ * @file LexPruner_ctor.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief LexPruner constructor implementation.
+ */
+#include "decompress/Solvers/LexPruner.h"
+
+#include "decompress/Solvers/BranchingController.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/IHashVerifier.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name LexPruner
+     * @brief Construct a pruner over an enumeration controller's components.
+     * @param store Constraint store (must outlive this pruner).
+     * @param brancher Branching controller holding the undo stack (must outlive this pruner).
+     * @param hasher Row hash verifier.
+     * @throws None
+     */
+    LexPruner::LexPruner(ConstraintStore &store, BranchingController &brancher, IHashVerifier &hasher)
+        : store_(store),
+          brancher_(brancher),
+          hasher_(hasher),
+          propagator_(store),
+          prober_(store, propagator_, brancher, hasher) {
+        rows_.reserve(kS);
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,54 @@
+/**
+ * @file LexPruner_extend.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief LexPruner::extend and drainRows -- cascade CRC-32 row completion after one DFS step.
+ */
+#include "decompress/Solvers/LexPruner.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "decompress/Solvers/IPropagationEngine.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name extend
+     * @brief Apply CRC-32 row completion to the rows touched by one DFS step, cascading.
+     * @param r Row of the branch cell.
+     * @param forced Cells the step's propagation forced.
+     * @return false if a touched row has no completion or a completion leads to a contradiction.
+     * @throws None
+     */
+    bool LexPruner::extend(const std::uint16_t r, const std::span<const Assignment> forced) {
+        if (completer_ == nullptr) {
+            return true;
+        }
+        rows_.clear();
+        rows_.push_back(r);
+        for (const auto &a : forced) {
+            if (a.r != r) {
+                rows_.push_back(a.r);
+            }
+        }
+        return drainRows();
+    }
+
+    /**
+     * @name drainRows
+     * @brief Run completeRow over rows_ until no queued row is left.
+     * @return false on contradiction.
+     * @throws None
+     */
+    bool LexPruner::drainRows() {
+        // completeRow() appends to rows_, so walk it by index
+        for (std::size_t i = 0; i < rows_.size(); ++i) {
+            if (!completeRow(rows_[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace crsce::decompress::solvers
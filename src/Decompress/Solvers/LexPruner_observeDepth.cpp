@@ -0,0 +1,46 @@
+/**
+ * @file LexPruner_observeDepth.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief LexPruner::observeDepth and admits -- StallDetector-driven lookahead.
+ */
+#include "decompress/Solvers/LexPruner.h"
+
+#include <cstdint>
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name observeDepth
+     * @brief Feed the DFS depth after a successful step to the StallDetector.
+     * @param depth Current DFS stack depth.
+     * @return void
+     * @throws None
+     */
+    void LexPruner::observeDepth(const std::uint64_t depth) {
+        detector_.update(depth);
+    }
+
+    /**
+     * @name admits
+     * @brief Stall-time lookahead: is value v of (r, c) feasible k levels deep?
+     * @param r Row of the branch cell.
+     * @param c Column of the branch cell.
+     * @param v Value about to be tried.
+     * @return false if v is proven infeasible.
+     * @throws None
+     */
+    bool LexPruner::admits(const std::uint16_t r, const std::uint16_t c, const std::uint8_t v) {
+        // Depth 1 is the branch step itself; only an escalated detector adds lookahead
+        const auto k = detector_.currentK();
+        if (k <= 1) {
+            return true;
+        }
+        ++stallProbes_;
+        if (prober_.probeAlternateDeep(r, c, v, k)) {
+            return true;
+        }
+        ++stallPrunes_;
+        return false;
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,63 @@
+/**
+ * @file LexPruner_prepareRoot.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief LexPruner::prepareRoot -- root-level CRC-32 completion and failed-literal probing.
+ */
+#include "decompress/Solvers/LexPruner.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "decompress/Solvers/Crc32RowCompleter.h"
+#include "decompress/Solvers/Sha1HashVerifier.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name prepareRoot
+     * @brief Complete every row CRC-32 can determine, then probe to fixpoint.
+     *
+     * The CRC-32 table is read from the hasher here rather than in the constructor so that
+     * digests set after construction are honoured. Every row completed here is hash-checked
+     * (by completeRow, or by the prober before it forces a value).
+     *
+     * @return false if the root has no solution.
+     * @throws None
+     */
+    bool LexPruner::prepareRoot() {
+        // B.59g: the lateral hash is CRC-32; recover the expected values from the 4-byte digests
+        if (const auto *crcHasher = dynamic_cast<const Sha1HashVerifier *>(&hasher_); crcHasher != nullptr) {
+            std::array<std::uint32_t, kS> expectedCrcs{};
+            for (std::uint16_t r = 0; r < kS; ++r) {
+                const auto &digest = crcHasher->getExpected(r);
+                expectedCrcs[r] = (static_cast<std::uint32_t>(digest[0]) << 24U) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                                | (static_cast<std::uint32_t>(digest[1]) << 16U) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                                | (static_cast<std::uint32_t>(digest[2]) << 8U)  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                                | static_cast<std::uint32_t>(digest[3]);          // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+            completer_ = std::make_unique<Crc32RowCompleter>(expectedCrcs);
+        }
+
+        rows_.clear();
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            rows_.push_back(r);
+        }
+        if (!drainRows()) {
+            return false;
+        }
+
+        // B.42: probing forces every cell whose other value fails propagation or a row hash
+        if (prober_.probeToFixpoint() < 0) {
+            return false;
+        }
+
+        // Probing may have enabled further completions
+        rows_.clear();
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            rows_.push_back(r);
+        }
+        return drainRows();
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,54 @@
+/**
+ * @file LineMaskTable.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief lineMaskTable() -- per-line membership masks, built from cellLineTable().
+ */
+#include "decompress/Solvers/LineMaskTable.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "decompress/Solvers/CellLineTable.h"
+#include "decompress/Solvers/LtpTable.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name lineMaskTable
+     * @brief The process-wide line-mask table, built from cellLineTable() on first use.
+     * @return Pointer to kCellLineNone masks.
+     * @throws None
+     */
+    const LineMask *lineMaskTable() {
+        static std::array<LineMask, kCellLineNone> table{};
+        static const bool filled = [] {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+            for (auto &mask : table) {
+                mask.rowLo = kLtpS - 1;
+                mask.rowHi = 0;
+            }
+            const auto *cells = cellLineTable();
+            for (std::uint16_t r = 0; r < kLtpS; ++r) {
+                for (std::uint16_t c = 0; c < kLtpS; ++c) {
+                    const auto &entry = cells[(static_cast<std::size_t>(r) * kLtpS) + c]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    for (std::uint8_t j = 0; j < entry.count; ++j) {
+                        auto &mask = table[entry.flat[j]];
+                        mask.words[r][c / 64U] |= std::uint64_t{1} << (c % 64U);
+                        if (r < mask.rowLo) {
+                            mask.rowLo = static_cast<std::uint8_t>(r);
+                        }
+                        if (r > mask.rowHi) {
+                            mask.rowHi = static_cast<std::uint8_t>(r);
+                        }
+                    }
+                }
+            }
+            // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+            return true;
+        }();
+        static_cast<void>(filled);
+        return table.data();
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,80 @@
+/**
+ * @file ParallelLexSelector_countFrontier.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ParallelLexSelector::countFrontier -- count prefix subtrees on the worker threads.
+ */
+#include "decompress/Solvers/ParallelLexSelector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "decompress/Solvers/LexPrefix.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name countFrontier
+     * @brief Count each prefix's solutions (capped at budget) on the worker threads.
+     *
+     * Workers claim prefixes in order. Once the counts of a contiguous run from the start
+     * reach the budget, the prefix holding solution k is known and later prefixes are skipped.
+     *
+     * @param frontier Prefixes in enumeration order.
+     * @param budget Cap per prefix; counting also stops for prefixes past the one where the
+     *               running total first reaches budget.
+     * @return Counts aligned with frontier (0 for skipped prefixes).
+     * @throws None
+     */
+    std::vector<std::uint32_t> ParallelLexSelector::countFrontier(const std::vector<LexPrefix> &frontier,
+                                                                  const std::uint32_t budget) {
+        std::vector<std::uint32_t> counts(frontier.size(), 0);
+        std::vector<bool> done(frontier.size(), false);
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> cutoff{frontier.size()};
+        std::mutex mtx;
+        std::size_t settled = 0;       // done[0..settled) are all complete
+        std::uint64_t settledSum = 0;  // sum of counts[0..settled)
+
+        const auto work = [&](EnumerationController &controller) {
+            while (true) {
+                const auto i = next.fetch_add(1);
+                if (i >= frontier.size() || i > cutoff.load()) {
+                    return;
+                }
+                const auto n = controller.countLex(frontier[i], budget);
+
+                const std::scoped_lock lock(mtx);
+                counts[i] = n;
+                done[i] = true;
+                while (settled < frontier.size() && done[settled]) {
+                    settledSum += counts[settled];
+                    if (settledSum >= budget) {
+                        cutoff = std::min(cutoff.load(), settled);
+                    }
+                    ++settled;
+                }
+            }
+        };
+
+        const auto n = std::min(workers_.size(), frontier.size());
+        std::vector<std::thread> pool;
+        pool.reserve(n > 0 ? n - 1 : 0);
+        for (std::size_t t = 1; t < n; ++t) {
+            pool.emplace_back(work, std::ref(*workers_[t])); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        if (n > 0) {
+            work(*workers_.front());
+        }
+        for (auto &th : pool) {
+            th.join();
+        }
+        return counts;
+    }
+
+} // namespace crsce::decompress::solvers
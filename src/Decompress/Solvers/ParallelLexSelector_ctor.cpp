@@ -0,0 +1,28 @@
+/**
+ * @file ParallelLexSelector_ctor.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ParallelLexSelector constructor.
+ */
+#include "decompress/Solvers/ParallelLexSelector.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name ParallelLexSelector
+     * @brief Build one controller per worker.
+     * @param factory Controller factory (called `threads` times).
+     * @param threads Number of counting workers (clamped to at least 1).
+     * @throws None
+     */
+    ParallelLexSelector::ParallelLexSelector(const ControllerFactory &factory, const std::uint32_t threads) {
+        const auto n = std::max<std::uint32_t>(threads, 1);
+        workers_.reserve(n);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            workers_.push_back(factory());
+        }
+    }
+
+} // namespace crsce::decompress::solvers
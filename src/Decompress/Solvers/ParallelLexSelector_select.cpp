@@ -0,0 +1,60 @@
+/**
+ * @file ParallelLexSelector_select.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ParallelLexSelector::select -- descend to the k-th lex-order solution.
+ */
+#include "decompress/Solvers/ParallelLexSelector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "common/Csm/Csm.h"
+#include "common/O11y/O11y.h"
+#include "decompress/Solvers/LexPrefix.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name select
+     * @brief Return the k-th (0-based) solution in enumerateSolutionsLex() order.
+     * @param k Solution index (the block's DI).
+     * @return The solution, or nullopt if there are k or fewer solutions.
+     * @throws None
+     */
+    std::optional<crsce::common::Csm> ParallelLexSelector::select(const std::uint32_t k) {
+        LexPrefix node;
+        std::uint32_t remaining = k;
+        std::uint64_t rounds = 0;
+
+        while (!node.leaf) {
+            ++rounds;
+            auto frontier = split(node);
+            const auto counts = countFrontier(frontier, remaining + 1);
+
+            // Move into the prefix whose subtree holds solution `remaining`.
+            std::optional<std::size_t> chosen;
+            for (std::size_t i = 0; i < frontier.size(); ++i) {
+                if (counts[i] > remaining) { // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    chosen = i;
+                    break;
+                }
+                remaining -= counts[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+            if (!chosen.has_value()) {
+                return std::nullopt;
+            }
+            node = std::move(frontier[chosen.value()]);
+        }
+
+        ::crsce::o11y::O11y::instance().event("solver_parallel_select",
+            {{"k", std::to_string(k)},
+             {"rounds", std::to_string(rounds)},
+             {"depth", std::to_string(node.path.size())},
+             {"threads", std::to_string(workers_.size())}});
+        return workers_.front()->solutionAt(node);
+    }
+
+} // namespace crsce::decompress::solvers
@@ -0,0 +1,47 @@
+/**
+ * @file ParallelLexSelector_split.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief ParallelLexSelector::split -- widen one subtree into an ordered frontier of prefixes.
+ */
+#include "decompress/Solvers/ParallelLexSelector.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "decompress/Solvers/LexPrefix.h"
+
+namespace crsce::decompress::solvers {
+
+    /**
+     * @name split
+     * @brief Expand a node level by level until the frontier is wide enough or all leaves.
+     * @param node Subtree to split.
+     * @return Frontier in enumeration order (empty if the subtree has no solution).
+     * @throws None
+     */
+    std::vector<LexPrefix> ParallelLexSelector::split(const LexPrefix &node) {
+        auto &expander = *workers_.front();
+        const auto target = workers_.size() * kPrefixesPerWorker;
+
+        // Always take at least one level so every round moves deeper.
+        std::vector<LexPrefix> frontier = expander.expandLex(node);
+        while (frontier.size() < target &&
+               std::ranges::any_of(frontier, [](const LexPrefix &p) { return !p.leaf; })) {
+            std::vector<LexPrefix> next;
+            next.reserve(2 * frontier.size());
+            for (auto &p : frontier) {
+                if (p.leaf) {
+                    next.push_back(std::move(p));
+                    continue;
+                }
+                for (auto &child : expander.expandLex(p)) {
+                    next.push_back(std::move(child));
+                }
+            }
+            frontier = std::move(next);
+        }
+        return frontier;
+    }
+
+} // namespace crsce::decompress::solvers
@@ -9,9 +9,7 @@
 #include <cstdint>
 #include <vector>
 
-#include "decompress/Solvers/CellState.h"
 #include "decompress/Solvers/ConstraintStore.h"
-#include "decompress/Solvers/LtpTable.h"
 
 namespace crsce::decompress::solvers {
 
@@ -27,30 +25,22 @@ namespace crsce::decompress::solvers {
      * @throws None
      */
     auto ProbabilityEstimator::computeGlobalCellScores() const -> std::vector<CellScore> {
-        static constexpr std::uint16_t kNumDiags = (2 * kS) - 1;
         static constexpr std::uint32_t kMaxCells = static_cast<std::uint32_t>(kS) * kS;
 
         std::vector<CellScore> scores;
         scores.reserve(kMaxCells);
 
         for (std::uint16_t r = 0; r < kS; ++r) {
-            for (std::uint16_t c = 0; c < kS; ++c) {
-                if (store_.getCellState(r, c) != CellState::Unassigned) {
-                    continue;
-                }
-
-                // Flat stat indices for the 3 basic non-row lines
-                const auto ci = static_cast<std::uint32_t>(kS) + c;
-                const auto di = (2U * kS) + static_cast<std::uint32_t>(c - r + (kS - 1));
-                const auto xi = (2U * kS) + kNumDiags + static_cast<std::uint32_t>(r + c);
-
-                // B.21: 1 or 2 LTP lines
-                const auto &mem = ltpMembership(r, c);
+            store_.forEachUnassignedInRow(r, [&](const std::uint16_t c) {
+                // Flat stat indices of the column, diagonal, anti-diagonal and LTP lines (CellLineTable)
+                const auto &lines = store_.cellLines(r, c);
 
-                const auto &colStat  = store_.getStatDirect(ci);
-                const auto &diagStat = store_.getStatDirect(di);
-                const auto &antiStat = store_.getStatDirect(xi);
-                const auto &l0Stat   = store_.getStatDirect(static_cast<std::uint32_t>(mem.flat[0])); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+                const auto &colStat  = store_.getStatDirect(lines.flat[1]);
+                const auto &diagStat = store_.getStatDirect(lines.flat[2]);
+                const auto &antiStat = store_.getStatDirect(lines.flat[3]);
+                const auto &l0Stat   = store_.getStatDirect(lines.flat[4]);
+                // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
 
                 const auto rhoCol  = static_cast<std::uint64_t>(colStat.target  - colStat.assigned);
                 const auto rhoDiag = static_cast<std::uint64_t>(diagStat.target - diagStat.assigned);
@@ -65,8 +55,8 @@ namespace crsce::decompress::solvers {
                 std::uint64_t s1 = rhoCol * rhoDiag * rhoAnti * rhoL0;
                 std::uint64_t s0 = (uCol - rhoCol) * (uDiag - rhoDiag) * (uAnti - rhoAnti) * (uL0 - rhoL0);
 
-                if (mem.count > 1) {
-                    const auto &l1Stat = store_.getStatDirect(static_cast<std::uint32_t>(mem.flat[1])); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                if (lines.count > 5) {
+                    const auto &l1Stat = store_.getStatDirect(lines.flat[5]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
                     const auto rhoL1   = static_cast<std::uint64_t>(l1Stat.target - l1Stat.assigned);
                     const auto uL1     = static_cast<std::uint64_t>(l1Stat.unknown);
                     s1 *= rhoL1;
@@ -77,7 +67,7 @@ namespace crsce::decompress::solvers {
                 const std::uint64_t confidence = (s1 > s0) ? (s1 - s0) : (s0 - s1);
 
                 scores.push_back({r, c, s1, s0, preferred, confidence});
-            }
+            });
         }
 
         std::ranges::sort(scores, [](const CellScore &a, const CellScore &b) {
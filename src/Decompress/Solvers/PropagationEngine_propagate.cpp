@@ -5,118 +5,15 @@
  */
 #include "decompress/Solvers/PropagationEngine.h"
 
-#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 #include <utility>
 
-#include "decompress/Solvers/CellState.h"
 #include "decompress/Solvers/ConstraintStore.h"
 #include "decompress/Solvers/LineID.h"
-#include "decompress/Solvers/LtpTable.h"
 
 namespace crsce::decompress::solvers {
-    namespace {
-        /**
-         * @name forEachCellOnLine
-         * @brief Invoke callback(r, c) for every cell on the given line, with zero allocation.
-         * @param line The line identifier.
-         * @param kS Matrix dimension.
-         * @param callback Invoked with (uint16_t r, uint16_t c) for each cell.
-         */
-        template<typename Func>
-        void forEachCellOnLine(const LineID line, const std::uint16_t kS, const Func &callback) {
-            switch (line.type) {
-                case LineType::Row:
-                    for (std::uint16_t c = 0; c < kS; ++c) {
-                        callback(line.index, c);
-                    }
-                    break;
-
-                case LineType::Column:
-                    for (std::uint16_t r = 0; r < kS; ++r) {
-                        callback(r, line.index);
-                    }
-                    break;
-
-                case LineType::Diagonal: {
-                    const auto d = static_cast<std::int32_t>(line.index);
-                    const auto offset = d - static_cast<std::int32_t>(kS - 1);
-                    const auto rMin = static_cast<std::uint16_t>(std::max(0, -offset));
-                    const auto rMax = static_cast<std::uint16_t>(
-                        std::min(static_cast<int>(kS) - 1, static_cast<int>(kS) - 1 - offset));
-                    for (auto r = rMin; r <= rMax; ++r) {
-                        const auto c = static_cast<std::uint16_t>(r + offset);
-                        if (c < kS) {
-                            callback(r, c);
-                        }
-                    }
-                    break;
-                }
-
-                case LineType::AntiDiagonal: {
-                    const auto x = static_cast<std::int32_t>(line.index);
-                    const auto rMin = static_cast<std::uint16_t>(std::max(0, x - static_cast<int>(kS) + 1));
-                    const auto rMax = static_cast<std::uint16_t>(std::min(x, static_cast<int>(kS) - 1));
-                    for (auto r = rMin; r <= rMax; ++r) {
-                        const auto c = static_cast<std::uint16_t>(x - r);
-                        callback(r, c);
-                    }
-                    break;
-                }
-
-                case LineType::LTP1: {
-                    const auto &cells = ltp1CellsForLine(line.index);
-                    for (const auto &cell : cells) {
-                        callback(cell.r, cell.c);
-                    }
-                    break;
-                }
-
-                case LineType::LTP2: {
-                    const auto &cells = ltp2CellsForLine(line.index);
-                    for (const auto &cell : cells) {
-                        callback(cell.r, cell.c);
-                    }
-                    break;
-                }
-
-                case LineType::LTP3: {
-                    const auto &cells = ltp3CellsForLine(line.index);
-                    for (const auto &cell : cells) {
-                        callback(cell.r, cell.c);
-                    }
-                    break;
-                }
-
-                case LineType::LTP4: {
-                    const auto &cells = ltp4CellsForLine(line.index);
-                    for (const auto &cell : cells) {
-                        callback(cell.r, cell.c);
-                    }
-                    break;
-                }
-
-                case LineType::LTP5: {
-                    const auto &cells = ltp5CellsForLine(line.index);
-                    for (const auto &cell : cells) {
-                        callback(cell.r, cell.c);
-                    }
-                    break;
-                }
-
-                case LineType::LTP6: {
-                    const auto &cells = ltp6CellsForLine(line.index);
-                    for (const auto &cell : cells) {
-                        callback(cell.r, cell.c);
-                    }
-                    break;
-                }
-            }
-        }
-    } // anonymous namespace
-
     /**
      * @name propagate
      * @brief Propagate constraints from a queue of affected lines until quiescence or infeasibility.
@@ -137,15 +34,29 @@ namespace crsce::decompress::solvers {
             markQueued(ConstraintStore::lineIndex(line));
         }
 
+        // Lines assign() flagged as forcing or in conflict join the queue; others never need a look.
+        const auto takeEvents = [&](const std::uint32_t skip) {
+            cs.drainLineEvents([&](const std::uint16_t idx) {
+                if (idx != skip && !isQueued(idx)) {
+                    markQueued(idx);
+                    work_.push_back(ConstraintStore::flatIndexToLineID(idx));
+                }
+            });
+        };
+        takeEvents(ConstraintStore::kTotalLines); // the caller's own assigns
+
         while (front < work_.size()) {
             const auto line = work_[front++];
-            clearQueued(ConstraintStore::lineIndex(line));
+            const auto lineIdx = ConstraintStore::lineIndex(line);
+            clearQueued(lineIdx);
 
-            const auto rho = cs.getResidual(line);
-            const auto u = cs.getUnknownCount(line);
+            const auto &stat = cs.getStatDirect(lineIdx);
+            const auto rho = static_cast<std::int32_t>(stat.target) - static_cast<std::int32_t>(stat.assigned);
+            const auto u = stat.unknown;
 
             // Infeasibility check: rho < 0 or rho > u
             if (rho < 0 || std::cmp_greater(rho, u)) {
+                cs.clearLineEvents();
                 return false;
             }
 
@@ -166,27 +77,16 @@ namespace crsce::decompress::solvers {
                 continue; // no forcing on this line
             }
 
-            // Force all unknown cells on this line
-            forEachCellOnLine(line, kS, [&](const std::uint16_t r, const std::uint16_t c) {
-                if (cs.getCellState(r, c) != CellState::Unassigned) {
-                    return;
-                }
+            // Force all unknown cells on this line. The line's membership mask against the known
+            // plane yields just its unknown cells; each assign raises events for whichever of the
+            // cell's other lines (LTP included) it tips into forcing or conflict.
+            cs.forEachUnassignedOnLine(lineIdx, [&](const std::uint16_t r, const std::uint16_t c) {
                 cs.assign(r, c, forceValue);
-                forced_.push_back({.r = r, .c = c, .value = forceValue,
-                                   .antecedentLine = ConstraintStore::lineIndex(line)});
-
-                // B.21: cascade through all active lines (5 or 6), including LTP lines.
-                // Short LTP lines (1-64 cells) force immediately, enabling early propagation.
-                const auto affected = cs.getLinesForCell(r, c);
-                for (std::size_t i = 0; i < static_cast<std::size_t>(affected.count); ++i) {
-                    const auto &affLine = affected.lines[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-                    const auto idx = ConstraintStore::lineIndex(affLine);
-                    if (!isQueued(idx)) {
-                        markQueued(idx);
-                        work_.push_back(affLine);
-                    }
-                }
+                forced_.push_back({.r = r, .c = c, .value = forceValue, .antecedentLine = lineIdx});
             });
+
+            // The forced line itself is now complete and satisfied: skip its own event.
+            takeEvents(lineIdx);
         }
         return true;
     }
@@ -5,21 +5,19 @@
  */
 #include "decompress/Solvers/PropagationEngine.h"
 
-#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 
 #include "decompress/Solvers/ConstraintStore.h"
 #include "decompress/Solvers/LineID.h"
-#include "decompress/Solvers/LtpTable.h"
 
 namespace crsce::decompress::solvers {
     /**
      * @name tryPropagateCell
      * @brief Fast-path propagation for a single-cell assignment.
      *
-     * Computes the 4 basic flat stat indices plus LTP indices and checks
+     * Reads the cell's flat stat indices from CellLineTable and checks
      * feasibility/forcing inline. Returns immediately if no forcing is needed.
      *
      * @param r Row index.
@@ -31,25 +29,12 @@ namespace crsce::decompress::solvers {
 
         auto &cs = static_cast<ConstraintStore &>(store_); // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
 
-        // Compute 4 basic flat indices (same arithmetic as assign())
-        const auto ri = static_cast<std::uint32_t>(r);
-        const auto ci = static_cast<std::uint32_t>(kS) + c;
-        const auto di = (2U * kS) + static_cast<std::uint32_t>(c - r + (kS - 1));
-        const auto xi = (2U * kS) + ConstraintStore::kNumDiags + static_cast<std::uint32_t>(r + c);
-
-        // B.57: LTP membership (2 sub-tables)
-        const auto &mem = ltpMembership(r, c);
-
-        // Check 4 basic + 2 LTP lines for feasibility and forcing
-        const std::array<std::uint32_t, 6> indices = {  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-            ri, ci, di, xi,
-            static_cast<std::uint32_t>(mem.flat[0]), // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-            static_cast<std::uint32_t>(mem.flat[1])  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        };
+        // Check the lines through the cell (CellLineTable) for feasibility and forcing
+        const auto &lines = cs.cellLines(r, c);
         bool needsForcing = false;
 
-        for (const auto idx : indices) {
-            const auto &stat = cs.getStatDirect(idx); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        for (std::uint8_t j = 0; j < lines.count; ++j) {
+            const auto &stat = cs.getStatDirect(lines.flat[j]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
             const auto rho = static_cast<std::int32_t>(stat.target) - static_cast<std::int32_t>(stat.assigned);
             const auto u = static_cast<std::int32_t>(stat.unknown);
             if (rho < 0 || rho > u) {
@@ -1418,8 +1418,9 @@ namespace crsce::decompress::solvers {
 
                 // B.40: flush profiling data every ~100M iterations when enabled.
                 // The outer block fires every ~1M iterations (0x100000). We use a
-                // simple counter to flush every 100th entry into this block.
-                static std::uint64_t b40FlushCounter = 0;
+                // simple counter to flush every 100th entry into this block. Thread-local
+                // so concurrent block decodes do not race on it.
+                static thread_local std::uint64_t b40FlushCounter = 0;
                 ++b40FlushCounter;
                 if (b40Enabled && (b40FlushCounter % 100) == 0) {
                     std::ofstream b40Out(b40ProfilePath, std::ios::binary | std::ios::trunc); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
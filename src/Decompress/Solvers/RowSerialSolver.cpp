@@ -136,16 +136,17 @@ namespace crsce::decompress::solvers {
         for (const auto &cand : best.candidates) { // NOLINT(readability-use-anyofallof)
             ++result_.candidatesTried;
 
-            auto snap = store_.takeSnapshot();
+            const auto undo = store_.mark();
 
             if (assignRowAndPropagate(best.row, best.freeCols, cand.data())) {
                 if (solveRecursive(depth + 1)) {
+                    store_.commit();
                     return true;
                 }
             }
 
             ++result_.backtracks;
-            store_.restoreSnapshot(snap);
+            store_.rollback(undo);
         }
 
         return false; // all candidates exhausted
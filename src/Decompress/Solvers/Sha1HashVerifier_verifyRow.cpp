@@ -8,6 +8,7 @@
 #include <array>
 #include <cstdint>
 
+#include "common/BitKernels/BitKernels.h"
 #include "common/Util/crc32_ieee.h"
 
 namespace crsce::decompress::solvers {
@@ -22,12 +23,7 @@ namespace crsce::decompress::solvers {
     auto Sha1HashVerifier::verifyRow(const std::uint16_t r,
                                       const std::array<std::uint64_t, 2> &row) const -> bool {
         // Convert 2 uint64 words to 16 big-endian bytes
-        std::array<std::uint8_t, 16> msg{};
-        for (int w = 0; w < 2; ++w) {
-            for (int b = 7; b >= 0; --b) {
-                msg[(w * 8) + (7 - b)] = static_cast<std::uint8_t>(row[w] >> (b * 8)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-            }
-        }
+        const auto msg = crsce::common::bitkernels::rowToBytes(row);
         const std::uint32_t crc = crsce::common::util::crc32_ieee(msg.data(), msg.size());
         const std::array<std::uint8_t, kSha1DigestBytes> computed = {
             static_cast<std::uint8_t>((crc >> 24U) & 0xFFU),
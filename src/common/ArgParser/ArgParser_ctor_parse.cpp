@@ -9,6 +9,7 @@
 #include "common/exceptions/CliParseError.h"
 #include "common/exceptions/CliInputMissing.h"
 #include "common/exceptions/CliOutputExists.h"
+#include "common/Util/is_stdio_path.h"
 
 #include <span>
 #include <string>
@@ -36,10 +37,17 @@ namespace crsce::common {
             // parse ok implies both were provided, but guard anyway
             throw crsce::common::exceptions::CliParseError(usage());
         }
-        if (stat(opts_.input.c_str(), &sb) != 0) {
+        // "-" is stdin/stdout: nothing on disk to check, and nothing for -resume to journal.
+        const bool stdinInput = util::is_stdio_path(opts_.input);
+        const bool stdoutOutput = util::is_stdio_path(opts_.output);
+        if (opts_.resume && (stdinInput || stdoutOutput)) {
+            throw crsce::common::exceptions::CliParseError(usage());
+        }
+        if (!stdinInput && stat(opts_.input.c_str(), &sb) != 0) {
             throw crsce::common::exceptions::CliInputMissing(std::string("error: input file does not exist: ") + opts_.input);
         }
-        if (stat(opts_.output.c_str(), &sb) == 0) {
+        // With -resume the output may already hold a checkpointed prefix.
+        if (!stdoutOutput && !opts_.resume && stat(opts_.output.c_str(), &sb) == 0) {
             throw crsce::common::exceptions::CliOutputExists(std::string("error: output file already exists: ") + opts_.output);
         }
     }
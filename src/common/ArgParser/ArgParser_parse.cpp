@@ -4,9 +4,12 @@
  * @brief ArgParser::parse implementation.
  */
 #include "common/ArgParser/ArgParser.h"
+#include <charconv>
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <string>
+#include <system_error>
 
 namespace crsce::common {
     /**
@@ -18,7 +21,11 @@ namespace crsce::common {
      * - `-h`/`--help` to set the help flag and accept any other state.
      * - `-in <path>` to set the input path.
      * - `-out <path>` to set the output path.
-     * Unknown flags or a missing value after `-in`/`-out` cause parsing to fail.
+     * - `-threads <n>` to set the worker thread count (a positive decimal integer).
+     * - `-range <start:len>` to select a byte range of the original file (decimal offsets).
+     * - `-resume` to continue an interrupted run from its sidecar journal.
+     * Unknown flags, a missing value after `-in`/`-out`/`-threads`/`-range`, a non-positive
+     * thread count, or a malformed range cause parsing to fail.
      */
     auto ArgParser::parse(const std::span<char *> args) -> bool {
         // GCOVR_EXCL_LINE
@@ -33,6 +40,11 @@ namespace crsce::common {
                 ++i;
                 continue;
             }
+            if (arg == "-resume") {
+                opts_.resume = true;
+                ++i;
+                continue;
+            }
             if (arg == "-in" || arg == "-out") {
                 if (i + 1 >= args.size()) {
                     return false; // missing value
@@ -46,6 +58,42 @@ namespace crsce::common {
                 ++i;
                 continue;
             }
+            if (arg == "-threads") {
+                if (i + 1 >= args.size()) {
+                    return false; // missing value
+                }
+                const std::string val = args[++i];
+                std::uint32_t n = 0;
+                const auto [ptr, ec] = std::from_chars(val.data(), val.data() + val.size(), n); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if (ec != std::errc{} || ptr != val.data() + val.size() || n == 0) { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    return false; // not a positive integer
+                }
+                opts_.threads = n;
+                ++i;
+                continue;
+            }
+            if (arg == "-range") {
+                if (i + 1 >= args.size()) {
+                    return false; // missing value
+                }
+                const std::string val = args[++i];
+                const auto colon = val.find(':');
+                if (colon == std::string::npos) {
+                    return false; // expected start:len
+                }
+                ByteRange range;
+                const char *const first = val.data();
+                const char *const mid = first + colon; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                const char *const last = first + val.size(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                const auto [p1, e1] = std::from_chars(first, mid, range.start);
+                const auto [p2, e2] = std::from_chars(mid + 1, last, range.length); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if (e1 != std::errc{} || p1 != mid || e2 != std::errc{} || p2 != last) {
+                    return false; // not two decimal integers
+                }
+                opts_.range = range;
+                ++i;
+                continue;
+            }
             // Unknown flag/token
             return false;
         }
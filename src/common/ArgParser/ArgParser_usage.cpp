@@ -11,8 +11,14 @@ namespace crsce::common {
     /**
      * @name ArgParser::usage
      * @brief Generate a short usage synopsis for the program.
-     * @return A single-line usage string combining the program name and required flags.
-     * @details Example: "compress -in <file> -out <file>".
+     * @return A single-line usage string combining the program name and the flags it accepts.
+     * @details Example: "compress -in <file|-> -out <file|-> [-threads <n>]". -range and -resume
+     *          only apply to decompress, so only other programs list them.
      */
-    auto ArgParser::usage() const -> std::string { return std::format("{} -in <file> -out <file>", programName_); }
+    auto ArgParser::usage() const -> std::string {
+        if (programName_ == "compress") {
+            return std::format("{} -in <file|-> -out <file|-> [-threads <n>]", programName_);
+        }
+        return std::format("{} -in <file|-> -out <file|-> [-threads <n>] [-range <start:len>] [-resume]", programName_);
+    }
 } // namespace crsce::common
@@ -0,0 +1,33 @@
+/**
+ * @file BitKernels_packRows.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief bitkernels::packRows -- CSM rows to bitstream with 64-bit funnel shifts.
+ */
+#include "common/BitKernels/BitKernels.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::bitkernels {
+    /**
+     * @name packRows
+     * @brief OR the rows of a CSM into a 127-bit-stride MSB-first bitstream.
+     * @details Each row is two funnel-shifted 64-bit stores (64 + 63 bits).
+     * @param csm Source matrix.
+     * @param dst Destination buffer.
+     * @param len Length of the destination buffer in bytes; bits beyond it are dropped.
+     * @param startBit Absolute bit offset at which cell (0, 0) is written.
+     * @return void
+     * @throws None
+     */
+    void packRows(const Csm &csm, std::uint8_t *dst, const std::size_t len, const std::uint64_t startBit) noexcept {
+        for (std::uint16_t r = 0; r < Csm::kS; ++r) {
+            const auto row = csm.getRow(r);
+            const std::uint64_t pos = startBit + (static_cast<std::uint64_t>(r) * kRowBits);
+            orBits64(dst, len, pos, row[0], 64U);
+            orBits64(dst, len, pos + 64, row[1], kRowBits - 64U);
+        }
+    }
+} // namespace crsce::common::bitkernels
@@ -0,0 +1,49 @@
+/**
+ * @file BitKernels_unpackRows.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief bitkernels::unpackRows -- bitstream to CSM rows with 64-bit funnel shifts.
+ */
+#include "common/BitKernels/BitKernels.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::bitkernels {
+    /**
+     * @name unpackRows
+     * @brief Load a 127-bit-stride MSB-first bitstream into the rows of a CSM.
+     * @details Each row is two funnel-shifted 64-bit loads. The second word carries
+     *          63 significant bits; its LSB (column 127) is always cleared. Rows that
+     *          straddle bitCount are masked so cells at or beyond it read as zero.
+     * @param data Source buffer.
+     * @param len Length of the source buffer in bytes.
+     * @param startBit Absolute bit offset of cell (0, 0) in the source.
+     * @param bitCount Number of valid bits to load; cells at or beyond it are zero.
+     * @param csm Destination matrix; every row is overwritten.
+     * @return void
+     * @throws None
+     */
+    void unpackRows(const std::uint8_t *data, const std::size_t len, const std::uint64_t startBit,
+                    const std::size_t bitCount, Csm &csm) noexcept {
+        constexpr std::uint64_t kWord1Mask = ~std::uint64_t{0} << (64U - (kRowBits - 64U));
+        for (std::uint16_t r = 0; r < Csm::kS; ++r) {
+            const std::uint64_t rowStart = static_cast<std::uint64_t>(r) * kRowBits;
+            std::array<std::uint64_t, Csm::kWordsPerRow> row{};
+            if (rowStart < bitCount) {
+                row[0] = loadBits64(data, len, startBit + rowStart);
+                row[1] = loadBits64(data, len, startBit + rowStart + 64) & kWord1Mask;
+                const auto valid = bitCount - rowStart;
+                if (valid < 64) {
+                    row[0] &= ~(~std::uint64_t{0} >> valid);
+                    row[1] = 0;
+                } else if (valid < kRowBits) {
+                    row[1] &= ~(~std::uint64_t{0} >> (valid - 64));
+                }
+            }
+            csm.setRow(r, row);
+        }
+    }
+} // namespace crsce::common::bitkernels
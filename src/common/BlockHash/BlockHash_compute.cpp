@@ -8,9 +8,11 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
 #include "common/BitHashBuffer/sha256/sha256_digest.h"
+#include "common/BitKernels/BitKernels.h"
 #include "common/Csm/Csm.h"
 
 namespace crsce::common {
@@ -28,14 +30,9 @@ namespace crsce::common {
 
         std::vector<std::uint8_t> buf(kTotalBytes);
         for (std::uint16_t r = 0; r < kS; ++r) {
-            const auto row = csm.getRow(r);
-            for (std::size_t w = 0; w < kWordsPerRow; ++w) {
-                const std::size_t off = (static_cast<std::size_t>(r) * kRowBytes) + (w * 8);
-                for (int b = 7; b >= 0; --b) {
-                    buf[off + static_cast<std::size_t>(7 - b)] = // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-                        static_cast<std::uint8_t>(row.at(w) >> (b * 8));
-                }
-            }
+            const auto bytes = bitkernels::rowToBytes(csm.getRow(r));
+            std::memcpy(buf.data() + (static_cast<std::size_t>(r) * kRowBytes), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                        bytes.data(), bytes.size());
         }
         return detail::sha256::sha256_digest(buf.data(), buf.size());
     }
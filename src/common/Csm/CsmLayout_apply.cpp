@@ -0,0 +1,37 @@
+/**
+ * @file CsmLayout_apply.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief csmlayout::apply -- re-lay a row-major block under a layout transform.
+ */
+#include "common/Csm/CsmLayout.h"
+
+#include <cstdint>
+
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::csmlayout {
+
+    /**
+     * @name apply
+     * @brief Re-lay a row-major block (as loaded by loadCsm) under another layout.
+     * @param natural The block in RowMajor layout.
+     * @param layout Target layout.
+     * @return The block with stream bit i at cellOf(layout, i).
+     * @throws None
+     */
+    Csm apply(const Csm &natural, const Layout layout) {
+        static constexpr std::uint16_t kS = Csm::kS;
+        if (layout == Layout::RowMajor) {
+            return natural;
+        }
+        Csm laid;
+        for (std::uint16_t i = 0; i < kS * kS; ++i) {
+            if (natural.get(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS)) != 0) {
+                const auto p = cellOf(layout, i);
+                laid.set(static_cast<std::uint16_t>(p / kS), static_cast<std::uint16_t>(p % kS), 1);
+            }
+        }
+        return laid;
+    }
+
+} // namespace crsce::common::csmlayout
@@ -0,0 +1,45 @@
+/**
+ * @file CsmLayout_cellOf.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief csmlayout::cellOf -- stream bit to matrix cell under a layout transform.
+ */
+#include "common/Csm/CsmLayout.h"
+
+#include <cstdint>
+
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::csmlayout {
+
+    /**
+     * @name cellOf
+     * @brief Matrix cell (r * kS + c) that holds stream bit i under a layout.
+     * @param layout Layout transform.
+     * @param i Stream bit index in [0, kS * kS).
+     * @return Cell index in [0, kS * kS).
+     * @throws None
+     */
+    std::uint16_t cellOf(const Layout layout, const std::uint16_t i) noexcept {
+        static constexpr std::uint16_t kS = Csm::kS;
+        static constexpr std::uint16_t kRecords = kBytes / kRecordBytes;
+        const auto byte = static_cast<std::uint16_t>(i / 8);
+        const auto bit = static_cast<std::uint16_t>(i % 8);
+        if (byte >= kBytes && layout != Layout::Transpose) {
+            return i; // the lone last bit
+        }
+        switch (layout) {
+            case Layout::Transpose:
+                return static_cast<std::uint16_t>(((i % kS) * kS) + (i / kS));
+            case Layout::BitPlane:
+                return static_cast<std::uint16_t>((bit * kBytes) + byte);
+            case Layout::ByteColumn: {
+                const auto moved = static_cast<std::uint16_t>(((byte % kRecordBytes) * kRecords) + (byte / kRecordBytes));
+                return static_cast<std::uint16_t>((moved * 8) + bit);
+            }
+            case Layout::RowMajor:
+                break;
+        }
+        return i;
+    }
+
+} // namespace crsce::common::csmlayout
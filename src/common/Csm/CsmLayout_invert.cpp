@@ -0,0 +1,37 @@
+/**
+ * @file CsmLayout_invert.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief csmlayout::invert -- recover the row-major block from a laid-out one.
+ */
+#include "common/Csm/CsmLayout.h"
+
+#include <cstdint>
+
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::csmlayout {
+
+    /**
+     * @name invert
+     * @brief Undo apply(): recover the row-major block from a laid-out one.
+     * @param laid The block in the given layout.
+     * @param layout Layout the block is in.
+     * @return The block in RowMajor layout.
+     * @throws None
+     */
+    Csm invert(const Csm &laid, const Layout layout) {
+        static constexpr std::uint16_t kS = Csm::kS;
+        if (layout == Layout::RowMajor) {
+            return laid;
+        }
+        Csm natural;
+        for (std::uint16_t i = 0; i < kS * kS; ++i) {
+            const auto p = cellOf(layout, i);
+            if (laid.get(static_cast<std::uint16_t>(p / kS), static_cast<std::uint16_t>(p % kS)) != 0) {
+                natural.set(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS), 1);
+            }
+        }
+        return natural;
+    }
+
+} // namespace crsce::common::csmlayout
@@ -0,0 +1,31 @@
+/**
+ * @file CsmLayout_name.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief csmlayout::name -- short name of a layout transform.
+ */
+#include "common/Csm/CsmLayout.h"
+
+namespace crsce::common::csmlayout {
+
+    /**
+     * @name name
+     * @brief Short lowercase name of a layout, for observability.
+     * @param layout Layout transform.
+     * @return "row_major", "transpose", "bit_plane" or "byte_column".
+     * @throws None
+     */
+    const char *name(const Layout layout) noexcept {
+        switch (layout) {
+            case Layout::Transpose:
+                return "transpose";
+            case Layout::BitPlane:
+                return "bit_plane";
+            case Layout::ByteColumn:
+                return "byte_column";
+            case Layout::RowMajor:
+                break;
+        }
+        return "row_major";
+    }
+
+} // namespace crsce::common::csmlayout
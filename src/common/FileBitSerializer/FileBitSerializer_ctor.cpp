@@ -17,6 +17,6 @@ namespace crsce::common {
      * @return N/A
      */
     FileBitSerializer::FileBitSerializer(const std::string &path) // GCOVR_EXCL_LINE
-        : in_(path, std::ios::binary), buf_(kChunkSize) {
+        : file_(path, std::ios::binary), buf_(kChunkSize) {
     }
 } // namespace crsce::common
@@ -0,0 +1,21 @@
+/**
+ * @file FileBitSerializer_ctor_stream.cpp
+ * @copyright (c) 2026 Sam Caldwell.  See LICENSE.txt for details.
+ * @brief Constructor for FileBitSerializer over an external stream (stdin, pipes).
+ */
+#include "common/FileBitSerializer/FileBitSerializer.h"
+#include <istream>
+
+namespace crsce::common {
+    /**
+     * @name FileBitSerializer
+     * @brief Construct a bit-serializer that reads an already-open stream.
+     * @usage FileBitSerializer s(std::cin);
+     * @throws None (stream state is observable via good()).
+     * @param in Stream to read sequentially; must outlive the serializer.
+     * @return N/A
+     */
+    FileBitSerializer::FileBitSerializer(std::istream &in) // GCOVR_EXCL_LINE
+        : in_(&in), buf_(kChunkSize) {
+    }
+} // namespace crsce::common
@@ -18,12 +18,12 @@ namespace crsce::common {
     bool FileBitSerializer::fill() {
         // GCOVR_EXCL_LINE
         // ReSharper disable once CppDFAConstantConditions
-        if (!in_.good() || eof_) {
+        if (!in_->good() || eof_) {
             return false; // GCOVR_EXCL_LINE
         }
-        in_.read(buf_.data(),
+        in_->read(buf_.data(),
                  static_cast<std::streamsize>(kChunkSize)); // GCOVR_EXCL_LINE
-        const std::streamsize got = in_.gcount(); // GCOVR_EXCL_LINE
+        const std::streamsize got = in_->gcount(); // GCOVR_EXCL_LINE
         if (got <= 0) {
             // GCOVR_EXCL_LINE
             eof_ = true;
@@ -0,0 +1,43 @@
+/**
+ * @file FileBitSerializer_popBits.cpp
+ * @copyright (c) 2026 Sam Caldwell.  See LICENSE.txt for details.
+ * @brief Implementation of FileBitSerializer::popBits (bulk MSB-first bit extraction).
+ */
+#include "common/FileBitSerializer/FileBitSerializer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/BitKernels/BitKernels.h"
+
+namespace crsce::common {
+    /**
+     * @name popBits
+     * @brief Pop up to bitCount bits (MSB-first) into a zero-padded, byte-aligned buffer.
+     * @details Copies up to 64 bits per step with the bitkernels funnel shifts (loadBits64 from
+     *          the chunk, orBits64 into dst), bounded by what is left in the current chunk. The
+     *          source position need not be byte-aligned (CSM blocks are 16,129 bits).
+     * @usage std::vector<std::uint8_t> block; const auto got = s.popBits(block, 16129);
+     * @throws None
+     * @param dst Destination; resized to ceil(bitCount / 8) bytes and zero-filled first.
+     * @param bitCount Number of bits requested.
+     * @return Number of bits actually produced (less than bitCount only at EOF).
+     */
+    std::size_t FileBitSerializer::popBits(std::vector<std::uint8_t> &dst, const std::size_t bitCount) {
+        dst.assign((bitCount + 7) / 8, 0);
+        const auto *src = reinterpret_cast<const std::uint8_t *>(buf_.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        std::size_t got = 0;
+        while (got < bitCount && has_next()) {
+            const std::size_t pos = (byte_pos_ * 8) + static_cast<std::size_t>(bit_pos_);
+            const auto take = std::min<std::size_t>({64, (buf_len_ * 8) - pos, bitCount - got});
+            bitkernels::orBits64(dst.data(), dst.size(), got, bitkernels::loadBits64(src, buf_len_, pos),
+                                 static_cast<unsigned>(take));
+            got += take;
+            byte_pos_ = (pos + take) / 8;
+            bit_pos_ = static_cast<int>((pos + take) % 8);
+        }
+        return got;
+    }
+} // namespace crsce::common
@@ -0,0 +1,84 @@
+/**
+ * @file BlockFrame_deserialize.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief BlockFrame::deserialize() implementation.
+ */
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Util/crc32_ieee.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "common/exceptions/DecompressBlockCorrupt.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name deserialize
+     * @brief Validate a framed block and return its frame.
+     * @details The CRC is checked first so that any flipped bit, in the frame or the
+     *          payload, is reported as corruption rather than as a misleading id/flag error.
+     * @param data Pointer to the frame followed by the payload.
+     * @param len Length of frame + payload in bytes.
+     * @param expectedBlockId Block index implied by the frame's position in the file.
+     * @return Deserialized BlockFrame.
+     * @throws DecompressBlockCorrupt on short buffer, CRC-32 mismatch, block id mismatch,
+     *         unknown or conflicting flags, a payload length other than payloadBytes(flags) +
+     *         hintBytes(), a hint trail longer than DecodeHint::kMaxTrailBits, or a
+     *         final_bits value inconsistent with the flags.
+     */
+    BlockFrame BlockFrame::deserialize(const std::uint8_t *data, const std::size_t len,
+                                       const std::uint64_t expectedBlockId) {
+        const auto where = "BlockFrame::deserialize: block " + std::to_string(expectedBlockId) + ": ";
+        if (len <= kFrameBytes) {
+            throw exceptions::DecompressBlockCorrupt(where + "buffer too small");
+        }
+
+        // Verify CRC-32 over bytes 0-11 chained with the payload
+        std::uint32_t storedCrc = 0;
+        std::memcpy(&storedCrc, data + 12, 4); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const std::uint32_t head = util::crc32_ieee(data, 12);
+        const std::uint32_t computedCrc = util::crc32_ieee(data + kFrameBytes, len - kFrameBytes, ~head); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (storedCrc != computedCrc) {
+            throw exceptions::DecompressBlockCorrupt(where + "CRC-32 mismatch");
+        }
+
+        BlockFrame frame;
+        std::memcpy(&frame.blockId, data + 0, 8); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(&frame.flags, data + 8, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(&frame.finalBits, data + 10, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (frame.blockId != expectedBlockId) {
+            throw exceptions::DecompressBlockCorrupt(where + "frame carries block id " + std::to_string(frame.blockId));
+        }
+        if ((frame.flags & static_cast<std::uint16_t>(~kKnownFlags)) != 0) {
+            throw exceptions::DecompressBlockCorrupt(where + "unknown flags");
+        }
+        if (frame.stored() && frame.hinted()) {
+            throw exceptions::DecompressBlockCorrupt(where + "stored block cannot carry a decode hint");
+        }
+        if (frame.stored() && (frame.layout() != 0 || frame.padded())) {
+            throw exceptions::DecompressBlockCorrupt(where + "stored block cannot carry a layout transform or padding");
+        }
+        const std::size_t payloadLen = len - kFrameBytes;
+        const std::size_t fixedLen = payloadBytes(frame.flags);
+        if (payloadLen < fixedLen || payloadLen != fixedLen + hintBytes(frame.flags, data + kFrameBytes)) { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            throw exceptions::DecompressBlockCorrupt(where + "payload length " + std::to_string(payloadLen) +
+                                                     " does not match flags");
+        }
+        if (frame.hinted() && !DecodeHint::deserialize(data + kFrameBytes + CompressedPayload::kBlockPayloadBytes, // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                                       payloadLen - CompressedPayload::kBlockPayloadBytes)) {
+            throw exceptions::DecompressBlockCorrupt(where + "decode hint trail too long");
+        }
+        // final_bits is meaningful only on a final frame and never exceeds one block.
+        constexpr std::uint32_t kBlockBits = CompressedPayload::kS * CompressedPayload::kS;
+        if (frame.final() ? frame.finalBits > kBlockBits : frame.finalBits != 0) {
+            throw exceptions::DecompressBlockCorrupt(where + "bad final_bits " + std::to_string(frame.finalBits));
+        }
+        return frame;
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,33 @@
+/**
+ * @file BlockFrame_hintBytes.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief BlockFrame::hintBytes() implementation.
+ */
+#include "common/Format/CompressedPayload/BlockFrame.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name hintBytes
+     * @brief Payload bytes that follow the first payloadBytes(flags) bytes.
+     * @details Reads the DecodeHint trail_bits field, which payloadBytes(flags) already covers.
+     *          A frame that also claims kFlagStored has no hint (deserialize() rejects it).
+     * @param flags Frame flag bits.
+     * @param payload Pointer to at least payloadBytes(flags) payload bytes.
+     * @return The hint trail length if kFlagHint is set (read from the payload), else 0.
+     * @throws None
+     */
+    std::size_t BlockFrame::hintBytes(const std::uint16_t flags, const std::uint8_t *payload) {
+        if ((flags & kFlagHint) == 0 || (flags & kFlagStored) != 0) {
+            return 0;
+        }
+        return DecodeHint::trailBytes(payload + CompressedPayload::kBlockPayloadBytes); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,31 @@
+/**
+ * @file BlockFrame_payloadBytes.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief BlockFrame::payloadBytes() implementation.
+ */
+#include "common/Format/CompressedPayload/BlockFrame.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name payloadBytes
+     * @brief Payload bytes to read after a frame carrying the given flags, before hintBytes().
+     * @param flags Frame flag bits.
+     * @return kStoredPayloadBytes if kFlagStored is set, else CompressedPayload::kBlockPayloadBytes,
+     *         plus DecodeHint::kHeaderBytes if kFlagHint is set.
+     * @throws None
+     */
+    std::size_t BlockFrame::payloadBytes(const std::uint16_t flags) {
+        if ((flags & kFlagStored) != 0) {
+            return kStoredPayloadBytes;
+        }
+        return CompressedPayload::kBlockPayloadBytes + ((flags & kFlagHint) != 0 ? DecodeHint::kHeaderBytes : 0);
+    }
+
+} // namespace crsce::common::format
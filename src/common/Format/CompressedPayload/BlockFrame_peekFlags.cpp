@@ -0,0 +1,26 @@
+/**
+ * @file BlockFrame_peekFlags.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief BlockFrame::peekFlags() implementation.
+ */
+#include "common/Format/CompressedPayload/BlockFrame.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace crsce::common::format {
+
+    /**
+     * @name peekFlags
+     * @brief Read the flags field of a frame that has not been validated yet.
+     * @param data Pointer to at least kFrameBytes bytes.
+     * @return The raw flags field (little-endian uint16 at offset 8).
+     * @throws None
+     */
+    std::uint16_t BlockFrame::peekFlags(const std::uint8_t *data) {
+        std::uint16_t flags = 0;
+        std::memcpy(&flags, data + 8, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return flags;
+    }
+
+} // namespace crsce::common::format
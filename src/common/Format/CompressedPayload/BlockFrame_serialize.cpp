@@ -0,0 +1,49 @@
+/**
+ * @file BlockFrame_serialize.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief BlockFrame::serialize() implementation.
+ */
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Util/crc32_ieee.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name serialize
+     * @brief Build the framed block: 16-byte frame followed by the payload.
+     * @details Writes block id, flags, and final-block bit count, copies the payload after
+     *          the frame, then computes CRC-32 over bytes 0-11 chained with the payload.
+     * @param payload Serialized block payload.
+     * @return Vector of kFrameBytes + payload.size() bytes.
+     * @throws None
+     */
+    std::vector<std::uint8_t> BlockFrame::serialize(const std::vector<std::uint8_t> &payload) const {
+        std::vector<std::uint8_t> buf(kFrameBytes + payload.size(), 0);
+
+        // Offset 0: block_id (little-endian uint64)
+        std::memcpy(buf.data() + 0, &blockId, 8); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // Offset 8: flags (little-endian uint16)
+        std::memcpy(buf.data() + 8, &flags, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // Offset 10: final_bits (little-endian uint16)
+        std::memcpy(buf.data() + 10, &finalBits, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // Payload follows the frame
+        if (!payload.empty()) {
+            std::memcpy(buf.data() + kFrameBytes, payload.data(), payload.size()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        // Offset 12: CRC-32 over bytes 0-11, then the payload
+        const std::uint32_t head = util::crc32_ieee(buf.data(), 12);
+        const std::uint32_t crc = util::crc32_ieee(buf.data() + kFrameBytes, payload.size(), ~head); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(buf.data() + 12, &crc, 4); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return buf;
+    }
+
+} // namespace crsce::common::format
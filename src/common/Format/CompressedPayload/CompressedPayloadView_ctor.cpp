@@ -0,0 +1,29 @@
+/**
+ * @file CompressedPayloadView_ctor.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView constructor.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/exceptions/DecompressHeaderInvalid.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name CompressedPayloadView
+     * @brief Bind a view to a serialized block payload (no copy).
+     * @param data Pointer to at least kBlockPayloadBytes bytes.
+     * @param len Length of the buffer.
+     * @throws DecompressHeaderInvalid if len < kBlockPayloadBytes.
+     */
+    CompressedPayloadView::CompressedPayloadView(const std::uint8_t *data, const std::size_t len)
+        : data_(data), len_(len) {
+        if (len < CompressedPayload::kBlockPayloadBytes) {
+            throw exceptions::DecompressHeaderInvalid("CompressedPayloadView: buffer too small");
+        }
+    }
+
+} // namespace crsce::common::format
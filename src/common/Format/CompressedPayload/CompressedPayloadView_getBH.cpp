@@ -0,0 +1,26 @@
+/**
+ * @file CompressedPayloadView_getBH.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::getBH implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace crsce::common::format {
+
+    /**
+     * @name getBH
+     * @brief Block hash digest.
+     * @return Copy of the 32-byte digest.
+     * @throws None
+     */
+    std::array<std::uint8_t, CompressedPayload::kBHDigestBytes> CompressedPayloadView::getBH() const {
+        std::array<std::uint8_t, CompressedPayload::kBHDigestBytes> bh{};
+        std::memcpy(bh.data(), data_ + kBHByte, bh.size()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return bh;
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,24 @@
+/**
+ * @file CompressedPayloadView_ltpBits.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::ltpBits implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <bit>
+
+#include "decompress/Solvers/LtpTable.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name ltpBits
+     * @brief Width of each LTP partition sum element.
+     * @details All LTP lines are uniform length, so every element uses the width of line 0.
+     * @return bit_width of the LTP line length.
+     */
+    unsigned CompressedPayloadView::ltpBits() {
+        return static_cast<unsigned>(std::bit_width(decompress::solvers::ltpLineLen(0)));
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,24 @@
+/**
+ * @file CompressedPayloadView_unpackDSM.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackDSM implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackDSM
+     * @brief Decode the kDiagCount diagonal sums into out.
+     * @param out Destination vector.
+     * @return void
+     * @throws None
+     */
+    void CompressedPayloadView::unpackDSM(std::vector<std::uint16_t> &out) const {
+        unpackDiagonal(kDSMBit, out);
+    }
+
+} // namespace crsce::common::format
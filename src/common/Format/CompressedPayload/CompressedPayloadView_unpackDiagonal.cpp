@@ -0,0 +1,41 @@
+/**
+ * @file CompressedPayloadView_unpackDiagonal.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackDiagonal -- windowed variable-width decode.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "common/BitKernels/BitKernels.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackDiagonal
+     * @brief Decode a variable-width DSM/XSM vector starting at bitPos.
+     * @details Elements are peeled from a 64-bit window that is refilled only when the next
+     *          element no longer fits, so a 253-element vector costs ~20 loads.
+     * @param bitPos First bit of the vector.
+     * @param out Destination vector (resized to kDiagCount).
+     * @return void
+     */
+    void CompressedPayloadView::unpackDiagonal(std::uint64_t bitPos, std::vector<std::uint16_t> &out) const {
+        out.resize(kDiagCount);
+        std::uint64_t window = 0;
+        unsigned avail = 0;
+        for (std::uint16_t k = 0; k < kDiagCount; ++k) {
+            const unsigned width = diagBits(k);
+            if (avail < width) {
+                window = bitkernels::loadBits64(data_, len_, bitPos);
+                avail = 64U;
+            }
+            out[k] = static_cast<std::uint16_t>(window >> (64U - width));
+            window <<= width;
+            avail -= width;
+            bitPos += width;
+        }
+    }
+
+} // namespace crsce::common::format
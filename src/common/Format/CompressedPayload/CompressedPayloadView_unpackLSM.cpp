@@ -0,0 +1,24 @@
+/**
+ * @file CompressedPayloadView_unpackLSM.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackLSM implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackLSM
+     * @brief Decode the kS row sums into out.
+     * @param out Destination vector.
+     * @return void
+     * @throws None
+     */
+    void CompressedPayloadView::unpackLSM(std::vector<std::uint16_t> &out) const {
+        unpackUniform(kLSMBit, kUniformBits, kS, out);
+    }
+
+} // namespace crsce::common::format
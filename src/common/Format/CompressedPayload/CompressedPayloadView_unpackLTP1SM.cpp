@@ -0,0 +1,24 @@
+/**
+ * @file CompressedPayloadView_unpackLTP1SM.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackLTP1SM implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackLTP1SM
+     * @brief Decode the kS LTP1 partition sums into out.
+     * @param out Destination vector.
+     * @return void
+     * @throws None
+     */
+    void CompressedPayloadView::unpackLTP1SM(std::vector<std::uint16_t> &out) const {
+        unpackUniform(ltp1Bit(), ltpBits(), kS, out);
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,24 @@
+/**
+ * @file CompressedPayloadView_unpackLTP2SM.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackLTP2SM implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackLTP2SM
+     * @brief Decode the kS LTP2 partition sums into out.
+     * @param out Destination vector.
+     * @return void
+     * @throws None
+     */
+    void CompressedPayloadView::unpackLTP2SM(std::vector<std::uint16_t> &out) const {
+        unpackUniform(ltp1Bit() + (static_cast<std::uint64_t>(kS) * ltpBits()), ltpBits(), kS, out);
+    }
+
+} // namespace crsce::common::format
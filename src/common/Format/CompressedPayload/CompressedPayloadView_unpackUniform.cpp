@@ -0,0 +1,45 @@
+/**
+ * @file CompressedPayloadView_unpackUniform.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackUniform -- word-parallel fixed-width decode.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/BitKernels/BitKernels.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackUniform
+     * @brief Decode count elements of `width` bits starting at bitPos.
+     * @details Loads 64 bits at a time and peels floor(64 / width) elements from each
+     *          window (9 elements per load at 7 bits), instead of one byte access per bit.
+     * @param bitPos First bit of the vector.
+     * @param width Element width in bits (1..16).
+     * @param count Number of elements.
+     * @param out Destination vector (resized to count).
+     * @return void
+     */
+    void CompressedPayloadView::unpackUniform(std::uint64_t bitPos, const unsigned width, const std::size_t count,
+                                              std::vector<std::uint16_t> &out) const {
+        out.resize(count);
+        const std::size_t perWord = 64U / width;
+        std::size_t k = 0;
+        while (k < count) {
+            std::uint64_t window = bitkernels::loadBits64(data_, len_, bitPos);
+            const std::size_t n = std::min(perWord, count - k);
+            for (std::size_t j = 0; j < n; ++j) {
+                out[k + j] = static_cast<std::uint16_t>(window >> (64U - width));
+                window <<= width;
+            }
+            k += n;
+            bitPos += static_cast<std::uint64_t>(n) * width;
+        }
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,24 @@
+/**
+ * @file CompressedPayloadView_unpackVSM.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackVSM implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackVSM
+     * @brief Decode the kS column sums into out.
+     * @param out Destination vector.
+     * @return void
+     * @throws None
+     */
+    void CompressedPayloadView::unpackVSM(std::vector<std::uint16_t> &out) const {
+        unpackUniform(kVSMBit, kUniformBits, kS, out);
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,24 @@
+/**
+ * @file CompressedPayloadView_unpackXSM.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief CompressedPayloadView::unpackXSM implementation.
+ */
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name unpackXSM
+     * @brief Decode the kDiagCount anti-diagonal sums into out.
+     * @param out Destination vector.
+     * @return void
+     * @throws None
+     */
+    void CompressedPayloadView::unpackXSM(std::vector<std::uint16_t> &out) const {
+        unpackDiagonal(xsmBit(), out);
+    }
+
+} // namespace crsce::common::format
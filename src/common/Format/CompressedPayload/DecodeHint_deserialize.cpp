@@ -0,0 +1,40 @@
+/**
+ * @file DecodeHint_deserialize.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief DecodeHint::deserialize() implementation.
+ */
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name deserialize
+     * @brief Decode a hint section.
+     * @param data Pointer to the section.
+     * @param len Section length in bytes.
+     * @return The trail, or nullopt if the length disagrees with trail_bits or the trail is too long.
+     * @throws None
+     */
+    std::optional<std::vector<std::uint8_t>> DecodeHint::deserialize(const std::uint8_t *data, const std::size_t len) {
+        if (len < kHeaderBytes) {
+            return std::nullopt;
+        }
+        std::uint16_t bits = 0;
+        std::memcpy(&bits, data, kHeaderBytes);
+        if (bits > kMaxTrailBits || len != kHeaderBytes + trailBytes(data)) {
+            return std::nullopt;
+        }
+        std::vector<std::uint8_t> trail(bits);
+        for (std::size_t i = 0; i < trail.size(); ++i) {
+            trail[i] = (data[kHeaderBytes + (i / 8)] >> (7 - (i % 8))) & 1U; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        return trail;
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,34 @@
+/**
+ * @file DecodeHint_serialize.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief DecodeHint::serialize() implementation.
+ */
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace crsce::common::format {
+
+    /**
+     * @name serialize
+     * @brief Build the hint section for a trail.
+     * @param trail Branch values (0 or 1), root first; at most kMaxTrailBits entries.
+     * @return kHeaderBytes + ceil(trail.size() / 8) bytes.
+     * @throws None
+     */
+    std::vector<std::uint8_t> DecodeHint::serialize(const std::vector<std::uint8_t> &trail) {
+        const auto bits = static_cast<std::uint16_t>(trail.size());
+        std::vector<std::uint8_t> out(kHeaderBytes + ((trail.size() + 7) / 8), 0);
+        std::memcpy(out.data(), &bits, kHeaderBytes);
+        for (std::size_t i = 0; i < trail.size(); ++i) {
+            if (trail[i] != 0) {
+                out[kHeaderBytes + (i / 8)] |= static_cast<std::uint8_t>(0x80U >> (i % 8));
+            }
+        }
+        return out;
+    }
+
+} // namespace crsce::common::format
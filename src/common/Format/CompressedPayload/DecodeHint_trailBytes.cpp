@@ -0,0 +1,27 @@
+/**
+ * @file DecodeHint_trailBytes.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief DecodeHint::trailBytes() implementation.
+ */
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace crsce::common::format {
+
+    /**
+     * @name trailBytes
+     * @brief Bytes that follow the trail_bits field, read from the field itself.
+     * @param header Pointer to the first kHeaderBytes bytes of the section.
+     * @return ceil(trail_bits / 8).
+     * @throws None
+     */
+    std::size_t DecodeHint::trailBytes(const std::uint8_t *header) {
+        std::uint16_t bits = 0;
+        std::memcpy(&bits, header, kHeaderBytes);
+        return (static_cast<std::size_t>(bits) + 7) / 8;
+    }
+
+} // namespace crsce::common::format
@@ -0,0 +1,27 @@
+/**
+ * @file FileHeader_blockStride.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief FileHeader::blockStride() implementation.
+ */
+#include "common/Format/CompressedPayload/FileHeader.h"
+
+#include <cstdint>
+
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name blockStride
+     * @brief Bytes occupied by each block on disk.
+     * @details v1: kBlockPayloadBytes. v2: BlockFrame::kFrameBytes + kBlockPayloadBytes.
+     *          Block b therefore starts at kHeaderBytes + b * blockStride() in either version.
+     * @return Per-block stride in bytes.
+     * @throws None
+     */
+    std::uint64_t FileHeader::blockStride() const {
+        return CompressedPayload::kBlockPayloadBytes + (version == kVersionV1 ? 0 : BlockFrame::kFrameBytes);
+    }
+
+} // namespace crsce::common::format
@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <string>
 
 #include "common/exceptions/DecompressHeaderInvalid.h"
 
@@ -16,12 +17,14 @@ namespace crsce::common::format {
     /**
      * @name deserialize
      * @brief Deserialize a 28-byte buffer into a FileHeader.
-     * @details Validates buffer length, magic number, and CRC-32 checksum.
+     * @details Validates buffer length, magic number, CRC-32 checksum, and version (1 or 2).
+     *          A streamed header must set both counts to kStreamed and be version 2.
      *          All multi-byte fields are read as little-endian.
      * @param data Pointer to at least 28 bytes of header data.
      * @param len Length of the buffer (must be >= 28).
      * @return Deserialized FileHeader.
-     * @throws DecompressHeaderInvalid if len < 28, magic mismatch, or CRC-32 mismatch.
+     * @throws DecompressHeaderInvalid if len < 28, magic mismatch, CRC-32 mismatch, unknown version,
+     *         or a malformed streamed header.
      */
     FileHeader FileHeader::deserialize(const std::uint8_t *data, const std::size_t len) {
         if (len < kHeaderBytes) {
@@ -44,8 +47,20 @@ namespace crsce::common::format {
         }
 
         FileHeader hdr;
+        std::memcpy(&hdr.version, data + 4, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (hdr.version != kVersionV1 && hdr.version != kVersion) {
+            throw exceptions::DecompressHeaderInvalid("FileHeader::deserialize: unsupported version " +
+                                                      std::to_string(hdr.version));
+        }
         std::memcpy(&hdr.originalFileSizeBytes, data + 8, 8); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
         std::memcpy(&hdr.blockCount, data + 16, 8); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // Streamed headers mark both counts unknown, and need v2 frames to find the end.
+        const bool sizeUnknown = hdr.originalFileSizeBytes == kStreamed;
+        const bool countUnknown = hdr.blockCount == kStreamed;
+        if (sizeUnknown != countUnknown || (hdr.streamed() && hdr.version == kVersionV1)) {
+            throw exceptions::DecompressHeaderInvalid("FileHeader::deserialize: malformed streamed header");
+        }
         return hdr;
     }
 
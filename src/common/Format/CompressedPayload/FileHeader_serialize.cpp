@@ -28,7 +28,6 @@ namespace crsce::common::format {
         std::memcpy(buf.data() + 0, &magic, 4); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
         // Offset 4: version (little-endian uint16)
-        const std::uint16_t version = kVersion;
         std::memcpy(buf.data() + 4, &version, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
         // Offset 6: header_bytes (little-endian uint16)
@@ -0,0 +1,22 @@
+/**
+ * @file FileHeader_streamed.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief FileHeader::streamed() implementation.
+ */
+#include "common/Format/CompressedPayload/FileHeader.h"
+
+namespace crsce::common::format {
+
+    /**
+     * @name streamed
+     * @brief True if the sizes were unknown when the header was written.
+     * @details The compressor writes kStreamed in both counts when its input is a pipe; the
+     *          real sizes follow from the block count and the final block's frame.
+     * @return true if both originalFileSizeBytes and blockCount are kStreamed.
+     * @throws None
+     */
+    bool FileHeader::streamed() const {
+        return originalFileSizeBytes == kStreamed && blockCount == kStreamed;
+    }
+
+} // namespace crsce::common::format
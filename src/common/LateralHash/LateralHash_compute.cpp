@@ -8,6 +8,7 @@
 #include <array>
 #include <cstdint>
 
+#include "common/BitKernels/BitKernels.h"
 #include "common/Util/crc32_ieee.h"
 
 namespace crsce::common {
@@ -21,12 +22,7 @@ namespace crsce::common {
     std::array<std::uint8_t, LateralHash::kDigestBytes>
     LateralHash::compute(const std::array<std::uint64_t, 2> &row) {
         // Convert 2 uint64 words to 16 big-endian bytes
-        std::array<std::uint8_t, 16> msg{};
-        for (int w = 0; w < 2; ++w) {
-            for (int b = 7; b >= 0; --b) {
-                msg[(w * 8) + (7 - b)] = static_cast<std::uint8_t>(row[w] >> (b * 8)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-            }
-        }
+        const auto msg = bitkernels::rowToBytes(row);
         const std::uint32_t crc = util::crc32_ieee(msg.data(), msg.size());
         return {
             static_cast<std::uint8_t>((crc >> 24U) & 0xFFU),
@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <cstring>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <ios>
@@ -18,13 +19,14 @@
 #include <system_error>
 #include <vector>
 
+#include "common/Format/CompressedPayload/BlockFrame.h"
 #include "common/Util/crc32_ieee.h"
 
 namespace crsce::common::util {
 
 /**
  * @name validate_container
- * @brief Validate that a file is a syntactically correct CRSCE v1 container.
+ * @brief Validate that a file is a syntactically correct CRSCE v1 or v2 (framed or streamed) container.
  * @param cx_path Path to the candidate CRSCE container file.
  * @param err Output parameter set to a human-readable reason on failure.
  * @return bool True if the container passes structural validation; false otherwise.
@@ -58,7 +60,7 @@ bool validate_container(const std::filesystem::path &cx_path, std::string &err)
                                   | static_cast<std::uint16_t>(hdr[5]) << 8U; // NOLINT
     const std::uint16_t declared_size = static_cast<std::uint16_t>(hdr[6])
                                         | static_cast<std::uint16_t>(hdr[7]) << 8U; // NOLINT
-    if (version != 1U || declared_size != kHeaderSize) {
+    if ((version != 1U && version != 2U) || declared_size != kHeaderSize) {
         err = "invalid header: version/size";
         return false;
     }
@@ -82,32 +84,94 @@ bool validate_container(const std::filesystem::path &cx_path, std::string &err)
         return false;
     }
 
-    // Recompute expected block count from original size
+    static constexpr std::size_t kPayloadBytes = 1369; // CompressedPayload::kBlockPayloadBytes
+    const bool framed = version != 1U;
+    const std::size_t blockBytes = kPayloadBytes + (framed ? format::BlockFrame::kFrameBytes : 0U);
+    // A stored block (v2 kFlagStored) carries raw bits and is this much larger than a compressed one;
+    // no block is larger, so a hinted block (kFlagHint) adds less.
+    constexpr std::uint64_t kStoredExtra = format::BlockFrame::kStoredPayloadBytes - kPayloadBytes;
+
+    // Streamed v2 (compressed from a pipe): both counts are unknown in the header; the block
+    // count and the size follow from walking the frames to the last block's final frame.
+    constexpr std::uint64_t kStreamed = UINT64_MAX; // FileHeader::kStreamed
+    const bool streamed = framed && original_size_bytes == kStreamed && block_count == kStreamed;
     constexpr std::uint64_t kBitsPerBlock = 127ULL * 127ULL;
-    const std::uint64_t total_bits = original_size_bytes * 8ULL;
-    const std::uint64_t expect_blocks = (total_bits == 0ULL) ? 0ULL : ((total_bits + kBitsPerBlock - 1ULL) / kBitsPerBlock);
-    if (block_count != expect_blocks) {
-        err = "block_count mismatch";
-        return false;
-    }
+    if (streamed) {
+        if (static_cast<std::uint64_t>(fsz) == kHeaderSize) {
+            err = "file size mismatch";
+            return false;
+        }
+    } else {
+        // Recompute expected block count from original size
+        const std::uint64_t total_bits = original_size_bytes * 8ULL;
+        const std::uint64_t expect_blocks = (total_bits == 0ULL) ? 0ULL : ((total_bits + kBitsPerBlock - 1ULL) / kBitsPerBlock);
+        if (block_count != expect_blocks) {
+            err = "block_count mismatch";
+            return false;
+        }
 
-    // File size must match header + blocks * block_bytes
-    static constexpr std::size_t kBlockBytes = 1369; // CompressedPayload::kBlockPayloadBytes
-    const std::uint64_t expect_size = static_cast<std::uint64_t>(kHeaderSize)
-                                      + (block_count * static_cast<std::uint64_t>(kBlockBytes));
-    if (fsz != static_cast<std::uintmax_t>(expect_size)) {
-        err = "file size mismatch";
-        return false;
+        // File size must be header + blocks * block_bytes (v2 adds a BlockFrame per block),
+        // plus kStoredExtra for each stored block and the hint section of each hinted block.
+        const std::uint64_t expect_size = static_cast<std::uint64_t>(kHeaderSize)
+                                          + (block_count * static_cast<std::uint64_t>(blockBytes));
+        const std::uint64_t extra = static_cast<std::uint64_t>(fsz) - expect_size;
+        if (static_cast<std::uint64_t>(fsz) < expect_size
+            || (extra != 0U && (!framed || extra > block_count * kStoredExtra))) {
+            err = "file size mismatch";
+            return false;
+        }
     }
 
-    // Validate that every block is readable
-    for (std::uint64_t i = 0; i < block_count; ++i) {
-        std::vector<std::uint8_t> block(kBlockBytes);
+    // Validate that every block is readable; a v2 frame's flags give its payload size
+    bool final_seen = false;
+    for (std::uint64_t i = 0; streamed ? !final_seen : i < block_count; ++i) {
+        std::vector<std::uint8_t> block(framed ? format::BlockFrame::kFrameBytes : blockBytes);
         is.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(block.size())); // NOLINT
-        if (is.gcount() != static_cast<std::streamsize>(block.size())) {
+        bool complete = is.gcount() == static_cast<std::streamsize>(block.size());
+        if (framed && complete) {
+            const auto flags = format::BlockFrame::peekFlags(block.data());
+            block.resize(format::BlockFrame::kFrameBytes + format::BlockFrame::payloadBytes(flags));
+            const auto rest = static_cast<std::streamsize>(block.size() - format::BlockFrame::kFrameBytes);
+            is.read(reinterpret_cast<char*>(block.data() + format::BlockFrame::kFrameBytes), rest); // NOLINT
+            complete = is.gcount() == rest;
+            // A hinted block's trail length is in the part just read; the trail follows it.
+            const auto hint = complete ? format::BlockFrame::hintBytes(flags, block.data() + format::BlockFrame::kFrameBytes) // NOLINT
+                                       : std::size_t{0};
+            if (hint > 0) {
+                const auto fixed = block.size();
+                block.resize(fixed + hint);
+                is.read(reinterpret_cast<char*>(block.data() + fixed), static_cast<std::streamsize>(hint)); // NOLINT
+                complete = is.gcount() == static_cast<std::streamsize>(hint);
+            }
+        }
+        if (!complete) {
             err = "short read in block payload";
             return false;
         }
+        if (framed) {
+            format::BlockFrame frame;
+            try {
+                frame = format::BlockFrame::deserialize(block.data(), block.size(), i);
+            } catch (const std::exception &e) {
+                err = e.what();
+                return false;
+            }
+            // Only the last block of a streamed container is final, and it must end on a byte.
+            final_seen = frame.final();
+            if (frame.final() && !streamed && i + 1U != block_count) {
+                err = "misplaced final block frame";
+                return false;
+            }
+            if (frame.final() && (((i * kBitsPerBlock) + frame.finalBits) % 8U) != 0U) {
+                err = "final block ends mid-byte";
+                return false;
+            }
+        }
+    }
+    // Every byte must belong to a block: nothing may follow the last (or final) block.
+    if (is.peek() != std::ifstream::traits_type::eof()) {
+        err = streamed ? "misplaced final block frame" : "file size mismatch";
+        return false;
     }
     return true;
 }
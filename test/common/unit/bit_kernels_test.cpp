@@ -0,0 +1,150 @@
+/**
+ * @file bit_kernels_test.cpp
+ * @brief Unit tests for the word-level bit-matrix pack/unpack kernels.
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/BitKernels/BitKernels.h"
+#include "common/Csm/Csm.h"
+
+namespace crsce::common::bitkernels {
+namespace {
+
+    constexpr std::uint16_t kS = Csm::kS;
+    constexpr std::size_t kBlockBits = static_cast<std::size_t>(kS) * kS;
+
+    /**
+     * @brief Deterministic pseudo-random bytes.
+     */
+    std::vector<std::uint8_t> sampleBytes(const std::size_t n, std::uint32_t seed) {
+        std::vector<std::uint8_t> data(n);
+        for (auto &b : data) {
+            seed ^= seed << 13U;
+            seed ^= seed >> 17U;
+            seed ^= seed << 5U;
+            b = static_cast<std::uint8_t>(seed);
+        }
+        return data;
+    }
+
+    /**
+     * @brief Reference bit read (MSB-first); bits past the buffer read as zero.
+     */
+    std::uint8_t refBit(const std::vector<std::uint8_t> &data, const std::uint64_t pos) {
+        const auto byte = static_cast<std::size_t>(pos / 8);
+        if (byte >= data.size()) {
+            return 0;
+        }
+        return static_cast<std::uint8_t>((data[byte] >> (7 - (pos % 8))) & 1U);
+    }
+
+// ---------------------------------------------------------------------------
+// Scalar helpers
+// ---------------------------------------------------------------------------
+
+TEST(BitKernelsTest, LoadBits64MatchesReferenceAtEveryShift) {
+    const auto data = sampleBytes(40, 0xC0FFEEU);
+    for (std::uint64_t pos = 0; pos < 200; ++pos) {
+        const auto v = loadBits64(data.data(), data.size(), pos);
+        for (unsigned i = 0; i < 64; ++i) {
+            ASSERT_EQ((v >> (63U - i)) & 1U, refBit(data, pos + i)) << "pos " << pos << " bit " << i;
+        }
+    }
+}
+
+TEST(BitKernelsTest, OrBits64WritesOnlyRequestedBits) {
+    for (unsigned shift = 0; shift < 8; ++shift) {
+        std::vector<std::uint8_t> buf(12, 0);
+        orBits64(buf.data(), buf.size(), 8 + shift, ~std::uint64_t{0}, 63U);
+        for (std::uint64_t pos = 0; pos < buf.size() * 8; ++pos) {
+            const bool inside = pos >= 8 + shift && pos < 8 + shift + 63;
+            ASSERT_EQ(refBit(buf, pos), inside ? 1U : 0U) << "shift " << shift << " pos " << pos;
+        }
+    }
+}
+
+TEST(BitKernelsTest, OrBits64NeverWritesPastLength) {
+    std::array<std::uint8_t, 4> buf{};
+    orBits64(buf.data(), 3, 5, ~std::uint64_t{0}, 64U);
+    EXPECT_EQ(buf[0], 0x07);
+    EXPECT_EQ(buf[1], 0xFF);
+    EXPECT_EQ(buf[2], 0xFF);
+    EXPECT_EQ(buf[3], 0x00);
+}
+
+TEST(BitKernelsTest, RowToBytesIsBigEndian) {
+    const std::array<std::uint64_t, 2> row{0x0102030405060708ULL, 0x1112131415161718ULL};
+    const auto bytes = rowToBytes(row);
+    const std::array<std::uint8_t, 16> expected{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                                                0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18};
+    EXPECT_EQ(bytes, expected);
+}
+
+// ---------------------------------------------------------------------------
+// Row kernels
+// ---------------------------------------------------------------------------
+
+TEST(BitKernelsTest, UnpackRowsMatchesPerBitReference) {
+    const auto data = sampleBytes(3 * 2017, 0x1234567U);
+    for (const std::uint64_t start : {0ULL, 1ULL, 7ULL, 16129ULL, 32258ULL}) {
+        Csm csm;
+        unpackRows(data.data(), data.size(), start, kBlockBits, csm);
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            for (std::uint16_t c = 0; c < kS; ++c) {
+                const auto pos = start + (static_cast<std::uint64_t>(r) * kS) + c;
+                ASSERT_EQ(csm.get(r, c), refBit(data, pos)) << "start " << start << " (" << r << "," << c << ")";
+            }
+            EXPECT_EQ(csm.getRow(r)[1] & 1U, 0U) << "padding column must stay clear";
+        }
+    }
+}
+
+TEST(BitKernelsTest, UnpackRowsZeroesCellsBeyondBitCount) {
+    const std::vector<std::uint8_t> data(2017, 0xFF);
+    for (const std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{63}, std::size_t{64},
+                                    std::size_t{127}, std::size_t{200}, std::size_t{8000}}) {
+        Csm csm;
+        unpackRows(data.data(), data.size(), 0, count, csm);
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            for (std::uint16_t c = 0; c < kS; ++c) {
+                const auto flat = (static_cast<std::size_t>(r) * kS) + c;
+                ASSERT_EQ(csm.get(r, c), flat < count ? 1U : 0U) << "count " << count << " flat " << flat;
+            }
+        }
+    }
+}
+
+TEST(BitKernelsTest, PackRowsIsInverseOfUnpackRowsAtAnyOffset) {
+    const auto data = sampleBytes(2017, 0xBADC0DEU);
+    Csm csm;
+    unpackRows(data.data(), data.size(), 0, kBlockBits, csm);
+    for (const std::uint64_t offset : {0ULL, 1ULL, 3ULL, 7ULL}) {
+        std::vector<std::uint8_t> out((offset + kBlockBits + 7) / 8, 0);
+        packRows(csm, out.data(), out.size(), offset);
+        for (std::uint64_t i = 0; i < out.size() * 8; ++i) {
+            const auto expected = (i >= offset && i < offset + kBlockBits) ? refBit(data, i - offset) : 0U;
+            ASSERT_EQ(refBit(out, i), expected) << "offset " << offset << " bit " << i;
+        }
+    }
+}
+
+TEST(BitKernelsTest, CsmVecMatchesPerBitSerialization) {
+    const auto data = sampleBytes(2017, 0x5151U);
+    Csm csm;
+    unpackRows(data.data(), data.size(), 0, kBlockBits, csm);
+    const auto v = csm.vec();
+    ASSERT_EQ(v.size(), (kBlockBits + 7) / 8);
+    for (std::size_t i = 0; i < kBlockBits; ++i) {
+        ASSERT_EQ(refBit(v, i), csm.get(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS)));
+    }
+    EXPECT_EQ(v.back() & 0x7FU, 0U) << "trailing pad bits must be zero";
+}
+
+} // namespace
+} // namespace crsce::common::bitkernels
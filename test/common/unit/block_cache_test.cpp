@@ -0,0 +1,63 @@
+/**
+ * @file block_cache_test.cpp
+ * @brief Unit tests for BlockCache (content-addressed per-block result cache).
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common/Util/BlockCache.h"
+
+namespace crsce::common::util {
+namespace {
+
+using Cache = BlockCache<int>;
+
+Cache::Key keyFor(const std::uint8_t fill) {
+    const std::vector<std::uint8_t> bytes(1369, fill);
+    return Cache::keyOf(bytes.data(), bytes.size());
+}
+
+TEST(BlockCacheTest, EqualContentHitsAndCounts) {
+    Cache cache(8);
+    EXPECT_FALSE(cache.find(keyFor(1)).has_value());
+    cache.insert(keyFor(1), 42);
+    const auto hit = cache.find(keyFor(1));
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(*hit, 42);
+    EXPECT_FALSE(cache.find(keyFor(2)).has_value());
+    EXPECT_EQ(cache.hits(), 1U);
+    EXPECT_EQ(cache.misses(), 2U);
+}
+
+TEST(BlockCacheTest, FirstInsertWins) {
+    Cache cache(8);
+    cache.insert(keyFor(1), 1);
+    cache.insert(keyFor(1), 2);
+    EXPECT_EQ(cache.find(keyFor(1)).value_or(0), 1);
+    EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST(BlockCacheTest, EvictsOldestWhenFull) {
+    Cache cache(2);
+    cache.insert(keyFor(1), 1);
+    cache.insert(keyFor(2), 2);
+    cache.insert(keyFor(3), 3);
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_FALSE(cache.find(keyFor(1)).has_value());
+    EXPECT_TRUE(cache.find(keyFor(2)).has_value());
+    EXPECT_TRUE(cache.find(keyFor(3)).has_value());
+}
+
+TEST(BlockCacheTest, ZeroCapacityDisables) {
+    Cache cache(0);
+    EXPECT_FALSE(cache.enabled());
+    cache.insert(keyFor(1), 1);
+    EXPECT_FALSE(cache.find(keyFor(1)).has_value());
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+} // namespace
+} // namespace crsce::common::util
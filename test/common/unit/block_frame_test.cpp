@@ -0,0 +1,219 @@
+/**
+ * @file block_frame_test.cpp
+ * @brief Unit tests for BlockFrame (v2 per-block framing).
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "common/exceptions/DecompressBlockCorrupt.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+namespace crsce::common::format {
+namespace {
+
+/**
+ * @brief Build a framed block around a recognizable payload.
+ */
+std::vector<std::uint8_t> framed(const std::uint64_t blockId) {
+    std::vector<std::uint8_t> payload(CompressedPayload::kBlockPayloadBytes);
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<std::uint8_t>(i * 31U);
+    }
+    BlockFrame frame;
+    frame.blockId = blockId;
+    return frame.serialize(payload);
+}
+
+/**
+ * @brief A compressed payload filled with fill, followed by the hint section for trail.
+ */
+std::vector<std::uint8_t> hintedPayload(const std::vector<std::uint8_t> &trail, const std::uint8_t fill) {
+    const auto hint = DecodeHint::serialize(trail);
+    std::vector<std::uint8_t> payload(CompressedPayload::kBlockPayloadBytes + hint.size(), fill);
+    std::copy(hint.begin(), hint.end(), payload.begin() + CompressedPayload::kBlockPayloadBytes);
+    return payload;
+}
+
+TEST(BlockFrameTest, SerializePrependsFrame) {
+    const auto buf = framed(7);
+    ASSERT_EQ(buf.size(), BlockFrame::kFrameBytes + CompressedPayload::kBlockPayloadBytes);
+    std::uint64_t id = 0;
+    std::memcpy(&id, buf.data(), 8);
+    EXPECT_EQ(id, 7U);
+    EXPECT_EQ(buf[BlockFrame::kFrameBytes + 1], 31U);
+}
+
+TEST(BlockFrameTest, RoundTrip) {
+    const auto buf = framed(42);
+    const auto frame = BlockFrame::deserialize(buf.data(), buf.size(), 42);
+    EXPECT_EQ(frame.blockId, 42U);
+    EXPECT_EQ(frame.flags, 0U);
+}
+
+TEST(BlockFrameTest, EveryFlippedBitIsDetected) {
+    const auto clean = framed(1);
+    // Probe a spread of bit positions across the frame and payload.
+    for (std::size_t byte = 0; byte < clean.size(); byte += 97) {
+        auto buf = clean;
+        buf[byte] ^= 0x10U;
+        EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 1)),
+                     exceptions::DecompressBlockCorrupt) << "byte " << byte;
+    }
+}
+
+TEST(BlockFrameTest, WrongBlockIdThrows) {
+    const auto buf = framed(3);
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 4)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, UnknownFlagsThrow) {
+    BlockFrame frame;
+    frame.flags = 0x8000U;
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(CompressedPayload::kBlockPayloadBytes, 0));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, FinalFrameRoundTripsBitCount) {
+    BlockFrame frame;
+    frame.blockId = 5;
+    frame.flags = BlockFrame::kFlagFinal;
+    frame.finalBits = 1234;
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(CompressedPayload::kBlockPayloadBytes, 0));
+    const auto got = BlockFrame::deserialize(buf.data(), buf.size(), 5);
+    EXPECT_TRUE(got.final());
+    EXPECT_EQ(got.finalBits, 1234U);
+}
+
+TEST(BlockFrameTest, FinalBitsWithoutFinalFlagThrow) {
+    BlockFrame frame;
+    frame.finalBits = 8;
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(CompressedPayload::kBlockPayloadBytes, 0));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, FinalBitsBeyondOneBlockThrow) {
+    BlockFrame frame;
+    frame.flags = BlockFrame::kFlagFinal;
+    frame.finalBits = (CompressedPayload::kS * CompressedPayload::kS) + 1;
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(CompressedPayload::kBlockPayloadBytes, 0));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, StoredFrameRoundTripsRawPayload) {
+    BlockFrame frame;
+    frame.blockId = 9;
+    frame.flags = BlockFrame::kFlagStored;
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(BlockFrame::kStoredPayloadBytes, 0x5A));
+    ASSERT_EQ(buf.size(), BlockFrame::kFrameBytes + BlockFrame::kStoredPayloadBytes);
+    EXPECT_EQ(BlockFrame::payloadBytes(BlockFrame::peekFlags(buf.data())), BlockFrame::kStoredPayloadBytes);
+    const auto got = BlockFrame::deserialize(buf.data(), buf.size(), 9);
+    EXPECT_TRUE(got.stored());
+    EXPECT_FALSE(got.final());
+}
+
+TEST(BlockFrameTest, PayloadLengthMustMatchStoredFlag) {
+    BlockFrame frame;
+    frame.flags = BlockFrame::kFlagStored;
+    const auto shortStored = frame.serialize(std::vector<std::uint8_t>(CompressedPayload::kBlockPayloadBytes, 0));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(shortStored.data(), shortStored.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+    frame.flags = 0;
+    const auto longPlain = frame.serialize(std::vector<std::uint8_t>(BlockFrame::kStoredPayloadBytes, 0));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(longPlain.data(), longPlain.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, HintedFrameRoundTripsTrail) {
+    const std::vector<std::uint8_t> trail{1, 0, 1, 1, 0, 0, 1, 0, 1};
+    const auto payload = hintedPayload(trail, 0x11);
+    BlockFrame frame;
+    frame.blockId = 2;
+    frame.flags = BlockFrame::kFlagHint;
+    const auto buf = frame.serialize(payload);
+
+    // Two-phase read: the fixed part carries the trail length, which gives the rest.
+    const auto flags = BlockFrame::peekFlags(buf.data());
+    const auto fixed = BlockFrame::payloadBytes(flags);
+    EXPECT_EQ(fixed, CompressedPayload::kBlockPayloadBytes + DecodeHint::kHeaderBytes);
+    EXPECT_EQ(fixed + BlockFrame::hintBytes(flags, buf.data() + BlockFrame::kFrameBytes), payload.size());
+    const auto got = BlockFrame::deserialize(buf.data(), buf.size(), 2);
+    EXPECT_TRUE(got.hinted());
+    EXPECT_FALSE(got.stored());
+    const auto back = DecodeHint::deserialize(buf.data() + BlockFrame::kFrameBytes + CompressedPayload::kBlockPayloadBytes,
+                                              payload.size() - CompressedPayload::kBlockPayloadBytes);
+    ASSERT_TRUE(back.has_value());
+    EXPECT_EQ(*back, trail);
+}
+
+TEST(BlockFrameTest, HintedFrameRejectsBadLengths) {
+    const auto payload = hintedPayload(std::vector<std::uint8_t>(20, 1), 0);
+    BlockFrame frame;
+    frame.flags = BlockFrame::kFlagHint;
+    const auto shortBuf = frame.serialize(std::vector<std::uint8_t>(payload.begin(), payload.end() - 1));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(shortBuf.data(), shortBuf.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+    frame.flags = BlockFrame::kFlagHint | BlockFrame::kFlagStored;
+    const auto both = frame.serialize(payload);
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(both.data(), both.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, LayoutRoundTripsInFlags) {
+    BlockFrame frame;
+    frame.blockId = 4;
+    frame.flags = BlockFrame::layoutFlags(3);
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(CompressedPayload::kBlockPayloadBytes, 0));
+    const auto got = BlockFrame::deserialize(buf.data(), buf.size(), 4);
+    EXPECT_EQ(got.layout(), 3U);
+    EXPECT_FALSE(got.stored());
+    EXPECT_EQ(BlockFrame::payloadBytes(got.flags), CompressedPayload::kBlockPayloadBytes);
+}
+
+TEST(BlockFrameTest, StoredFrameRejectsLayout) {
+    BlockFrame frame;
+    frame.flags = BlockFrame::kFlagStored | BlockFrame::layoutFlags(1);
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(BlockFrame::kStoredPayloadBytes, 0));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, PaddedFlagRoundTrips) {
+    BlockFrame frame;
+    frame.blockId = 2;
+    frame.flags = BlockFrame::kFlagFinal | BlockFrame::kFlagPadded | BlockFrame::layoutFlags(2);
+    frame.finalBits = 900;
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(CompressedPayload::kBlockPayloadBytes, 0));
+    const auto got = BlockFrame::deserialize(buf.data(), buf.size(), 2);
+    EXPECT_TRUE(got.padded());
+    EXPECT_EQ(got.layout(), 2U);
+    EXPECT_EQ(got.finalBits, 900U);
+}
+
+TEST(BlockFrameTest, StoredFrameRejectsPadding) {
+    BlockFrame frame;
+    frame.flags = BlockFrame::kFlagStored | BlockFrame::kFlagPadded;
+    const auto buf = frame.serialize(std::vector<std::uint8_t>(BlockFrame::kStoredPayloadBytes, 0));
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+TEST(BlockFrameTest, ShortBufferThrows) {
+    const std::vector<std::uint8_t> buf(BlockFrame::kFrameBytes, 0);
+    EXPECT_THROW(static_cast<void>(BlockFrame::deserialize(buf.data(), buf.size(), 0)),
+                 exceptions::DecompressBlockCorrupt);
+}
+
+} // namespace
+} // namespace crsce::common::format
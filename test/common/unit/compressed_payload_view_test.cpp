@@ -0,0 +1,127 @@
+/**
+ * @file compressed_payload_view_test.cpp
+ * @brief Unit tests for CompressedPayloadView (zero-copy payload decoding).
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "common/exceptions/DecompressHeaderInvalid.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+
+namespace crsce::common::format {
+namespace {
+
+constexpr std::uint16_t kS = CompressedPayload::kS;
+constexpr std::uint16_t kDiag = CompressedPayload::kDiagCount;
+
+/**
+ * @brief Maximum legal value on diagonal k (its length).
+ */
+std::uint16_t diagMax(const std::uint16_t k) {
+    return static_cast<std::uint16_t>(k < kS ? k + 1 : (2 * kS) - 1 - k);
+}
+
+/**
+ * @brief Fill every field of a payload with pseudo-random in-range values.
+ */
+CompressedPayload randomPayload(const std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    CompressedPayload p;
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        std::array<std::uint8_t, CompressedPayload::kLHDigestBytes> lh{};
+        for (auto &b : lh) { b = static_cast<std::uint8_t>(rng()); }
+        p.setLH(r, lh);
+    }
+    std::array<std::uint8_t, CompressedPayload::kBHDigestBytes> bh{};
+    for (auto &b : bh) { b = static_cast<std::uint8_t>(rng()); }
+    p.setBH(bh);
+    p.setDI(static_cast<std::uint8_t>(rng()));
+    for (std::uint16_t k = 0; k < kS; ++k) {
+        p.setLSM(k, static_cast<std::uint16_t>(rng() % (kS + 1)));
+        p.setVSM(k, static_cast<std::uint16_t>(rng() % (kS + 1)));
+        p.setLTP1SM(k, static_cast<std::uint16_t>(rng() % (kS + 1)));
+        p.setLTP2SM(k, static_cast<std::uint16_t>(rng() % (kS + 1)));
+    }
+    for (std::uint16_t k = 0; k < kDiag; ++k) {
+        p.setDSM(k, static_cast<std::uint16_t>(rng() % (diagMax(k) + 1U)));
+        p.setXSM(k, static_cast<std::uint16_t>(rng() % (diagMax(k) + 1U)));
+    }
+    return p;
+}
+
+TEST(CompressedPayloadViewTest, DecodesEveryFieldLikeTheSetters) {
+    for (std::uint32_t seed = 1; seed <= 8; ++seed) {
+        const auto p = randomPayload(seed);
+        const auto buf = p.serializeBlock();
+        const CompressedPayloadView view(buf.data(), buf.size());
+
+        EXPECT_EQ(view.getDI(), p.getDI());
+        EXPECT_EQ(view.getBH(), p.getBH());
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            const auto lh = view.lh(r);
+            const auto expected = p.getLH(r);
+            EXPECT_TRUE(std::equal(lh.begin(), lh.end(), expected.begin())) << "LH row " << r;
+        }
+
+        std::vector<std::uint16_t> v;
+        view.unpackLSM(v);
+        ASSERT_EQ(v.size(), kS);
+        for (std::uint16_t k = 0; k < kS; ++k) { EXPECT_EQ(v[k], p.getLSM(k)) << "LSM " << k; }
+        view.unpackVSM(v);
+        for (std::uint16_t k = 0; k < kS; ++k) { EXPECT_EQ(v[k], p.getVSM(k)) << "VSM " << k; }
+        view.unpackDSM(v);
+        ASSERT_EQ(v.size(), kDiag);
+        for (std::uint16_t k = 0; k < kDiag; ++k) { EXPECT_EQ(v[k], p.getDSM(k)) << "DSM " << k; }
+        view.unpackXSM(v);
+        for (std::uint16_t k = 0; k < kDiag; ++k) { EXPECT_EQ(v[k], p.getXSM(k)) << "XSM " << k; }
+        view.unpackLTP1SM(v);
+        ASSERT_EQ(v.size(), kS);
+        for (std::uint16_t k = 0; k < kS; ++k) { EXPECT_EQ(v[k], p.getLTP1SM(k)) << "LTP1 " << k; }
+        view.unpackLTP2SM(v);
+        for (std::uint16_t k = 0; k < kS; ++k) { EXPECT_EQ(v[k], p.getLTP2SM(k)) << "LTP2 " << k; }
+    }
+}
+
+TEST(CompressedPayloadViewTest, MaxValuesSurviveFieldBoundaries) {
+    CompressedPayload p;
+    for (std::uint16_t k = 0; k < kS; ++k) {
+        p.setLSM(k, kS);
+        p.setVSM(k, kS);
+        p.setLTP1SM(k, kS);
+        p.setLTP2SM(k, kS);
+    }
+    for (std::uint16_t k = 0; k < kDiag; ++k) {
+        p.setDSM(k, diagMax(k));
+        p.setXSM(k, diagMax(k));
+    }
+    const auto buf = p.serializeBlock();
+    const CompressedPayloadView view(buf.data(), buf.size());
+    std::vector<std::uint16_t> v;
+    view.unpackXSM(v);
+    for (std::uint16_t k = 0; k < kDiag; ++k) { EXPECT_EQ(v[k], diagMax(k)) << "XSM " << k; }
+    view.unpackLTP2SM(v);
+    for (std::uint16_t k = 0; k < kS; ++k) { EXPECT_EQ(v[k], kS) << "LTP2 " << k; }
+}
+
+TEST(CompressedPayloadViewTest, DigestsAreSpansIntoTheBuffer) {
+    const auto buf = randomPayload(3).serializeBlock();
+    const CompressedPayloadView view(buf.data(), buf.size());
+    EXPECT_EQ(view.lh(0).data(), buf.data());
+    EXPECT_EQ(view.lh(1).data(), buf.data() + CompressedPayload::kLHDigestBytes); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+TEST(CompressedPayloadViewTest, ShortBufferThrows) {
+    const std::vector<std::uint8_t> tooSmall(CompressedPayload::kBlockPayloadBytes - 1, 0);
+    EXPECT_THROW(CompressedPayloadView(tooSmall.data(), tooSmall.size()), exceptions::DecompressHeaderInvalid);
+}
+
+} // namespace
+} // namespace crsce::common::format
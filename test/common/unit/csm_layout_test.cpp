@@ -0,0 +1,99 @@
+/**
+ * @file csm_layout_test.cpp
+ * @brief Unit tests for csmlayout (per-block layout transforms).
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
+
+namespace crsce::common::csmlayout {
+namespace {
+
+constexpr std::uint16_t kS = Csm::kS;
+constexpr std::uint16_t kCells = kS * kS;
+
+/**
+ * @brief Every layout, RowMajor included.
+ */
+std::vector<Layout> allLayouts() {
+    std::vector<Layout> out;
+    for (std::uint8_t l = 0; l < kLayoutCount; ++l) {
+        out.push_back(static_cast<Layout>(l));
+    }
+    return out;
+}
+
+/**
+ * @brief A block with an irregular bit pattern.
+ */
+Csm patterned() {
+    Csm csm;
+    for (std::uint16_t i = 0; i < kCells; ++i) {
+        if ((i * 2654435761U) % 7U < 2U) {
+            csm.set(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS), 1);
+        }
+    }
+    return csm;
+}
+
+TEST(CsmLayoutTest, CellOfIsAPermutation) {
+    for (const auto layout : allLayouts()) {
+        std::vector<bool> seen(kCells, false);
+        for (std::uint16_t i = 0; i < kCells; ++i) {
+            const auto p = cellOf(layout, i);
+            ASSERT_LT(p, kCells) << name(layout);
+            EXPECT_FALSE(seen[p]) << name(layout) << " cell " << p;
+            seen[p] = true;
+        }
+    }
+}
+
+TEST(CsmLayoutTest, InvertUndoesApply) {
+    const auto csm = patterned();
+    for (const auto layout : allLayouts()) {
+        const auto back = invert(apply(csm, layout), layout);
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            ASSERT_EQ(back.getRow(r), csm.getRow(r)) << name(layout) << " row " << r;
+        }
+    }
+}
+
+TEST(CsmLayoutTest, TransposeSwapsRowsAndColumns) {
+    Csm csm;
+    csm.set(3, 100, 1);
+    const auto laid = apply(csm, Layout::Transpose);
+    EXPECT_EQ(laid.get(100, 3), 1U);
+    EXPECT_EQ(laid.get(3, 100), 0U);
+}
+
+TEST(CsmLayoutTest, BitPlaneGathersEachBitOfEveryByte) {
+    // ASCII-like bytes: bit 7 (the first bit of each byte) is always zero.
+    Csm csm;
+    for (std::uint16_t i = 0; i < kBytes * 8; ++i) {
+        if (i % 8 != 0 && (i % 3) == 0) {
+            csm.set(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS), 1);
+        }
+    }
+    const auto laid = apply(csm, Layout::BitPlane);
+    // Plane 0 fills cells [0, kBytes): the first kBytes / kS rows are entirely zero.
+    for (std::uint16_t r = 0; r < kBytes / kS; ++r) {
+        EXPECT_EQ(laid.popcount(r), 0U) << "row " << r;
+    }
+}
+
+TEST(CsmLayoutTest, ByteColumnGroupsRecordFields) {
+    // Byte 1 of every 16-byte record becomes contiguous, right after the byte-0 column.
+    constexpr std::uint16_t kRecords = kBytes / kRecordBytes;
+    EXPECT_EQ(cellOf(Layout::ByteColumn, 8), kRecords * 8);
+    EXPECT_EQ(cellOf(Layout::ByteColumn, kRecordBytes * 8), 8U);
+    EXPECT_EQ(cellOf(Layout::ByteColumn, kCells - 1), kCells - 1);
+}
+
+} // namespace
+} // namespace crsce::common::csmlayout
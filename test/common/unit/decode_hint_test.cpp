@@ -0,0 +1,64 @@
+/**
+ * @file decode_hint_test.cpp
+ * @brief Unit tests for DecodeHint (optional per-block search trail).
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/Format/CompressedPayload/DecodeHint.h"
+
+namespace crsce::common::format {
+namespace {
+
+TEST(DecodeHintTest, SerializePacksBitsMsbFirst) {
+    const std::vector<std::uint8_t> trail{1, 0, 0, 0, 0, 0, 0, 1, 1, 1};
+    const auto bytes = DecodeHint::serialize(trail);
+    ASSERT_EQ(bytes.size(), DecodeHint::kHeaderBytes + 2U);
+    EXPECT_EQ(bytes[0], 10U); // trail_bits, little-endian
+    EXPECT_EQ(bytes[1], 0U);
+    EXPECT_EQ(bytes[2], 0x81U);
+    EXPECT_EQ(bytes[3], 0xC0U);
+    EXPECT_EQ(DecodeHint::trailBytes(bytes.data()), 2U);
+}
+
+TEST(DecodeHintTest, RoundTrip) {
+    std::vector<std::uint8_t> trail;
+    for (std::size_t i = 0; i < 183; ++i) {
+        trail.push_back(static_cast<std::uint8_t>((i * 7U) % 3U == 0U));
+    }
+    const auto bytes = DecodeHint::serialize(trail);
+    const auto back = DecodeHint::deserialize(bytes.data(), bytes.size());
+    ASSERT_TRUE(back.has_value());
+    EXPECT_EQ(*back, trail);
+}
+
+TEST(DecodeHintTest, EmptyTrailIsJustTheHeader) {
+    const auto bytes = DecodeHint::serialize({});
+    ASSERT_EQ(bytes.size(), DecodeHint::kHeaderBytes);
+    const auto back = DecodeHint::deserialize(bytes.data(), bytes.size());
+    ASSERT_TRUE(back.has_value());
+    EXPECT_TRUE(back->empty());
+}
+
+TEST(DecodeHintTest, LengthMismatchIsRejected) {
+    auto bytes = DecodeHint::serialize(std::vector<std::uint8_t>(9, 1));
+    EXPECT_FALSE(DecodeHint::deserialize(bytes.data(), bytes.size() - 1).has_value());
+    bytes.push_back(0);
+    EXPECT_FALSE(DecodeHint::deserialize(bytes.data(), bytes.size()).has_value());
+    EXPECT_FALSE(DecodeHint::deserialize(bytes.data(), 1).has_value());
+}
+
+TEST(DecodeHintTest, OverlongTrailIsRejected) {
+    const std::size_t bits = DecodeHint::kMaxTrailBits + 8;
+    std::vector<std::uint8_t> bytes(DecodeHint::kHeaderBytes + (bits / 8), 0);
+    bytes[0] = static_cast<std::uint8_t>(bits & 0xFFU);
+    bytes[1] = static_cast<std::uint8_t>(bits >> 8U);
+    EXPECT_FALSE(DecodeHint::deserialize(bytes.data(), bytes.size()).has_value());
+}
+
+} // namespace
+} // namespace crsce::common::format
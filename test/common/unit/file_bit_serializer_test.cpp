@@ -0,0 +1,139 @@
+/**
+ * @file file_bit_serializer_test.cpp
+ * @brief Unit tests for FileBitSerializer bulk bit extraction.
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/FileBitSerializer/FileBitSerializer.h"
+#include "helpers/tmp_dir.h"
+
+namespace crsce::common {
+namespace {
+
+    /**
+     * @brief Write bytes to a fresh file under the temp directory and return its path.
+     */
+    std::string writeTemp(const std::string &name, const std::vector<std::uint8_t> &data) {
+        const auto path = (std::filesystem::path(tmp_dir()) / name).string();
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(data.data()), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                  static_cast<std::streamsize>(data.size()));
+        return path;
+    }
+
+    /**
+     * @brief Pseudo-random bytes spanning several 1 KiB refill chunks.
+     */
+    std::vector<std::uint8_t> sampleBytes(const std::size_t n) {
+        std::vector<std::uint8_t> data(n);
+        std::uint32_t x = 0x12345678U;
+        for (auto &b : data) {
+            x = (x * 1103515245U) + 12345U;
+            b = static_cast<std::uint8_t>(x >> 16U);
+        }
+        return data;
+    }
+
+// ---------------------------------------------------------------------------
+// popBits
+// ---------------------------------------------------------------------------
+
+TEST(FileBitSerializerTest, PopBitsMatchesPopAcrossUnalignedBlocks) {
+    const auto data = sampleBytes(5000);
+    const auto path = writeTemp("crsce_fbs_popbits.bin", data);
+
+    FileBitSerializer bulk(path);
+    FileBitSerializer single(path);
+    ASSERT_TRUE(bulk.good());
+
+    // 16,129-bit blocks (kS = 127) start mid-byte after the first one.
+    constexpr std::size_t kBlockBits = 16129;
+    std::size_t total = 0;
+    while (true) {
+        std::vector<std::uint8_t> block;
+        const auto got = bulk.popBits(block, kBlockBits);
+        ASSERT_EQ(block.size(), (kBlockBits + 7) / 8);
+        for (std::size_t i = 0; i < kBlockBits; ++i) {
+            const bool bit = ((block[i / 8] >> (7 - (i % 8))) & 1U) != 0;
+            if (i < got) {
+                const auto expected = single.pop();
+                ASSERT_TRUE(expected.has_value());
+                ASSERT_EQ(bit, *expected) << "bit " << (total + i);
+            } else {
+                ASSERT_FALSE(bit) << "padding bit " << i << " must be zero";
+            }
+        }
+        total += got;
+        if (got < kBlockBits) {
+            break;
+        }
+    }
+    EXPECT_EQ(total, data.size() * 8);
+    EXPECT_FALSE(single.pop().has_value());
+    std::filesystem::remove(path);
+}
+
+TEST(FileBitSerializerTest, PopBitsAfterPartialByteKeepsAlignment) {
+    const auto path = writeTemp("crsce_fbs_offset.bin", {0b10110011, 0b01011100});
+    FileBitSerializer s(path);
+    ASSERT_EQ(s.pop(), std::optional<bool>(true));
+    ASSERT_EQ(s.pop(), std::optional<bool>(false));
+    ASSERT_EQ(s.pop(), std::optional<bool>(true));
+
+    std::vector<std::uint8_t> out;
+    EXPECT_EQ(s.popBits(out, 9), 9U);
+    ASSERT_EQ(out.size(), 2U);
+    // Remaining bits of byte 0: 10011, then 0101 from byte 1 -> 10011010 1.......
+    EXPECT_EQ(out[0], 0b10011010);
+    EXPECT_EQ(out[1], 0b10000000);
+
+    EXPECT_EQ(s.popBits(out, 16), 4U);
+    EXPECT_EQ(out[0], 0b11000000);
+    std::filesystem::remove(path);
+}
+
+TEST(FileBitSerializerTest, PopBitsAtEofReturnsZero) {
+    const auto path = writeTemp("crsce_fbs_empty.bin", {});
+    FileBitSerializer s(path);
+    std::vector<std::uint8_t> out;
+    EXPECT_EQ(s.popBits(out, 8), 0U);
+    EXPECT_EQ(out, std::vector<std::uint8_t>{0});
+    std::filesystem::remove(path);
+}
+
+TEST(FileBitSerializerTest, StreamConstructorMatchesFileConstructor) {
+    const auto data = sampleBytes(3000);
+    const auto path = writeTemp("crsce_fbs_stream.bin", data);
+    std::istringstream pipe(std::string(data.begin(), data.end()));
+
+    FileBitSerializer fromFile(path);
+    FileBitSerializer fromStream(pipe);
+    ASSERT_TRUE(fromStream.good());
+    std::vector<std::uint8_t> a;
+    std::vector<std::uint8_t> b;
+    while (true) {
+        const auto gotA = fromFile.popBits(a, 16129);
+        const auto gotB = fromStream.popBits(b, 16129);
+        ASSERT_EQ(gotA, gotB);
+        ASSERT_EQ(a, b);
+        if (gotA == 0) {
+            break;
+        }
+    }
+    EXPECT_FALSE(fromStream.has_next());
+    std::filesystem::remove(path);
+}
+
+} // namespace
+} // namespace crsce::common
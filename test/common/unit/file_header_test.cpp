@@ -10,6 +10,8 @@
 #include <vector>
 
 #include "common/exceptions/DecompressHeaderInvalid.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
 #include "common/Format/CompressedPayload/FileHeader.h"
 
 namespace crsce::common::format {
@@ -24,8 +26,9 @@ TEST(FileHeaderTest, MagicConstantIsCRSC) {
     EXPECT_EQ(FileHeader::kMagic, 0x43525343U);
 }
 
-TEST(FileHeaderTest, VersionConstantIs1) {
-    EXPECT_EQ(FileHeader::kVersion, 1);
+TEST(FileHeaderTest, VersionConstantIs2) {
+    EXPECT_EQ(FileHeader::kVersion, 2);
+    EXPECT_EQ(FileHeader::kVersionV1, 1);
 }
 
 TEST(FileHeaderTest, HeaderBytesConstantIs28) {
@@ -40,6 +43,7 @@ TEST(FileHeaderTest, DefaultConstructionFieldsAreZero) {
     const FileHeader hdr;
     EXPECT_EQ(hdr.originalFileSizeBytes, 0U);
     EXPECT_EQ(hdr.blockCount, 0U);
+    EXPECT_EQ(hdr.version, FileHeader::kVersion);
 }
 
 // ---------------------------------------------------------------------------
@@ -62,7 +66,7 @@ TEST(FileHeaderTest, SerializeMagicBytesAreCRSC) {
     EXPECT_EQ(magic, FileHeader::kMagic);
 }
 
-TEST(FileHeaderTest, SerializeVersionIs1) {
+TEST(FileHeaderTest, SerializeVersionIsCurrent) {
     const FileHeader hdr;
     const auto buf = hdr.serialize();
     ASSERT_GE(buf.size(), 6U);
@@ -183,5 +187,63 @@ TEST(FileHeaderTest, SerializedBlockCountAtOffset16) {
     EXPECT_EQ(value, 0xDEADBEEFCAFEBABEULL);
 }
 
+// ---------------------------------------------------------------------------
+// Versions and block stride
+// ---------------------------------------------------------------------------
+
+TEST(FileHeaderTest, DeserializeVersion1IsAccepted) {
+    FileHeader hdr;
+    hdr.version = FileHeader::kVersionV1;
+    hdr.blockCount = 3;
+    const auto buf = hdr.serialize();
+    const auto out = FileHeader::deserialize(buf.data(), buf.size());
+    EXPECT_EQ(out.version, FileHeader::kVersionV1);
+    EXPECT_EQ(out.blockCount, 3U);
+}
+
+TEST(FileHeaderTest, DeserializeUnknownVersionThrows) {
+    FileHeader hdr;
+    hdr.version = 3;
+    const auto buf = hdr.serialize(); // CRC is valid; only the version is wrong
+    EXPECT_THROW(FileHeader::deserialize(buf.data(), buf.size()), exceptions::DecompressHeaderInvalid);
+}
+
+TEST(FileHeaderTest, BlockStrideDependsOnVersion) {
+    FileHeader hdr;
+    EXPECT_EQ(hdr.blockStride(), BlockFrame::kFrameBytes + CompressedPayload::kBlockPayloadBytes);
+    hdr.version = FileHeader::kVersionV1;
+    EXPECT_EQ(hdr.blockStride(), CompressedPayload::kBlockPayloadBytes);
+}
+
+// ---------------------------------------------------------------------------
+// Streamed headers
+// ---------------------------------------------------------------------------
+
+TEST(FileHeaderTest, StreamedHeaderRoundTrips) {
+    FileHeader hdr;
+    hdr.originalFileSizeBytes = FileHeader::kStreamed;
+    hdr.blockCount = FileHeader::kStreamed;
+    const auto buf = hdr.serialize();
+    EXPECT_TRUE(FileHeader::deserialize(buf.data(), buf.size()).streamed());
+    EXPECT_FALSE(FileHeader{}.streamed());
+}
+
+TEST(FileHeaderTest, HalfStreamedHeaderThrows) {
+    FileHeader hdr;
+    hdr.originalFileSizeBytes = FileHeader::kStreamed;
+    hdr.blockCount = 4;
+    const auto buf = hdr.serialize();
+    EXPECT_THROW(FileHeader::deserialize(buf.data(), buf.size()), exceptions::DecompressHeaderInvalid);
+}
+
+TEST(FileHeaderTest, StreamedVersion1HeaderThrows) {
+    FileHeader hdr;
+    hdr.version = FileHeader::kVersionV1;
+    hdr.originalFileSizeBytes = FileHeader::kStreamed;
+    hdr.blockCount = FileHeader::kStreamed;
+    const auto buf = hdr.serialize();
+    EXPECT_THROW(FileHeader::deserialize(buf.data(), buf.size()), exceptions::DecompressHeaderInvalid);
+}
+
 } // namespace
 } // namespace crsce::common::format
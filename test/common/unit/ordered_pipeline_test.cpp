@@ -0,0 +1,125 @@
+/**
+ * @file ordered_pipeline_test.cpp
+ * @brief Unit tests for runOrderedPipeline.
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "common/Util/OrderedPipeline.h"
+
+namespace crsce::common::util {
+namespace {
+
+// ---------------------------------------------------------------------------
+// Ordering
+// ---------------------------------------------------------------------------
+
+TEST(OrderedPipelineTest, SerialPathConsumesInOrder) {
+    std::vector<std::uint64_t> seen;
+    runOrderedPipeline<std::uint64_t>(
+        5, 1, 2,
+        [](const std::uint64_t i) { return i * 10; },
+        [&](const std::uint64_t i, const std::uint64_t v) {
+            EXPECT_EQ(v, i * 10);
+            seen.push_back(i);
+        });
+    EXPECT_EQ(seen, (std::vector<std::uint64_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(OrderedPipelineTest, ParallelPathConsumesInOrderDespiteOutOfOrderCompletion) {
+    constexpr std::uint64_t kCount = 64;
+    std::vector<std::uint64_t> seen;
+    runOrderedPipeline<std::uint64_t>(
+        kCount, 4, 8,
+        [](const std::uint64_t i) {
+            // Early indices finish last so completion order differs from index order.
+            std::this_thread::sleep_for(std::chrono::microseconds((kCount - i) * 20));
+            return i * i;
+        },
+        [&](const std::uint64_t i, const std::uint64_t v) {
+            EXPECT_EQ(v, i * i);
+            seen.push_back(i);
+        });
+    ASSERT_EQ(seen.size(), kCount);
+    for (std::uint64_t i = 0; i < kCount; ++i) {
+        EXPECT_EQ(seen[i], i);
+    }
+}
+
+TEST(OrderedPipelineTest, ZeroCountNeverCallsCallbacks) {
+    bool called = false;
+    runOrderedPipeline<int>(
+        0, 4, 8,
+        [&](std::uint64_t) { called = true; return 0; },
+        [&](std::uint64_t, int) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+// ---------------------------------------------------------------------------
+// Bounded in-flight window
+// ---------------------------------------------------------------------------
+
+TEST(OrderedPipelineTest, InFlightNeverExceedsWindow) {
+    constexpr std::uint64_t kWindow = 6;
+    std::atomic<std::uint64_t> consumed{0};
+    std::atomic<std::uint64_t> maxAhead{0};
+    runOrderedPipeline<std::uint64_t>(
+        100, 4, kWindow,
+        [&](const std::uint64_t i) {
+            const auto ahead = i - consumed.load();
+            auto prev = maxAhead.load();
+            while (ahead > prev && !maxAhead.compare_exchange_weak(prev, ahead)) {}
+            return i;
+        },
+        [&](const std::uint64_t i, std::uint64_t) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            consumed.store(i + 1);
+        });
+    // A claim may run while the writer is still consuming the previous head item.
+    EXPECT_LE(maxAhead.load(), kWindow);
+}
+
+// ---------------------------------------------------------------------------
+// Error propagation
+// ---------------------------------------------------------------------------
+
+TEST(OrderedPipelineTest, FirstFailureInIndexOrderIsRethrown) {
+    std::vector<std::uint64_t> seen;
+    try {
+        runOrderedPipeline<std::uint64_t>(
+            32, 4, 8,
+            [](const std::uint64_t i) -> std::uint64_t {
+                if (i == 7 || i == 9) {
+                    throw std::runtime_error("fail " + std::to_string(i));
+                }
+                return i;
+            },
+            [&](const std::uint64_t i, std::uint64_t) { seen.push_back(i); });
+        FAIL() << "expected exception";
+    } catch (const std::runtime_error &e) {
+        EXPECT_STREQ(e.what(), "fail 7");
+    }
+    EXPECT_EQ(seen.size(), 7U);
+}
+
+TEST(OrderedPipelineTest, ConsumerFailureStopsWorkers) {
+    EXPECT_THROW(runOrderedPipeline<std::uint64_t>(
+                     1000, 4, 8,
+                     [](const std::uint64_t i) { return i; },
+                     [](const std::uint64_t i, std::uint64_t) {
+                         if (i == 3) {
+                             throw std::runtime_error("write failed");
+                         }
+                     }),
+                 std::runtime_error);
+}
+
+} // namespace
+} // namespace crsce::common::util
@@ -5,16 +5,27 @@
  */
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <ios>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
 #include <string>
 #include <vector>
 
 #include "compress/Compressor/Compressor.h"
 #include "decompress/Decompressor/Decompressor.h"
+#include "decompress/Decompressor/ResumeJournal.h"
+#include "common/exceptions/DecompressBlockCorrupt.h"
+#include "common/exceptions/DecompressOutputOpenError.h"
+#include "common/exceptions/DecompressRangeInvalid.h"
+#include "common/Format/CompressedPayload/BlockFrame.h"
+#include "common/Format/CompressedPayload/FileHeader.h"
 
 namespace {
     /**
@@ -45,6 +56,56 @@ namespace {
         return data;
     }
 
+    /**
+     * @brief ResumeJournal::extend digest of block 0 of a v2 container, as a -resume
+     *        checkpoint after that block records it.
+     */
+    auto firstBlockDigest(const std::vector<std::uint8_t> &container) -> std::uint32_t {
+        using crsce::common::format::BlockFrame;
+        const auto *frame = container.data() + crsce::common::format::FileHeader::kHeaderBytes; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto flags = BlockFrame::peekFlags(frame);
+        const auto *payload = frame + BlockFrame::kFrameBytes; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto len = BlockFrame::payloadBytes(flags) + BlockFrame::hintBytes(flags, payload);
+        return crsce::decompress::ResumeJournal::extend(0, flags, payload, len);
+    }
+
+    /**
+     * @brief Frame flags of every block in a v2 container, in order.
+     */
+    auto blockFlags(const std::vector<std::uint8_t> &container) -> std::vector<std::uint16_t> {
+        using crsce::common::format::BlockFrame;
+        std::vector<std::uint16_t> flags;
+        std::size_t offset = crsce::common::format::FileHeader::kHeaderBytes;
+        while (offset + BlockFrame::kFrameBytes <= container.size()) {
+            const auto *frame = container.data() + offset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            flags.push_back(BlockFrame::peekFlags(frame));
+            const auto *payload = frame + BlockFrame::kFrameBytes; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            offset += BlockFrame::kFrameBytes + BlockFrame::payloadBytes(flags.back()) +
+                      BlockFrame::hintBytes(flags.back(), payload);
+        }
+        return flags;
+    }
+
+    /**
+     * @brief Point std::cin / std::cout at other buffers for the guard's lifetime.
+     */
+    struct StdioRedirect {
+        StdioRedirect(std::streambuf *in, std::streambuf *out)
+            : oldIn(std::cin.rdbuf(in)), oldOut(out != nullptr ? std::cout.rdbuf(out) : nullptr) {}
+        ~StdioRedirect() {
+            std::cin.rdbuf(oldIn);
+            if (oldOut != nullptr) {
+                std::cout.rdbuf(oldOut);
+            }
+        }
+        StdioRedirect(const StdioRedirect &) = delete;
+        StdioRedirect &operator=(const StdioRedirect &) = delete;
+        StdioRedirect(StdioRedirect &&) = delete;
+        StdioRedirect &operator=(StdioRedirect &&) = delete;
+        std::streambuf *oldIn;
+        std::streambuf *oldOut;
+    };
+
     /**
      * @brief RAII guard that creates a temp directory and removes it on destruction.
      */
@@ -95,7 +156,7 @@ TEST(RoundTrip, SingleByteRoundTrip) { // NOLINT(cert-err58-cpp,cppcoreguideline
     // Verify compressed file exists and has expected size
     // Header: 28 bytes, 1 block payload: 16,899 bytes → total 16,927 bytes
     const auto compressedSize = std::filesystem::file_size(compressedPath);
-    EXPECT_EQ(compressedSize, 28U + 1369U) << "compressed file has unexpected size";
+    EXPECT_EQ(compressedSize, 28U + 16U + 1369U) << "compressed file has unexpected size";
 
     // Decompress
     crsce::decompress::Decompressor decompressor;
@@ -106,3 +167,468 @@ TEST(RoundTrip, SingleByteRoundTrip) { // NOLINT(cert-err58-cpp,cppcoreguideline
     ASSERT_EQ(result.size(), original.size()) << "decompressed size mismatch";
     EXPECT_EQ(result, original) << "decompressed content mismatch";
 }
+
+/**
+ * @brief Block-parallel compression must produce byte-identical output to the serial path.
+ *
+ * A 5,000-byte input spans three blocks (16,129 bits each), so the last two blocks start
+ * at non-byte-aligned offsets. DI discovery is disabled so only slicing, cross-sums, hashes,
+ * and the ordered writer are exercised.
+ */
+TEST(RoundTrip, ParallelCompressMatchesSerial) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "multi.bin").string();
+    const auto serialPath = (tmp.path() / "serial.crsce").string();
+    const auto parallelPath = (tmp.path() / "parallel.crsce").string();
+
+    std::vector<std::uint8_t> original(5000);
+    std::uint32_t x = 0x9E3779B9U;
+    for (auto &b : original) {
+        x ^= x << 13U;
+        x ^= x >> 17U;
+        x ^= x << 5U;
+        b = static_cast<std::uint8_t>(x);
+    }
+    writeFile(inputPath, original);
+
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor serial;
+    ASSERT_NO_THROW(serial.compress(inputPath, serialPath));
+    const crsce::compress::Compressor parallel(4);
+    ASSERT_NO_THROW(parallel.compress(inputPath, parallelPath));
+
+    const auto serialBytes = readFile(serialPath);
+    EXPECT_EQ(serialBytes.size(), 28U + (3U * (16U + 1369U)));
+    EXPECT_EQ(readFile(parallelPath), serialBytes) << "parallel output differs from serial output";
+}
+
+/**
+ * @brief Block-parallel decompression must reassemble blocks in order.
+ *
+ * A sparse 5,000-byte input (three blocks) keeps every block quickly solvable while
+ * giving each block distinct content, so an out-of-order reassembly would be detected.
+ */
+TEST(RoundTrip, ParallelDecompressReassemblesInOrder) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "sparse.bin").string();
+    const auto compressedPath = (tmp.path() / "sparse.crsce").string();
+    const auto outputPath = (tmp.path() / "sparse.out").string();
+
+    std::vector<std::uint8_t> original(5000, 0);
+    original[0] = 0x80;
+    original[2500] = 0x01;
+    original[4999] = 0xA5;
+    writeFile(inputPath, original);
+
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor(4);
+    ASSERT_NO_THROW(compressor.compress(inputPath, compressedPath));
+
+    crsce::decompress::Decompressor decompressor(4);
+    ASSERT_NO_THROW(decompressor.decompress(compressedPath, outputPath));
+
+    const auto result = readFile(outputPath);
+    ASSERT_EQ(result.size(), original.size()) << "decompressed size mismatch";
+    EXPECT_EQ(result, original) << "decompressed content mismatch";
+}
+
+/**
+ * @brief A byte range spanning a block boundary recovers exactly those bytes while solving only
+ *        the overlapping blocks; a start past the end is rejected.
+ */
+TEST(RoundTrip, RangeDecompressMatchesSlice) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "range.bin").string();
+    const auto compressedPath = (tmp.path() / "range.crsce").string();
+
+    std::vector<std::uint8_t> original(5000, 0);
+    original[2010] = 0x5A;
+    original[2016] = 0xC3;
+    original[2017] = 0x81;
+    original[4999] = 0xA5;
+    writeFile(inputPath, original);
+
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor;
+    ASSERT_NO_THROW(compressor.compress(inputPath, compressedPath));
+
+    crsce::decompress::Decompressor decompressor(2);
+
+    // Bytes 2000..2029 straddle the block 0 / block 1 boundary (bit 16,129 is inside byte 2016).
+    const auto midPath = (tmp.path() / "mid.out").string();
+    ASSERT_NO_THROW(decompressor.decompressRange(compressedPath, midPath, 2000, 30));
+    EXPECT_EQ(readFile(midPath), std::vector<std::uint8_t>(original.begin() + 2000, original.begin() + 2030));
+
+    // A range starting mid-file that runs past the end is clamped to the final byte.
+    const auto tailPath = (tmp.path() / "tail.out").string();
+    ASSERT_NO_THROW(decompressor.decompressRange(compressedPath, tailPath, 4990, 100));
+    EXPECT_EQ(readFile(tailPath), std::vector<std::uint8_t>(original.begin() + 4990, original.end()));
+
+    const auto badPath = (tmp.path() / "bad.out").string();
+    EXPECT_THROW(decompressor.decompressRange(compressedPath, badPath, 5001, 1),
+                 crsce::common::exceptions::DecompressRangeInvalid);
+    EXPECT_FALSE(std::filesystem::exists(badPath));
+}
+
+/**
+ * @brief A flipped payload byte in a v2 file is rejected by the frame CRC before any solving,
+ *        and no output file is left behind.
+ */
+TEST(RoundTrip, CorruptBlockRejectedBeforeSolve) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "corrupt.bin").string();
+    const auto compressedPath = (tmp.path() / "corrupt.crsce").string();
+    const auto outputPath = (tmp.path() / "corrupt.out").string();
+
+    writeFile(inputPath, std::vector<std::uint8_t>(5000, 0x11));
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor;
+    ASSERT_NO_THROW(compressor.compress(inputPath, compressedPath));
+
+    // Flip one byte inside block 2's payload.
+    auto bytes = readFile(compressedPath);
+    const crsce::common::format::FileHeader header;
+    bytes.at(crsce::common::format::FileHeader::kHeaderBytes + (2 * header.blockStride()) + 100) ^= 0x04U;
+    writeFile(compressedPath, bytes);
+
+    crsce::decompress::Decompressor decompressor;
+    EXPECT_THROW(decompressor.decompress(compressedPath, outputPath),
+                 crsce::common::exceptions::DecompressBlockCorrupt);
+    EXPECT_FALSE(std::filesystem::exists(outputPath));
+}
+
+/**
+ * @brief Version 1 (unframed) files remain readable.
+ */
+TEST(RoundTrip, Version1ContainerStillDecompresses) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "v1.bin").string();
+    const auto compressedPath = (tmp.path() / "v1.crsce").string();
+    const auto v1Path = (tmp.path() / "v1_raw.crsce").string();
+    const auto outputPath = (tmp.path() / "v1.out").string();
+
+    std::vector<std::uint8_t> original(5000, 0);
+    original[17] = 0x42;
+    original[4321] = 0x99;
+    writeFile(inputPath, original);
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor;
+    ASSERT_NO_THROW(compressor.compress(inputPath, compressedPath));
+
+    // Rewrite the v2 container as v1: version-1 header followed by the unframed payloads.
+    using crsce::common::format::BlockFrame;
+    using crsce::common::format::FileHeader;
+    const auto v2 = readFile(compressedPath);
+    auto header = FileHeader::deserialize(v2.data(), v2.size());
+    const auto stride = header.blockStride();
+    header.version = FileHeader::kVersionV1;
+    auto v1 = header.serialize();
+    for (std::uint64_t b = 0; b < header.blockCount; ++b) {
+        const auto at = v2.begin() + static_cast<std::ptrdiff_t>(FileHeader::kHeaderBytes + (b * stride));
+        v1.insert(v1.end(), at + BlockFrame::kFrameBytes, at + static_cast<std::ptrdiff_t>(stride));
+    }
+    writeFile(v1Path, v1);
+
+    crsce::decompress::Decompressor decompressor;
+    ASSERT_NO_THROW(decompressor.decompress(v1Path, outputPath));
+    EXPECT_EQ(readFile(outputPath), original);
+}
+
+/**
+ * @brief -resume continues an interrupted run: the output is truncated to the last checkpoint
+ *        (discarding a half-written block), the remaining blocks are solved, and the journal is
+ *        removed on success.
+ */
+TEST(RoundTrip, ResumeContinuesFromCheckpoint) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "resume.bin").string();
+    const auto compressedPath = (tmp.path() / "resume.crsce").string();
+    const auto outputPath = (tmp.path() / "resume.out").string();
+    const auto journalPath = crsce::decompress::ResumeJournal::pathFor(outputPath);
+
+    std::vector<std::uint8_t> original(5000, 0);
+    original[2015] = 0x3C;
+    original[2016] = 0xFF;
+    original[3000] = 0x77;
+    writeFile(inputPath, original);
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor;
+    ASSERT_NO_THROW(compressor.compress(inputPath, compressedPath));
+
+    // Existing output without a journal is refused rather than overwritten.
+    writeFile(outputPath, {0x01});
+    crsce::decompress::Decompressor resumer(2, true);
+    EXPECT_THROW(resumer.decompress(compressedPath, outputPath), crsce::common::exceptions::DecompressOutputOpenError);
+
+    // State of a run killed while writing block 1: block 0 (16,129 bits = 2,016 bytes + 1 carried
+    // bit) is checkpointed, followed by junk from the block that was in progress.
+    std::vector<std::uint8_t> partial(original.begin(), original.begin() + 2016);
+    partial.insert(partial.end(), 300, 0xEE);
+    writeFile(outputPath, partial);
+    {
+        const auto container = readFile(compressedPath);
+        crsce::decompress::ResumeJournal journal(journalPath);
+        journal.begin(crsce::decompress::ResumeJournal::identity(
+                          container.data(), crsce::common::format::FileHeader::kHeaderBytes, 0, original.size()),
+                      {1, 2016, 2016, 1, static_cast<std::uint8_t>(original[2016] & 0x80U),
+                       firstBlockDigest(container)});
+    }
+
+    ASSERT_NO_THROW(resumer.decompress(compressedPath, outputPath));
+    EXPECT_EQ(readFile(outputPath), original);
+    EXPECT_FALSE(std::filesystem::exists(journalPath));
+}
+
+/**
+ * @brief A journal left by a different archive of a same-size input has the same header and
+ *        range; its checkpoint's content digest must keep -resume from splicing the two.
+ */
+TEST(RoundTrip, ResumeRejectsJournalFromOtherArchive) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputA = (tmp.path() / "a.bin").string();
+    const auto inputB = (tmp.path() / "b.bin").string();
+    const auto compressedA = (tmp.path() / "a.crsce").string();
+    const auto compressedB = (tmp.path() / "b.crsce").string();
+    const auto outputPath = (tmp.path() / "ab.out").string();
+    const auto journalPath = crsce::decompress::ResumeJournal::pathFor(outputPath);
+
+    std::vector<std::uint8_t> originalA(5000, 0);
+    originalA[100] = 0x42;
+    originalA[3000] = 0x77;
+    std::vector<std::uint8_t> originalB(5000, 0);
+    originalB[200] = 0x99;
+    originalB[3000] = 0x11;
+    writeFile(inputA, originalA);
+    writeFile(inputB, originalB);
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor;
+    ASSERT_NO_THROW(compressor.compress(inputA, compressedA));
+    ASSERT_NO_THROW(compressor.compress(inputB, compressedB));
+
+    const auto containerA = readFile(compressedA);
+    const auto containerB = readFile(compressedB);
+    using crsce::common::format::FileHeader;
+    ASSERT_TRUE(std::equal(containerA.begin(), containerA.begin() + FileHeader::kHeaderBytes, containerB.begin()));
+
+    // A run on archive A was killed after block 0.
+    const std::vector<std::uint8_t> partial(originalA.begin(), originalA.begin() + 2016);
+    writeFile(outputPath, partial);
+    {
+        crsce::decompress::ResumeJournal journal(journalPath);
+        journal.begin(crsce::decompress::ResumeJournal::identity(containerA.data(), FileHeader::kHeaderBytes, 0,
+                                                                 originalA.size()),
+                      {1, 2016, 2016, 1, static_cast<std::uint8_t>(originalA[2016] & 0x80U),
+                       firstBlockDigest(containerA)});
+    }
+
+    // Resuming against B is refused and leaves A's partial output and journal alone.
+    crsce::decompress::Decompressor resumer(2, true);
+    EXPECT_THROW(resumer.decompress(compressedB, outputPath), crsce::common::exceptions::DecompressOutputOpenError);
+    EXPECT_EQ(readFile(outputPath), partial);
+    EXPECT_TRUE(std::filesystem::exists(journalPath));
+
+    ASSERT_NO_THROW(resumer.decompress(compressedA, outputPath));
+    EXPECT_EQ(readFile(outputPath), originalA);
+}
+
+/**
+ * @brief With DI discovery on, 7-bit text is laid out in a transform other than row-major,
+ *        and the decoder inverts that layout back to the original bytes.
+ *
+ * 900 bytes of '~' and '|' (0x7E / 0x7C) differ only in bit 1, so every other bit plane is
+ * constant. BitPlane turns those planes into saturated lines; row-major spreads them across
+ * every line and forces fewer cells, so the compressor picks a transform and still finds a DI.
+ */
+TEST(RoundTrip, TextPicksLayoutTransformAndRoundTrips) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    using crsce::common::format::BlockFrame;
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "text.txt").string();
+    const auto compressedPath = (tmp.path() / "text.crsce").string();
+    const auto outputPath = (tmp.path() / "text.out").string();
+
+    std::vector<std::uint8_t> original(900);
+    std::uint32_t x = 0x2545F491U;
+    for (auto &b : original) {
+        x ^= x << 13U;
+        x ^= x >> 17U;
+        x ^= x << 5U;
+        b = (x & 0x100U) != 0 ? '~' : '|';
+    }
+    writeFile(inputPath, original);
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "0", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor;
+    ASSERT_NO_THROW(compressor.compress(inputPath, compressedPath));
+
+    const auto flags = blockFlags(readFile(compressedPath));
+    ASSERT_EQ(flags.size(), 1U);
+    EXPECT_EQ(flags[0] & BlockFrame::kFlagStored, 0U) << "DI discovery gave up on the block";
+    EXPECT_NE(flags[0] & BlockFrame::kLayoutMask, 0U) << "block stayed row-major";
+
+    crsce::decompress::Decompressor decompressor;
+    ASSERT_NO_THROW(decompressor.decompress(compressedPath, outputPath));
+    EXPECT_EQ(readFile(outputPath), original);
+}
+
+/**
+ * @brief With DI discovery on, a short final block whose padded bytes equal a full block's
+ *        must keep its own payload and kFlagPadded, serially and with -threads > 1.
+ *
+ * Three blocks carry the same sparse bit pattern; the last holds 16,126 bits (6,048 bytes in
+ * all). From stdin every block is read into a 2,017-byte buffer, so the short block's
+ * zero-padded bytes equal those of the full blocks. The full blocks may share a payload; the
+ * short one may not, in either order of completion.
+ */
+TEST(RoundTrip, ShortFinalBlockIsNotDeduplicated) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    using crsce::common::format::BlockFrame;
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "short.bin").string();
+
+    constexpr std::size_t kBlockBits = 127U * 127U;
+    std::vector<std::uint8_t> original(6048, 0);
+    for (std::size_t b = 0; b < 3; ++b) {
+        for (const std::size_t bit : {0U, 777U, 5000U, 12345U}) {
+            const auto i = (b * kBlockBits) + bit;
+            original[i / 8] |= static_cast<std::uint8_t>(0x80U >> (i % 8));
+        }
+    }
+    writeFile(inputPath, original);
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "0", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+
+    for (const std::uint32_t threads : {1U, 4U}) {
+        const auto compressedPath = (tmp.path() / ("short" + std::to_string(threads) + ".crsce")).string();
+        const auto outputPath = (tmp.path() / ("short" + std::to_string(threads) + ".out")).string();
+        {
+            std::ifstream pipe(inputPath, std::ios::binary);
+            const StdioRedirect redirect(pipe.rdbuf(), nullptr);
+            std::cin.clear();
+            const crsce::compress::Compressor compressor(threads);
+            ASSERT_NO_THROW(compressor.compress("-", compressedPath));
+        }
+
+        const auto flags = blockFlags(readFile(compressedPath));
+        ASSERT_EQ(flags.size(), 3U);
+        EXPECT_EQ(flags[0] & BlockFrame::kFlagPadded, 0U) << "threads=" << threads;
+        EXPECT_EQ(flags[1] & BlockFrame::kFlagPadded, 0U) << "threads=" << threads;
+        EXPECT_NE(flags[2] & BlockFrame::kFlagPadded, 0U) << "threads=" << threads;
+
+        crsce::decompress::Decompressor decompressor(threads);
+        ASSERT_NO_THROW(decompressor.decompress(compressedPath, outputPath));
+        EXPECT_EQ(readFile(outputPath), original) << "threads=" << threads;
+    }
+}
+
+/**
+ * @brief "-in -" / "-out -": compressing from stdin writes a streamed container that decompresses
+ *        from a file or from stdin, including a range written to stdout.
+ */
+TEST(RoundTrip, StdinStdoutStreamedContainer) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "stdio.bin").string();
+    const auto compressedPath = (tmp.path() / "stdio.crsce").string();
+    const auto outputPath = (tmp.path() / "stdio.out").string();
+
+    std::vector<std::uint8_t> original(5000, 0);
+    original[1999] = 0x24;
+    original[2016] = 0x81;
+    original[4999] = 0x5A;
+    writeFile(inputPath, original);
+    setenv("MAX_COMPRESSION_TIME", "30", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+
+    {
+        std::ifstream pipe(inputPath, std::ios::binary);
+        const StdioRedirect redirect(pipe.rdbuf(), nullptr);
+        std::cin.clear();
+        const crsce::compress::Compressor compressor(2);
+        ASSERT_NO_THROW(compressor.compress("-", compressedPath));
+    }
+    const auto container = readFile(compressedPath);
+    const auto header = crsce::common::format::FileHeader::deserialize(container.data(), container.size());
+    EXPECT_TRUE(header.streamed());
+
+    // A streamed container on disk: sizes come from the file length and the final frame.
+    crsce::decompress::Decompressor decompressor(2);
+    ASSERT_NO_THROW(decompressor.decompress(compressedPath, outputPath));
+    EXPECT_EQ(readFile(outputPath), original);
+
+    // Piped in and out: a range straddling the block 0 / block 1 boundary.
+    {
+        std::ifstream pipe(compressedPath, std::ios::binary);
+        std::ostringstream sink;
+        const StdioRedirect redirect(pipe.rdbuf(), sink.rdbuf());
+        std::cin.clear();
+        ASSERT_NO_THROW(decompressor.decompressRange("-", "-", 1990, 40));
+        const auto got = sink.str();
+        EXPECT_EQ(std::vector<std::uint8_t>(got.begin(), got.end()),
+                  std::vector<std::uint8_t>(original.begin() + 1990, original.begin() + 2030));
+    }
+
+    // -resume needs files to journal against.
+    crsce::decompress::Decompressor resumer(1, true);
+    EXPECT_THROW(resumer.decompress("-", outputPath), crsce::common::exceptions::DecompressOutputOpenError);
+}
+
+/**
+ * @brief A block whose DI cannot be found in time is stored raw: the file still compresses,
+ *        round-trips, and a range past the stored block locates the later blocks.
+ */
+TEST(RoundTrip, HardBlockIsStoredAndRoundTrips) { // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+    const TempDir tmp;
+    const auto inputPath = (tmp.path() / "hard.bin").string();
+    const auto compressedPath = (tmp.path() / "hard.crsce").string();
+    const auto outputPath = (tmp.path() / "hard.out").string();
+
+    // Block 0 is dense pseudo-random data (no DI within a second); block 1 is nearly empty.
+    std::vector<std::uint8_t> original(4500, 0);
+    std::uint32_t x = 0x1234567U;
+    for (std::size_t i = 0; i < 2016; ++i) {
+        x = (x * 1103515245U) + 12345U;
+        original[i] = static_cast<std::uint8_t>(x >> 16U);
+    }
+    original[3000] = 0x42;
+    writeFile(inputPath, original);
+
+    setenv("MAX_COMPRESSION_TIME", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("CRSCE_DISABLE_GPU", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    setenv("DISABLE_COMPRESS_DI", "0", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+    const crsce::compress::Compressor compressor(2);
+    ASSERT_NO_THROW(compressor.compress(inputPath, compressedPath));
+
+    // Block 0 is stored: its frame carries kFlagStored and the file is longer than the fixed layout.
+    using crsce::common::format::BlockFrame;
+    const auto container = readFile(compressedPath);
+    const auto header = crsce::common::format::FileHeader::deserialize(container.data(), container.size());
+    ASSERT_EQ(header.blockCount, 3U);
+    const auto frame0 = BlockFrame::deserialize(
+        container.data() + crsce::common::format::FileHeader::kHeaderBytes, // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        BlockFrame::kFrameBytes + BlockFrame::kStoredPayloadBytes, 0);
+    EXPECT_TRUE(frame0.stored());
+    EXPECT_GT(container.size(), crsce::common::format::FileHeader::kHeaderBytes + (3 * header.blockStride()));
+
+    crsce::decompress::Decompressor decompressor(2);
+    ASSERT_NO_THROW(decompressor.decompress(compressedPath, outputPath));
+    EXPECT_EQ(readFile(outputPath), original);
+
+    const auto rangePath = (tmp.path() / "hard_range.out").string();
+    ASSERT_NO_THROW(decompressor.decompressRange(compressedPath, rangePath, 2990, 20));
+    EXPECT_EQ(readFile(rangePath), std::vector<std::uint8_t>(original.begin() + 2990, original.begin() + 3010));
+    setenv("DISABLE_COMPRESS_DI", "1", 1); // NOLINT(concurrency-mt-unsafe,misc-include-cleaner)
+}
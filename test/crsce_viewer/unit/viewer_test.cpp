@@ -14,6 +14,7 @@
 #include <system_error>
 #include <vector>
 
+#include "common/Format/CompressedPayload/BlockFrame.h"
 #include "common/Format/CompressedPayload/CompressedPayload.h"
 #include "common/Format/CompressedPayload/FileHeader.h"
 #include "crsce_viewer/viewer.h"
@@ -22,6 +23,7 @@ namespace crsce::viewer {
 namespace {
 
 namespace fs = std::filesystem;
+using common::format::BlockFrame;
 using common::format::CompressedPayload;
 using common::format::FileHeader;
 
@@ -54,9 +56,12 @@ private:
 
 /**
  * @brief Build a valid .crsce file with the given number of zero-filled blocks.
+ * @details Version 2 (the default) frames each payload; version 1 writes raw payloads.
  */
-std::vector<std::uint8_t> buildValidContainer(const std::uint64_t originalSize, const std::uint64_t blockCount) {
+std::vector<std::uint8_t> buildValidContainer(const std::uint64_t originalSize, const std::uint64_t blockCount,
+                                              const std::uint16_t version = FileHeader::kVersion) {
     FileHeader hdr;
+    hdr.version = version;
     hdr.originalFileSizeBytes = originalSize;
     hdr.blockCount = blockCount;
     auto headerBytes = hdr.serialize();
@@ -69,7 +74,12 @@ std::vector<std::uint8_t> buildValidContainer(const std::uint64_t originalSize,
         // Set a few recognizable sums
         payload.setLSM(0, 42);
         payload.setVSM(0, 99);
-        const auto blockBytes = payload.serializeBlock();
+        auto blockBytes = payload.serializeBlock();
+        if (version != FileHeader::kVersionV1) {
+            BlockFrame frame;
+            frame.blockId = b;
+            blockBytes = frame.serialize(blockBytes);
+        }
         result.insert(result.end(), blockBytes.begin(), blockBytes.end());
     }
     return result;
@@ -218,5 +228,60 @@ TEST(ViewerTest, LHOutputContainsHexDigests) {
     EXPECT_TRUE(output.find("[126]") != std::string::npos);
 }
 
+TEST(ViewerTest, Version1ContainerIsStillReadable) {
+    constexpr std::uint64_t kOneBlockBytes = (127ULL * 127ULL + 7ULL) / 8ULL;
+    const auto data = buildValidContainer(kOneBlockBytes, 1, FileHeader::kVersionV1);
+    const TempFile tmp;
+    tmp.writeBytes(data);
+
+    std::ostringstream out;
+    std::ostringstream err;
+    const int rc = run_viewer(tmp.str(), out, err);
+    EXPECT_EQ(rc, 0);
+    EXPECT_TRUE(out.str().find("version:            1") != std::string::npos);
+    EXPECT_TRUE(out.str().find("=== Block 0 ===") != std::string::npos);
+}
+
+TEST(ViewerTest, CorruptBlockFrameReturnsError) {
+    constexpr std::uint64_t kOneBlockBytes = (127ULL * 127ULL + 7ULL) / 8ULL;
+    auto data = buildValidContainer(kOneBlockBytes, 1);
+    data.back() ^= 0x01U; // flip a payload bit covered by the frame CRC
+    const TempFile tmp;
+    tmp.writeBytes(data);
+
+    std::ostringstream out;
+    std::ostringstream err;
+    const int rc = run_viewer(tmp.str(), out, err);
+    EXPECT_EQ(rc, 1);
+    EXPECT_TRUE(err.str().find("CRC-32 mismatch") != std::string::npos);
+}
+
+TEST(ViewerTest, StreamedContainerStopsAtFinalBlock) {
+    // Two framed blocks under a streamed header; the second closes the stream with 16 data bits.
+    FileHeader hdr;
+    hdr.originalFileSizeBytes = FileHeader::kStreamed;
+    hdr.blockCount = FileHeader::kStreamed;
+    auto data = hdr.serialize();
+    for (std::uint64_t b = 0; b < 2; ++b) {
+        BlockFrame frame;
+        frame.blockId = b;
+        if (b == 1) {
+            frame.flags = BlockFrame::kFlagFinal;
+            frame.finalBits = 16;
+        }
+        const auto blockBytes = frame.serialize(CompressedPayload{}.serializeBlock());
+        data.insert(data.end(), blockBytes.begin(), blockBytes.end());
+    }
+    const TempFile tmp;
+    tmp.writeBytes(data);
+
+    std::ostringstream out;
+    std::ostringstream err;
+    const int rc = run_viewer(tmp.str(), out, err);
+    EXPECT_EQ(rc, 0) << err.str();
+    EXPECT_TRUE(out.str().find("block_count:        streamed") != std::string::npos);
+    EXPECT_TRUE(out.str().find("=== Final block 1: 16 data bits ===") != std::string::npos);
+}
+
 } // namespace
 } // namespace crsce::viewer
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -332,3 +333,182 @@ TEST(ConstraintStoreTest, GetAssignedCountTracksOnes) {
     store.assign(0, 2, 1);
     EXPECT_EQ(store.getAssignedCount(rowLine), 2);
 }
+
+/**
+ * @brief unassign returns a cell to Unassigned in both planes and restores the line counts.
+ */
+TEST(ConstraintStoreTest, UnassignRestoresStateAndCounts) {
+    auto store = makeAllZeroStore();
+    const LineID rowLine{.type = LineType::Row, .index = 5};
+
+    store.assign(5, 100, 1);
+    store.assign(5, 3, 0);
+    store.unassign(5, 100);
+    store.unassign(5, 3);
+
+    EXPECT_EQ(store.getCellState(5, 100), CellState::Unassigned);
+    EXPECT_EQ(store.getCellState(5, 3), CellState::Unassigned);
+    EXPECT_EQ(store.getCellValue(5, 100), 0);
+    EXPECT_EQ(store.getAssignedCount(rowLine), 0);
+    EXPECT_EQ(store.getUnknownCount(rowLine), kS);
+    EXPECT_EQ(store.getRow(5)[1], 0U);
+}
+
+/**
+ * @brief forEachUnassignedInRow visits exactly the unassigned columns, in order, across both words.
+ */
+TEST(ConstraintStoreTest, ForEachUnassignedInRowSkipsAssignedCells) {
+    auto store = makeAllZeroStore();
+    for (std::uint16_t c = 0; c < kS; ++c) {
+        if (c != 0 && c != 63 && c != 64 && c != kS - 1) {
+            store.assign(9, c, static_cast<std::uint8_t>(c % 2));
+        }
+    }
+
+    std::vector<std::uint16_t> seen;
+    store.forEachUnassignedInRow(9, [&](const std::uint16_t c) { seen.push_back(c); });
+    EXPECT_EQ(seen, (std::vector<std::uint16_t>{0, 63, 64, kS - 1}));
+}
+
+/**
+ * @brief Cells the callback assigns in the same row are not visited afterwards.
+ */
+TEST(ConstraintStoreTest, ForEachUnassignedInRowSeesAssignmentsMadeByCallback) {
+    auto store = makeAllZeroStore();
+    std::vector<std::uint16_t> seen;
+    store.forEachUnassignedInRow(0, [&](const std::uint16_t c) {
+        seen.push_back(c);
+        store.assign(0, c, 0);
+        if (c + 1 < kS) {
+            store.assign(0, static_cast<std::uint16_t>(c + 1), 0); // skip the next column
+        }
+    });
+    ASSERT_EQ(seen.size(), (kS + 1U) / 2U);
+    for (std::size_t i = 0; i < seen.size(); ++i) {
+        EXPECT_EQ(seen[i], 2 * i);
+    }
+}
+
+/**
+ * @brief rollback(mark) unassigns everything assigned after the mark and restores the line stats.
+ */
+TEST(ConstraintStoreTest, RollbackRestoresStateAtMark) {
+    auto store = makeAllZeroStore();
+    const LineID rowLine{.type = LineType::Row, .index = 2};
+    const LineID colLine{.type = LineType::Column, .index = 7};
+    store.assign(2, 0, 0); // before any mark: kept
+
+    const auto outer = store.mark();
+    store.assign(2, 7, 1);
+    const auto inner = store.mark();
+    store.assign(3, 7, 0);
+    store.assign(2, 100, 1);
+
+    store.rollback(inner);
+    EXPECT_EQ(store.getCellState(3, 7), CellState::Unassigned);
+    EXPECT_EQ(store.getCellState(2, 100), CellState::Unassigned);
+    EXPECT_EQ(store.getCellState(2, 7), CellState::One);
+    EXPECT_EQ(store.getAssignedCount(rowLine), 1);
+
+    store.rollback(outer);
+    EXPECT_EQ(store.getCellState(2, 7), CellState::Unassigned);
+    EXPECT_EQ(store.getCellState(2, 0), CellState::Zero);
+    EXPECT_EQ(store.getAssignedCount(rowLine), 0);
+    EXPECT_EQ(store.getUnknownCount(rowLine), kS - 1);
+    EXPECT_EQ(store.getUnknownCount(colLine), kS);
+    EXPECT_EQ(store.getRow(2)[0], 0U);
+}
+
+/**
+ * @brief A trailed cell that was unassigned directly is not unassigned a second time.
+ */
+TEST(ConstraintStoreTest, RollbackSkipsCellsAlreadyUnassigned) {
+    auto store = makeAllZeroStore();
+    const LineID rowLine{.type = LineType::Row, .index = 4};
+    const auto m = store.mark();
+    store.assign(4, 10, 1);
+    store.assign(4, 11, 0);
+    store.unassign(4, 10);
+    store.rollback(m);
+    EXPECT_EQ(store.getCellState(4, 11), CellState::Unassigned);
+    EXPECT_EQ(store.getUnknownCount(rowLine), kS);
+    EXPECT_EQ(store.getAssignedCount(rowLine), 0);
+}
+
+/**
+ * @brief Rolling back to the trail's start stops trailing: later assigns survive a fresh mark's rollback.
+ */
+TEST(ConstraintStoreTest, RollbackToStartStopsTrailing) {
+    auto store = makeAllZeroStore();
+    store.rollback(store.mark());
+    store.assign(0, 0, 1); // not trailed
+    const auto m = store.mark();
+    EXPECT_EQ(m, 0U);
+    store.assign(0, 1, 0);
+    store.rollback(m);
+    EXPECT_EQ(store.getCellState(0, 0), CellState::One);
+    EXPECT_EQ(store.getCellState(0, 1), CellState::Unassigned);
+}
+
+/**
+ * @brief Two marks at the trail's start: rolling back the inner one keeps the outer one trailing.
+ */
+TEST(ConstraintStoreTest, InnerRollbackAtStartKeepsOuterMarkTrailing) {
+    auto store = makeAllZeroStore();
+    const auto outer = store.mark();
+    const auto inner = store.mark();
+    EXPECT_EQ(inner, outer);
+    store.rollback(inner);
+    store.assign(5, 5, 1);
+    store.rollback(outer);
+    EXPECT_EQ(store.getCellState(5, 5), CellState::Unassigned);
+}
+
+/**
+ * @brief commit keeps an inner mark's assigns on the trail for the outer mark, and the outermost commit stops trailing.
+ */
+TEST(ConstraintStoreTest, CommitKeepsAssignsAndClosesMark) {
+    auto store = makeAllZeroStore();
+    const auto outer = store.mark();
+    static_cast<void>(store.mark());
+    store.assign(6, 1, 1);
+    store.commit();
+    EXPECT_EQ(store.getCellState(6, 1), CellState::One);
+    store.rollback(outer);
+    EXPECT_EQ(store.getCellState(6, 1), CellState::Unassigned);
+
+    static_cast<void>(store.mark());
+    store.assign(6, 2, 1);
+    store.commit();
+    store.assign(6, 3, 0); // not trailed
+    const auto m = store.mark();
+    EXPECT_EQ(m, 0U);
+    store.rollback(m);
+    EXPECT_EQ(store.getCellState(6, 2), CellState::One);
+    EXPECT_EQ(store.getCellState(6, 3), CellState::Zero);
+}
+
+/**
+ * @brief assign raises a row's event only once the row can force, and only once until drained.
+ */
+TEST(ConstraintStoreTest, AssignRaisesLineEventWhenLineCanForce) {
+    auto store = makeUniformStore(2, 2);
+    const auto row0 = ConstraintStore::lineIndex(LineID{.type = LineType::Row, .index = 0});
+    const auto drainCount = [&](const std::uint32_t idx) {
+        std::size_t n = 0;
+        store.drainLineEvents([&](const std::uint16_t got) { n += got == idx ? 1U : 0U; });
+        return n;
+    };
+
+    store.assign(0, 0, 1); // row 0: rho = 1, u = 126
+    EXPECT_EQ(drainCount(row0), 0U);
+
+    store.assign(0, 1, 1); // row 0: rho = 0, u = 125 -> the rest must be 0
+    store.assign(0, 2, 0); // still forcing: no second event while pending
+    EXPECT_EQ(drainCount(row0), 1U);
+    EXPECT_EQ(drainCount(row0), 0U); // drained
+
+    store.assign(0, 3, 1); // row 0: rho = -1 -> conflict
+    store.clearLineEvents();
+    EXPECT_EQ(drainCount(row0), 0U);
+}
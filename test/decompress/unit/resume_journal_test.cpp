@@ -0,0 +1,153 @@
+/**
+ * @file resume_journal_test.cpp
+ * @brief Unit tests for ResumeJournal (sidecar checkpoints for -resume).
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <vector>
+
+#include "common/exceptions/DecompressOutputOpenError.h"
+#include "common/exceptions/DecompressOutputWriteError.h"
+#include "decompress/Decompressor/ResumeJournal.h"
+
+namespace crsce::decompress {
+namespace {
+
+/**
+ * @brief Journal path under the temp directory, removed on destruction.
+ */
+class TempJournal {
+public:
+    explicit TempJournal(const std::string &name)
+        : path_((std::filesystem::temp_directory_path() / name).string()) { std::filesystem::remove(path_); }
+    ~TempJournal() { std::error_code ec; std::filesystem::remove(path_, ec); }
+    TempJournal(const TempJournal &) = delete;
+    TempJournal &operator=(const TempJournal &) = delete;
+    TempJournal(TempJournal &&) = delete;
+    TempJournal &operator=(TempJournal &&) = delete;
+    [[nodiscard]] const std::string &path() const { return path_; }
+
+private:
+    std::string path_;
+};
+
+TEST(ResumeJournalTest, PathForAppendsSuffix) {
+    EXPECT_EQ(ResumeJournal::pathFor("out.bin"), "out.bin.journal");
+}
+
+TEST(ResumeJournalTest, IdentityCoversHeaderAndRange) {
+    const std::array<std::uint8_t, 3> hdr{0x00, 0xAB, 0x10};
+    EXPECT_EQ(ResumeJournal::identity(hdr.data(), hdr.size(), 5, 9), "00ab10 5:9");
+    EXPECT_NE(ResumeJournal::identity(hdr.data(), hdr.size(), 0, 9), ResumeJournal::identity(hdr.data(), hdr.size(), 5, 9));
+}
+
+TEST(ResumeJournalTest, MissingJournalLoadsNothing) {
+    const TempJournal tmp("crsce_resume_missing.journal");
+    const ResumeJournal journal(tmp.path());
+    EXPECT_FALSE(journal.load("id").has_value());
+}
+
+TEST(ResumeJournalTest, LastCheckpointWins) {
+    const TempJournal tmp("crsce_resume_last.journal");
+    {
+        ResumeJournal journal(tmp.path());
+        journal.begin("id", {});
+        journal.record({1, 2016, 2016, 1, 0x80});
+        journal.record({2, 4032, 4032, 2, 0xC0, 0xDEADBEEF});
+    }
+    const ResumeJournal journal(tmp.path());
+    const auto cp = journal.load("id");
+    ASSERT_TRUE(cp.has_value());
+    EXPECT_EQ(cp->nextBlock, 2U);
+    EXPECT_EQ(cp->outputBytes, 4032U);
+    EXPECT_EQ(cp->tailBase, 4032U);
+    EXPECT_EQ(cp->tailBits, 2U);
+    EXPECT_EQ(cp->tailByte, 0xC0U);
+    EXPECT_EQ(cp->digest, 0xDEADBEEFU);
+}
+
+TEST(ResumeJournalTest, DigestDependsOnBlockContentAndOrder) {
+    const std::vector<std::uint8_t> a{1, 2, 3};
+    const std::vector<std::uint8_t> b{1, 2, 4};
+    const auto da = ResumeJournal::extend(0, 0, a.data(), a.size());
+    EXPECT_NE(da, ResumeJournal::extend(0, 0, b.data(), b.size()));
+    EXPECT_NE(da, ResumeJournal::extend(0, 2, a.data(), a.size()));
+    EXPECT_NE(ResumeJournal::extend(da, 0, b.data(), b.size()),
+              ResumeJournal::extend(ResumeJournal::extend(0, 0, b.data(), b.size()), 0, a.data(), a.size()));
+}
+
+TEST(ResumeJournalTest, TornFinalLineIsIgnored) {
+    const TempJournal tmp("crsce_resume_torn.journal");
+    {
+        ResumeJournal journal(tmp.path());
+        journal.begin("id", {});
+        journal.record({1, 2016, 2016, 1, 0x80});
+    }
+    {
+        std::ofstream app(tmp.path(), std::ios::app);
+        app << "cp 2 40"; // killed mid-append: no newline
+    }
+    const ResumeJournal journal(tmp.path());
+    const auto cp = journal.load("id");
+    ASSERT_TRUE(cp.has_value());
+    EXPECT_EQ(cp->nextBlock, 1U);
+}
+
+TEST(ResumeJournalTest, IdentityMismatchThrows) {
+    const TempJournal tmp("crsce_resume_mismatch.journal");
+    {
+        ResumeJournal journal(tmp.path());
+        journal.begin("id-a", {});
+    }
+    const ResumeJournal journal(tmp.path());
+    EXPECT_THROW(static_cast<void>(journal.load("id-b")), common::exceptions::DecompressOutputOpenError);
+}
+
+TEST(ResumeJournalTest, BeginReplacesJournalViaTempFile) {
+    const TempJournal tmp("crsce_resume_replace.journal");
+    {
+        ResumeJournal journal(tmp.path());
+        journal.begin("id", {});
+        journal.record({1, 2016, 2016, 1, 0x80});
+        journal.record({2, 4032, 4032, 2, 0xC0});
+    }
+    {
+        // A resumed run compacts the journal to its starting checkpoint and keeps appending.
+        ResumeJournal journal(tmp.path());
+        journal.begin("id", {2, 4032, 4032, 2, 0xC0});
+        journal.record({3, 6048, 6048, 3, 0xE0});
+    }
+    EXPECT_FALSE(std::filesystem::exists(tmp.path() + ".tmp"));
+    std::ifstream in(tmp.path());
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(in, line);) {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 3U);
+    EXPECT_EQ(lines[1], "cp 2 4032 4032 2 192 0");
+    EXPECT_EQ(lines[2], "cp 3 6048 6048 3 224 0");
+}
+
+TEST(ResumeJournalTest, SyncFileRejectsMissingPath) {
+    EXPECT_THROW(ResumeJournal::syncFile((std::filesystem::temp_directory_path() / "crsce_no_such_file").string()),
+                 common::exceptions::DecompressOutputWriteError);
+}
+
+TEST(ResumeJournalTest, RemoveDeletesFile) {
+    const TempJournal tmp("crsce_resume_remove.journal");
+    ResumeJournal journal(tmp.path());
+    journal.begin("id", {});
+    ASSERT_TRUE(std::filesystem::exists(tmp.path()));
+    journal.remove();
+    EXPECT_FALSE(std::filesystem::exists(tmp.path()));
+}
+
+} // namespace
+} // namespace crsce::decompress
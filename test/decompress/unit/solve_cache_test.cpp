@@ -0,0 +1,204 @@
+/**
+ * @file solve_cache_test.cpp
+ * @brief Unit tests for SolveCache (on-disk solved-block cache, CRSCE_SOLVE_CACHE).
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "common/BlockHash/BlockHash.h"
+#include "common/Csm/Csm.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+#include "decompress/Decompressor/SolveCache.h"
+
+namespace crsce::decompress {
+namespace {
+
+/**
+ * @brief Cache directory under the temp directory, removed on construction and destruction.
+ */
+class TempDir {
+public:
+    explicit TempDir(const std::string &name)
+        : path_((std::filesystem::temp_directory_path() / name).string()) { std::filesystem::remove_all(path_); }
+    ~TempDir() { std::error_code ec; std::filesystem::remove_all(path_, ec); }
+    TempDir(const TempDir &) = delete;
+    TempDir &operator=(const TempDir &) = delete;
+    TempDir(TempDir &&) = delete;
+    TempDir &operator=(TempDir &&) = delete;
+    [[nodiscard]] const std::string &path() const { return path_; }
+
+private:
+    std::string path_;
+};
+
+/**
+ * @brief A block with a few bits set, varied by seed.
+ */
+common::Csm blockFor(const std::uint16_t seed) {
+    common::Csm csm;
+    for (std::uint16_t r = 0; r < common::Csm::kS; r += 5) {
+        csm.set(r, static_cast<std::uint16_t>((r + seed) % common::Csm::kS), 1);
+    }
+    return csm;
+}
+
+/**
+ * @brief Serialized payload carrying only csm's block hash (all load() checks).
+ */
+std::vector<std::uint8_t> payloadFor(const common::Csm &csm) {
+    common::format::CompressedPayload payload;
+    payload.setBH(common::BlockHash::compute(csm));
+    return payload.serializeBlock();
+}
+
+/**
+ * @brief Cache key for a block (any distinct 32 bytes will do here).
+ */
+SolveCache::Key keyFor(const std::uint8_t seed) {
+    SolveCache::Key key{};
+    key.fill(seed);
+    return key;
+}
+
+/**
+ * @brief Entry file for keyFor(seed): <dir>/<64 hex digits>.blk.
+ */
+std::filesystem::path entryPath(const std::string &dir, const std::uint8_t seed) {
+    static constexpr char kHex[] = "0123456789abcdef"; // NOLINT(*-avoid-c-arrays)
+    std::string name;
+    for (std::size_t i = 0; i < SolveCache::Key{}.size(); ++i) {
+        name.push_back(kHex[seed >> 4U]);   // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        name.push_back(kHex[seed & 0x0FU]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+    return std::filesystem::path(dir) / (name + ".blk");
+}
+
+TEST(SolveCacheTest, EmptyDirectoryDisables) {
+    SolveCache cache("", SolveCache::kDefaultMaxEntries);
+    EXPECT_FALSE(cache.enabled());
+    const auto bytes = payloadFor(blockFor(1));
+    cache.store(keyFor(1), blockFor(1));
+    EXPECT_FALSE(cache.load(keyFor(1), common::format::CompressedPayloadView(bytes.data(), bytes.size())).has_value());
+}
+
+TEST(SolveCacheTest, StoredBlockLoadsBack) {
+    const TempDir dir("crsce_solve_cache_roundtrip");
+    SolveCache cache(dir.path(), SolveCache::kDefaultMaxEntries);
+    ASSERT_TRUE(cache.enabled());
+    const auto csm = blockFor(7);
+    const auto bytes = payloadFor(csm);
+    const common::format::CompressedPayloadView view(bytes.data(), bytes.size());
+
+    EXPECT_FALSE(cache.load(keyFor(7), view).has_value());
+    cache.store(keyFor(7), csm);
+    const auto got = cache.load(keyFor(7), view);
+    ASSERT_TRUE(got.has_value());
+    for (std::uint16_t r = 0; r < common::Csm::kS; ++r) {
+        EXPECT_EQ(got->getRow(r), csm.getRow(r)) << "row " << r;
+    }
+    EXPECT_EQ(cache.hits(), 1U);
+    EXPECT_EQ(cache.misses(), 1U);
+    EXPECT_EQ(cache.writes(), 1U);
+}
+
+TEST(SolveCacheTest, BlockHashMismatchIsRejectedAndRemoved) {
+    const TempDir dir("crsce_solve_cache_mismatch");
+    SolveCache cache(dir.path(), SolveCache::kDefaultMaxEntries);
+    cache.store(keyFor(3), blockFor(3));
+    const auto other = payloadFor(blockFor(4));
+    EXPECT_FALSE(cache.load(keyFor(3), common::format::CompressedPayloadView(other.data(), other.size())).has_value());
+    EXPECT_FALSE(std::filesystem::exists(entryPath(dir.path(), 3)));
+}
+
+TEST(SolveCacheTest, TruncatedEntryIsRejected) {
+    const TempDir dir("crsce_solve_cache_truncated");
+    SolveCache cache(dir.path(), SolveCache::kDefaultMaxEntries);
+    cache.store(keyFor(5), blockFor(5));
+    std::filesystem::resize_file(entryPath(dir.path(), 5), 100);
+    const auto bytes = payloadFor(blockFor(5));
+    EXPECT_FALSE(cache.load(keyFor(5), common::format::CompressedPayloadView(bytes.data(), bytes.size())).has_value());
+    EXPECT_FALSE(std::filesystem::exists(entryPath(dir.path(), 5)));
+}
+
+TEST(SolveCacheTest, TrimEvictsLeastRecentlyUsed) {
+    const TempDir dir("crsce_solve_cache_trim");
+    // Another process filled the shared directory; this one keeps at most 2 entries.
+    SolveCache writer(dir.path(), SolveCache::kDefaultMaxEntries);
+    SolveCache cache(dir.path(), 2);
+    // Set recency explicitly (filesystem timestamps may be coarse): entry 1 is the oldest.
+    const auto now = std::filesystem::file_time_type::clock::now();
+    const std::vector<int> ageHours{1, 3, 2};
+    for (std::uint8_t k = 0; k < 3; ++k) {
+        writer.store(keyFor(k), blockFor(k));
+        std::filesystem::last_write_time(entryPath(dir.path(), k), now - std::chrono::hours(ageHours.at(k)));
+    }
+
+    EXPECT_EQ(cache.trim(), 1U);
+    EXPECT_FALSE(std::filesystem::exists(entryPath(dir.path(), 1)));
+    EXPECT_TRUE(std::filesystem::exists(entryPath(dir.path(), 0)));
+    EXPECT_TRUE(std::filesystem::exists(entryPath(dir.path(), 2)));
+    EXPECT_EQ(cache.trim(), 0U);
+    EXPECT_EQ(cache.evicted(), 1U);
+}
+
+TEST(SolveCacheTest, StoreTrimsDuringRun) {
+    const TempDir dir("crsce_solve_cache_store_trim");
+    SolveCache cache(dir.path(), 2);
+    for (std::uint8_t k = 0; k < 10; ++k) {
+        cache.store(keyFor(k), blockFor(k));
+    }
+    std::size_t entries = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(dir.path())) {
+        entries += entry.path().extension() == ".blk" ? 1U : 0U;
+    }
+    EXPECT_EQ(entries, 2U);
+    EXPECT_EQ(cache.writes(), 10U);
+    EXPECT_EQ(cache.evicted(), 8U);
+}
+
+TEST(SolveCacheTest, TrimRemovesOrphanedTempFilesAfterGrace) {
+    const TempDir dir("crsce_solve_cache_orphans");
+    SolveCache cache(dir.path(), SolveCache::kDefaultMaxEntries);
+    const auto now = std::filesystem::file_time_type::clock::now();
+    const auto orphan = entryPath(dir.path(), 0).string() + ".tmp.4242.0";
+    const auto inFlight = entryPath(dir.path(), 1).string() + ".tmp.4242.1";
+    for (const auto &tmp : {orphan, inFlight}) {
+        std::ofstream(tmp) << "partial";
+    }
+    std::filesystem::last_write_time(orphan, now - SolveCache::kTmpGrace - std::chrono::minutes(1));
+
+    EXPECT_EQ(cache.trim(), 0U);
+    EXPECT_FALSE(std::filesystem::exists(orphan));
+    EXPECT_TRUE(std::filesystem::exists(inFlight));
+}
+
+TEST(SolveCacheTest, LoadRefreshesRecency) {
+    const TempDir dir("crsce_solve_cache_recency");
+    SolveCache writer(dir.path(), SolveCache::kDefaultMaxEntries);
+    SolveCache cache(dir.path(), 1);
+    const auto old = std::filesystem::file_time_type::clock::now() - std::chrono::hours(5);
+    writer.store(keyFor(0), blockFor(0));
+    writer.store(keyFor(1), blockFor(1));
+    std::filesystem::last_write_time(entryPath(dir.path(), 0), old);
+    std::filesystem::last_write_time(entryPath(dir.path(), 1), old + std::chrono::hours(1));
+
+    // Using entry 0 makes it the most recent, so trim() drops entry 1 instead.
+    const auto bytes = payloadFor(blockFor(0));
+    ASSERT_TRUE(cache.load(keyFor(0), common::format::CompressedPayloadView(bytes.data(), bytes.size())).has_value());
+    EXPECT_EQ(cache.trim(), 1U);
+    EXPECT_TRUE(std::filesystem::exists(entryPath(dir.path(), 0)));
+    EXPECT_FALSE(std::filesystem::exists(entryPath(dir.path(), 1)));
+}
+
+} // namespace
+} // namespace crsce::decompress
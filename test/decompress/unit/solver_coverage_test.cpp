@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -18,7 +19,10 @@
 #include "decompress/Solvers/CellState.h"
 #include "decompress/Solvers/ConstraintStore.h"
 #include "decompress/Solvers/EnumerationController.h"
+#include "decompress/Solvers/IHashVerifier.h"
+#include "decompress/Solvers/LexRank.h"
 #include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/ParallelLexSelector.h"
 #include "decompress/Solvers/LtpTable.h"
 #include "decompress/Solvers/PropagationEngine.h"
 #include "decompress/Solvers/Sha256HashVerifier.h"
@@ -27,8 +31,11 @@ using crsce::decompress::solvers::BranchingController;
 using crsce::decompress::solvers::CellState;
 using crsce::decompress::solvers::ConstraintStore;
 using crsce::decompress::solvers::EnumerationController;
+using crsce::decompress::solvers::IHashVerifier;
+using crsce::decompress::solvers::LexRank;
 using crsce::decompress::solvers::LineID;
 using crsce::decompress::solvers::LineType;
+using crsce::decompress::solvers::ParallelLexSelector;
 using crsce::decompress::solvers::PropagationEngine;
 using crsce::decompress::solvers::Sha256HashVerifier;
 using crsce::decompress::solvers::kLtp1Base;
@@ -75,6 +82,75 @@ namespace {
                 std::vector<std::uint16_t>{}, std::vector<std::uint16_t>{},
                 std::vector<std::uint16_t>{}, std::vector<std::uint16_t>{}};
     }
+
+    /**
+     * @brief Hash verifier that accepts every row, so cross-sum ambiguity alone decides the solution set.
+     */
+    class AcceptAllHashVerifier final : public IHashVerifier {
+    public:
+        AcceptAllHashVerifier() = default;
+        [[nodiscard]] auto computeHash(const std::array<std::uint64_t, 2> & /*row*/) const
+            -> std::array<std::uint8_t, 32> override {
+            return {};
+        }
+        [[nodiscard]] bool verifyRow(std::uint16_t /*r*/, const std::array<std::uint64_t, 2> & /*row*/) const override {
+            return true;
+        }
+        void setExpected(std::uint16_t /*r*/, const std::array<std::uint8_t, 32> & /*digest*/) override {}
+    };
+
+    /**
+     * @brief Build an EnumerationController whose cross-sums (all six families) are those of target.
+     * @param target The matrix whose sums define the constraint system.
+     * @return Controller over target's sums with an accept-all hash verifier.
+     */
+    std::unique_ptr<EnumerationController> makeControllerFor(const crsce::common::Csm &target) {
+        // Read every line's sum back from a scratch store with target's ones assigned.
+        auto scratch = makeAllZeroStore();
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            for (std::uint16_t c = 0; c < kS; ++c) {
+                if (target.get(r, c) != 0) {
+                    scratch.assign(r, c, 1);
+                }
+            }
+        }
+        const auto sums = [&scratch](const std::uint32_t base, const std::uint16_t count) {
+            std::vector<std::uint16_t> out(count);
+            for (std::uint16_t k = 0; k < count; ++k) {
+                out[k] = scratch.getStatDirect(base + k).assigned;
+            }
+            return out;
+        };
+        auto store = std::make_unique<ConstraintStore>(
+            sums(0, kS), sums(kS, kS), sums(2U * kS, kNumDiags), sums((2U * kS) + kNumDiags, kNumDiags),
+            sums(kLtp1Base, kS), sums(kLtp2Base, kS),
+            std::vector<std::uint16_t>{}, std::vector<std::uint16_t>{},
+            std::vector<std::uint16_t>{}, std::vector<std::uint16_t>{});
+        auto propagator = std::make_unique<PropagationEngine>(*store);
+        auto brancher = std::make_unique<BranchingController>(*store, *propagator);
+        return std::make_unique<EnumerationController>(
+            std::move(store), std::move(propagator), std::move(brancher),
+            std::make_unique<AcceptAllHashVerifier>());
+    }
+    /**
+     * @brief Pseudo-random ones at ~20% density in the top-left 26x26 corner. Its cross-sums
+     *        have exactly one solution, but initial propagation alone does not reach it, so
+     *        the search has to branch.
+     * @return The target matrix.
+     */
+    crsce::common::Csm makeBranchingTarget() {
+        crsce::common::Csm target;
+        std::uint32_t x = 2654435761U;
+        for (std::uint16_t r = 0; r < 26; ++r) {
+            for (std::uint16_t c = 0; c < 26; ++c) {
+                x = (x * 1103515245U) + 12345U;
+                if (((x >> 16U) % 100U) < 20U) {
+                    target.set(r, c, 1);
+                }
+            }
+        }
+        return target;
+    }
 } // namespace
 
 // ---------------------------------------------------------------------------
@@ -1014,3 +1090,86 @@ TEST(EnumerationControllerDfsTest, TwoByTwoCornerFullyDetermined) {
     // Solution is yielded without hash verification (all-forced path)
     EXPECT_EQ(solutionCount, 1);
 }
+
+
+/**
+ * @brief rankLex() on a matrix with a unique solution ranks it 0 without a full enumeration.
+ */
+TEST(EnumerationControllerTest, RankLexAllZerosIsZero) {
+    const crsce::common::Csm target;
+    auto enumerator = makeControllerFor(target);
+    const auto rank = enumerator->rankLex(target, 255, std::chrono::steady_clock::now() + std::chrono::seconds(30));
+    EXPECT_EQ(rank.outcome, LexRank::Outcome::Found);
+    EXPECT_EQ(rank.rank, 0U);
+}
+
+/**
+ * @brief rankLex() reports NotFound for a matrix that does not satisfy the cross-sums.
+ */
+TEST(EnumerationControllerTest, RankLexNonSolutionIsNotFound) {
+    auto enumerator = makeControllerFor(crsce::common::Csm{});
+    crsce::common::Csm other;
+    other.set(3, 4, 1);
+    const auto rank = enumerator->rankLex(other, 255, std::chrono::steady_clock::now() + std::chrono::seconds(30));
+    EXPECT_EQ(rank.outcome, LexRank::Outcome::NotFound);
+}
+
+/**
+ * @brief rankLex() agrees with the position enumerateSolutionsLex() yields the target at.
+ */
+TEST(EnumerationControllerTest, RankLexMatchesEnumerationOrder) {
+    const auto target = makeBranchingTarget();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+
+    auto ranker = makeControllerFor(target);
+    const auto rank = ranker->rankLex(target, 255, deadline);
+    ASSERT_EQ(rank.outcome, LexRank::Outcome::Found);
+
+    auto enumerator = makeControllerFor(target);
+    std::uint32_t position = 0;
+    for (const auto &csm : enumerator->enumerateSolutionsLex()) {
+        if (csm.vec() == target.vec()) {
+            break;
+        }
+        ++position;
+    }
+    EXPECT_EQ(rank.rank, position);
+    EXPECT_EQ(rank.rank, 0U);
+}
+
+/**
+ * @brief ParallelLexSelector returns the same k-th solution as serial enumerateSolutionsLex(),
+ *        and nullopt once k passes the last one.
+ */
+TEST(ParallelLexSelectorTest, SelectMatchesSerialEnumeration) {
+    const auto target = makeBranchingTarget();
+    std::vector<crsce::common::Csm> serial;
+    {
+        auto enumerator = makeControllerFor(target);
+        for (const auto &csm : enumerator->enumerateSolutionsLex()) {
+            serial.push_back(csm);
+        }
+    }
+    ASSERT_EQ(serial.size(), 1U);
+    EXPECT_EQ(serial[0].vec(), target.vec());
+
+    ParallelLexSelector selector([&target] { return makeControllerFor(target); }, 3);
+    for (std::uint32_t k = 0; k < serial.size(); ++k) {
+        const auto got = selector.select(k);
+        ASSERT_TRUE(got.has_value()) << "k=" << k;
+        EXPECT_EQ(got->vec(), serial[k].vec()) << "k=" << k;
+    }
+    EXPECT_FALSE(selector.select(static_cast<std::uint32_t>(serial.size())).has_value());
+}
+
+/**
+ * @brief ParallelLexSelector on a fully determined system: k=0 is the only solution, k=1 has none.
+ */
+TEST(ParallelLexSelectorTest, SingleSolutionSystem) {
+    const crsce::common::Csm zero;
+    ParallelLexSelector selector([&zero] { return makeControllerFor(zero); }, 2);
+    const auto first = selector.select(0);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->vec(), zero.vec());
+    EXPECT_FALSE(selector.select(1).has_value());
+}
@@ -0,0 +1,84 @@
+/**
+ * @file unit_block_padding_test.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Unit tests for assignPadding (pre-assigned zero padding of a partial block).
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common/Csm/CsmLayout.h"
+#include "decompress/Solvers/BlockPadding.h"
+#include "decompress/Solvers/CellState.h"
+#include "decompress/Solvers/ConstraintStore.h"
+
+using crsce::common::csmlayout::cellOf;
+using crsce::common::csmlayout::Layout;
+using crsce::decompress::solvers::assignPadding;
+using crsce::decompress::solvers::CellState;
+using crsce::decompress::solvers::ConstraintStore;
+
+namespace {
+    constexpr std::uint16_t kS = 127;
+    constexpr std::uint32_t kBlockBits = kS * kS;
+
+    /**
+     * @brief A store whose rows and columns each hold kS ones (every cell is a 1 in truth).
+     */
+    ConstraintStore makeFullStore() {
+        return {std::vector<std::uint16_t>(kS, kS), std::vector<std::uint16_t>(kS, kS),
+                std::vector<std::uint16_t>((2 * kS) - 1, 0), std::vector<std::uint16_t>((2 * kS) - 1, 0),
+                std::vector<std::uint16_t>(kS, 0), std::vector<std::uint16_t>(kS, 0),
+                std::vector<std::uint16_t>{}, std::vector<std::uint16_t>{},
+                std::vector<std::uint16_t>{}, std::vector<std::uint16_t>{}};
+    }
+
+    /**
+     * @brief Count unassigned cells in the store.
+     */
+    std::uint32_t unknownCells(const ConstraintStore &store) {
+        std::uint32_t n = 0;
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            n += store.getRowUnknownCount(r);
+        }
+        return n;
+    }
+} // namespace
+
+/**
+ * @brief A full block has no padding: nothing is assigned.
+ */
+TEST(BlockPaddingTest, FullBlockAssignsNothing) {
+    auto store = makeFullStore();
+    EXPECT_EQ(assignPadding(store, kBlockBits, Layout::RowMajor), 0U);
+    EXPECT_EQ(unknownCells(store), kBlockBits);
+}
+
+/**
+ * @brief Row-major padding is the tail of the matrix: the last row and the end of the one before.
+ */
+TEST(BlockPaddingTest, RowMajorPaddingIsTheMatrixTail) {
+    auto store = makeFullStore();
+    constexpr std::uint32_t kValid = kBlockBits - kS - 10;
+    EXPECT_EQ(assignPadding(store, kValid, Layout::RowMajor), kS + 10U);
+    EXPECT_EQ(store.getCellState(kS - 2, kS - 11), CellState::Unassigned);
+    EXPECT_EQ(store.getCellState(kS - 2, kS - 10), CellState::Zero);
+    EXPECT_EQ(store.getRowUnknownCount(kS - 1), 0U);
+    EXPECT_EQ(unknownCells(store), kValid);
+}
+
+/**
+ * @brief Under another layout the padding lands on the cells that layout maps the tail bits to.
+ */
+TEST(BlockPaddingTest, PaddingFollowsTheLayout) {
+    auto store = makeFullStore();
+    constexpr std::uint32_t kValid = 500;
+    EXPECT_EQ(assignPadding(store, kValid, Layout::Transpose), kBlockBits - kValid);
+    for (std::uint32_t i = 0; i < kBlockBits; ++i) {
+        const auto p = cellOf(Layout::Transpose, static_cast<std::uint16_t>(i));
+        const auto want = i < kValid ? CellState::Unassigned : CellState::Zero;
+        ASSERT_EQ(store.getCellState(static_cast<std::uint16_t>(p / kS), static_cast<std::uint16_t>(p % kS)), want)
+            << "bit " << i;
+    }
+}
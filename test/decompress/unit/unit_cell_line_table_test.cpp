@@ -0,0 +1,66 @@
+/**
+ * @file unit_cell_line_table_test.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Unit tests for cellLineTable (per-cell flat line indices).
+ */
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "decompress/Solvers/CellLineTable.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/LtpTable.h"
+
+using crsce::decompress::solvers::cellLineTable;
+using crsce::decompress::solvers::ConstraintStore;
+using crsce::decompress::solvers::LineID;
+using crsce::decompress::solvers::LineType;
+using crsce::decompress::solvers::ltpMembership;
+
+namespace {
+    constexpr std::uint16_t kS = 127;
+} // namespace
+
+/**
+ * @brief The table is cache-line aligned, so every 16-byte entry sits inside one line.
+ */
+TEST(CellLineTableTest, TableIsCacheLineAligned) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(cellLineTable()) % 64U, 0U); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/**
+ * @brief Every entry matches the line geometry and the LTP membership it was built from.
+ */
+TEST(CellLineTableTest, EntriesMatchGeometryAndLtpMembership) {
+    const auto *table = cellLineTable();
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            const auto &e = table[(static_cast<std::size_t>(r) * kS) + c]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto &mem = ltpMembership(r, c);
+            ASSERT_EQ(e.count, 4U + mem.count) << r << "," << c;
+            EXPECT_EQ(e.flat[0], ConstraintStore::lineIndex(LineID{.type = LineType::Row, .index = r}));
+            EXPECT_EQ(e.flat[1], ConstraintStore::lineIndex(LineID{.type = LineType::Column, .index = c}));
+            EXPECT_EQ(e.flat[2], ConstraintStore::lineIndex(
+                LineID{.type = LineType::Diagonal, .index = static_cast<std::uint16_t>(c - r + (kS - 1))}));
+            EXPECT_EQ(e.flat[3], ConstraintStore::lineIndex(
+                LineID{.type = LineType::AntiDiagonal, .index = static_cast<std::uint16_t>(r + c)}));
+            for (std::uint8_t j = 0; j < mem.count; ++j) {
+                EXPECT_EQ(e.flat[4U + j], mem.flat[j]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+        }
+    }
+}
+
+/**
+ * @brief ConstraintStore::cellLines reads the same table.
+ */
+TEST(CellLineTableTest, StoreUsesTheTable) {
+    const std::vector<std::uint16_t> zeros(kS, 0);
+    const std::vector<std::uint16_t> diagZeros((2 * kS) - 1, 0);
+    const std::vector<std::uint16_t> none;
+    const ConstraintStore store(zeros, zeros, diagZeros, diagZeros, zeros, zeros, none, none, none, none);
+    EXPECT_EQ(&store.cellLines(5, 9), &cellLineTable()[(5 * kS) + 9]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
@@ -0,0 +1,97 @@
+/**
+ * @file unit_crc32_row_completer_test.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Unit tests for Crc32RowCompleter.
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "common/Util/crc32_ieee.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/Crc32RowCompleter.h"
+#include "decompress/Solvers/LtpTable.h"
+
+using crsce::decompress::solvers::ConstraintStore;
+using crsce::decompress::solvers::Crc32RowCompleter;
+using crsce::decompress::solvers::kLtpNumLines;
+using crsce::decompress::solvers::ltpLineLen;
+
+namespace {
+    constexpr std::uint16_t kS = 127;
+    constexpr std::uint16_t kNumDiags = (2 * kS) - 1;
+
+    /**
+     * @brief Bit c of row 0 in the test matrix.
+     */
+    std::uint8_t targetBit(const std::uint16_t c) {
+        return ((static_cast<std::uint32_t>(c) * 37U) % 5U) < 2U ? 1 : 0;
+    }
+
+    /**
+     * @brief CRC-32 of row 0 as the compressor computes it (16-byte MSB-first message).
+     */
+    std::uint32_t targetCrc() {
+        std::array<std::uint8_t, 16> msg{};
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            if (targetBit(c) != 0) {
+                msg[c / 8U] |= static_cast<std::uint8_t>(1U << (7U - (c % 8U))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+        }
+        return crsce::common::util::crc32_ieee(msg.data(), msg.size());
+    }
+
+    /**
+     * @brief A store whose row 0 sum matches the target (no propagation runs, so only row stats matter).
+     */
+    ConstraintStore makeLooseStore() {
+        const std::vector<std::uint16_t> empty;
+        std::vector<std::uint16_t> ltpSums(kLtpNumLines);
+        for (std::uint16_t k = 0; k < kLtpNumLines; ++k) {
+            ltpSums[k] = static_cast<std::uint16_t>(ltpLineLen(k) / 2U);
+        }
+        std::vector<std::uint16_t> rowSums(kS, kS / 2);
+        rowSums[0] = 0;
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            rowSums[0] = static_cast<std::uint16_t>(rowSums[0] + targetBit(c));
+        }
+        return {rowSums, std::vector<std::uint16_t>(kS, kS / 2),
+                std::vector<std::uint16_t>(kNumDiags, 0), std::vector<std::uint16_t>(kNumDiags, 0),
+                ltpSums, ltpSums, empty, empty, empty, empty};
+    }
+} // namespace
+
+/**
+ * @brief With exactly 32 unknowns, a completion reported as unique must be the true row.
+ *
+ * The 32 CRC-32 equations need not have full rank over 32 unknowns. The free-variable mask
+ * must still cover all 32 columns; otherwise a dependent column was dropped silently and the
+ * pivot values returned were wrong.
+ */
+TEST(Crc32RowCompleterTest, ThirtyTwoUnknownsNeverReportsWrongUniqueCompletion) {
+    std::array<std::uint32_t, kS> crcs{};
+    crcs[0] = targetCrc();
+    const Crc32RowCompleter completer(crcs);
+
+    // Try every window of 32 unknown columns; some are rank-deficient
+    for (std::uint16_t start = 0; start + 32 <= kS; ++start) {
+        auto store = makeLooseStore();
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            if (c < start || c >= start + 32) {
+                store.assign(0, c, targetBit(c));
+            }
+        }
+        const auto result = completer.tryCompleteRow(0, store);
+        ASSERT_TRUE(result.feasible) << "window " << start;
+        if (result.freeVariables != 0) {
+            continue;
+        }
+        ASSERT_EQ(result.numAssigned, 32) << "window " << start;
+        for (std::uint8_t i = 0; i < result.numAssigned; ++i) {
+            const auto [c, v] = result.assignments[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            EXPECT_EQ(v, targetBit(c)) << "window " << start << " col " << c;
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/**
+ * @file unit_forced_block_test.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Unit tests for solveForced (solver-free blocks that initial propagation determines).
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/BlockHash/BlockHash.h"
+#include "common/Csm/Csm.h"
+#include "common/Csm/CsmLayout.h"
+#include "common/Format/CompressedPayload/CompressedPayload.h"
+#include "common/Format/CompressedPayload/CompressedPayloadView.h"
+#include "decompress/Solvers/ForcedBlock.h"
+#include "decompress/Solvers/LtpTable.h"
+#include "decompress/Solvers/Sha1HashVerifier.h"
+
+using crsce::common::Csm;
+using crsce::common::format::CompressedPayload;
+using crsce::common::format::CompressedPayloadView;
+using crsce::decompress::solvers::Sha1HashVerifier;
+using crsce::decompress::solvers::solveForced;
+
+namespace {
+    constexpr std::uint16_t kS = 127;
+
+    /**
+     * @brief Serialize a payload carrying csm's cross-sums, lateral hashes and block hash.
+     */
+    std::vector<std::uint8_t> payloadFor(const Csm &csm) {
+        namespace solvers = crsce::decompress::solvers;
+        CompressedPayload payload;
+        std::vector<std::uint16_t> col(kS, 0);
+        std::vector<std::uint16_t> diag(CompressedPayload::kDiagCount, 0);
+        std::vector<std::uint16_t> anti(CompressedPayload::kDiagCount, 0);
+        std::vector<std::uint16_t> ltp1(kS, 0);
+        std::vector<std::uint16_t> ltp2(kS, 0);
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            for (std::uint16_t c = 0; c < kS; ++c) {
+                if (csm.get(r, c) == 0) {
+                    continue;
+                }
+                ++col[c];
+                ++diag[c - r + kS - 1];
+                ++anti[r + c];
+                const auto &mem = solvers::ltpMembership(r, c);
+                for (std::uint8_t j = 0; j < mem.count; ++j) {
+                    const auto f = mem.flat[j]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    if (f < solvers::kLtp2Base) {
+                        ++ltp1[f - solvers::kLtp1Base];
+                    } else {
+                        ++ltp2[f - solvers::kLtp2Base];
+                    }
+                }
+            }
+        }
+        const Sha1HashVerifier hasher(kS);
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            payload.setLSM(r, csm.popcount(r));
+            payload.setVSM(r, col[r]);
+            payload.setLTP1SM(r, ltp1[r]);
+            payload.setLTP2SM(r, ltp2[r]);
+            const auto digest = hasher.computeHash(csm.getRow(r));
+            std::array<std::uint8_t, CompressedPayload::kLHDigestBytes> lh{};
+            for (std::size_t i = 0; i < lh.size(); ++i) {
+                lh[i] = digest[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+            payload.setLH(r, lh);
+        }
+        for (std::uint16_t d = 0; d < CompressedPayload::kDiagCount; ++d) {
+            payload.setDSM(d, diag[d]);
+            payload.setXSM(d, anti[d]);
+        }
+        payload.setBH(crsce::common::BlockHash::compute(csm));
+        return payload.serializeBlock();
+    }
+
+    /**
+     * @brief Expect solveForced to rebuild csm exactly from its payload.
+     */
+    void expectRebuilt(const Csm &csm, const std::uint32_t validBits = kS * kS) {
+        const auto bytes = payloadFor(csm);
+        const auto got = solveForced(CompressedPayloadView(bytes.data(), bytes.size()), validBits);
+        ASSERT_TRUE(got.has_value());
+        for (std::uint16_t r = 0; r < kS; ++r) {
+            EXPECT_EQ(got->getRow(r), csm.getRow(r)) << "row " << r;
+        }
+    }
+} // namespace
+
+TEST(ForcedBlockTest, AllZeroBlock) {
+    expectRebuilt(Csm{});
+}
+
+TEST(ForcedBlockTest, AllOneBlock) {
+    Csm csm;
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            csm.set(r, c, 1);
+        }
+    }
+    expectRebuilt(csm);
+}
+
+TEST(ForcedBlockTest, RowStripes) {
+    Csm csm;
+    for (std::uint16_t r = 0; r < kS; r += 3) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            csm.set(r, c, 1);
+        }
+    }
+    expectRebuilt(csm);
+}
+
+TEST(ForcedBlockTest, ColumnStripes) {
+    Csm csm;
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 1; c < kS; c += 5) {
+            csm.set(r, c, 1);
+        }
+    }
+    expectRebuilt(csm);
+}
+
+TEST(ForcedBlockTest, SingleCellPinnedByItsColumn) {
+    // Row 3 has sum 1, which no row-or-column family rule fixes; its column places the 1.
+    Csm csm;
+    csm.set(3, 4, 1);
+    expectRebuilt(csm);
+}
+
+TEST(ForcedBlockTest, SparseBlock) {
+    Csm csm;
+    csm.set(0, 0, 1);
+    csm.set(6, 15, 1);
+    csm.set(39, 47, 1);
+    csm.set(97, 26, 1);
+    expectRebuilt(csm);
+}
+
+TEST(ForcedBlockTest, ZeroPaddedShortBlock) {
+    // 300 data bits of ones, then padding: the padding cells are assigned before propagating.
+    Csm csm;
+    for (std::uint32_t i = 0; i < 300; ++i) {
+        csm.set(static_cast<std::uint16_t>(i / kS), static_cast<std::uint16_t>(i % kS), 1);
+    }
+    expectRebuilt(csm, 300);
+}
+
+TEST(ForcedBlockTest, DenseBlockIsLeftToTheSolver) {
+    Csm csm;
+    std::uint32_t x = 0x9E3779B9U;
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            x ^= x << 13U;
+            x ^= x >> 17U;
+            x ^= x << 5U;
+            csm.set(r, c, static_cast<std::uint8_t>(x & 1U));
+        }
+    }
+    const auto bytes = payloadFor(csm);
+    EXPECT_FALSE(solveForced(CompressedPayloadView(bytes.data(), bytes.size())).has_value());
+}
+
+TEST(ForcedBlockTest, HashMismatchIsLeftToTheSolver) {
+    auto bytes = payloadFor(Csm{});
+    bytes[0] ^= 0x01U; // LH[0] leads the payload
+    EXPECT_FALSE(solveForced(CompressedPayloadView(bytes.data(), bytes.size())).has_value());
+}
@@ -0,0 +1,195 @@
+/**
+ * @file unit_lex_pruner_test.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Unit tests for LexPruner (CRC-32 row completion for lex enumeration).
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "decompress/Solvers/BranchingController.h"
+#include "decompress/Solvers/CellState.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/IPropagationEngine.h"
+#include "decompress/Solvers/LexPruner.h"
+#include "decompress/Solvers/LtpTable.h"
+#include "decompress/Solvers/PropagationEngine.h"
+#include "decompress/Solvers/Sha1HashVerifier.h"
+
+using crsce::decompress::solvers::Assignment;
+using crsce::decompress::solvers::BranchingController;
+using crsce::decompress::solvers::CellState;
+using crsce::decompress::solvers::ConstraintStore;
+using crsce::decompress::solvers::kLtpNumLines;
+using crsce::decompress::solvers::LexPruner;
+using crsce::decompress::solvers::ltpLineLen;
+using crsce::decompress::solvers::PropagationEngine;
+using crsce::decompress::solvers::Sha1HashVerifier;
+
+namespace {
+    constexpr std::uint16_t kS = 127;
+    constexpr std::uint16_t kNumDiags = (2 * kS) - 1;
+
+    /**
+     * @brief Build a mid-range ConstraintStore where no single-cell assignment triggers forcing.
+     */
+    ConstraintStore makeMidRangeStore() {
+        std::vector<std::uint16_t> diagSums(kNumDiags, 0);
+        std::vector<std::uint16_t> antiDiagSums(kNumDiags, 0);
+        for (std::uint16_t d = 0; d < kNumDiags; ++d) {
+            const auto len = std::min({static_cast<int>(d + 1),
+                                       static_cast<int>(kS),
+                                       static_cast<int>(kNumDiags - d)});
+            diagSums[d] = static_cast<std::uint16_t>(len / 2);
+            antiDiagSums[d] = static_cast<std::uint16_t>(len / 2);
+        }
+        std::vector<std::uint16_t> ltpSums(kLtpNumLines);
+        for (std::uint16_t k = 0; k < kLtpNumLines; ++k) {
+            ltpSums[k] = static_cast<std::uint16_t>(ltpLineLen(k) / 2U);
+        }
+        return {std::vector<std::uint16_t>(kS, static_cast<std::uint16_t>(kS / 2)),
+                std::vector<std::uint16_t>(kS, static_cast<std::uint16_t>(kS / 2)),
+                diagSums, antiDiagSums,
+                ltpSums, ltpSums, ltpSums, ltpSums, ltpSums, ltpSums};
+    }
+
+    /**
+     * @brief Bit c of the row-0 target: a permutation pattern with exactly kS / 2 ones.
+     *
+     * Columns 0 and 126 are 0, as the store's length-1 diagonals force them to be.
+     */
+    std::uint8_t targetBit(const std::uint16_t c) {
+        const auto p = (static_cast<std::uint32_t>(c) * 37U) % kS;
+        return (p >= 1 && p <= kS / 2) ? 1 : 0;
+    }
+
+    /**
+     * @brief Pack the row-0 target, optionally flipping one column, in getRow() format.
+     */
+    std::array<std::uint64_t, 2> targetRow(const int flipCol = -1) {
+        std::array<std::uint64_t, 2> row{};
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            std::uint8_t bit = targetBit(c);
+            if (c == flipCol) {
+                bit ^= 1U;
+            }
+            if (bit != 0) {
+                row[c / 64U] |= std::uint64_t{1} << (63U - (c % 64U)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+        }
+        return row;
+    }
+
+    /**
+     * @brief Solver components around a mid-range store, with row 0 expecting `expectedRow0`.
+     */
+    struct Fixture {
+        ConstraintStore store = makeMidRangeStore();
+        PropagationEngine propagator{store};
+        BranchingController brancher{store, propagator};
+        Sha1HashVerifier hasher{kS};
+
+        explicit Fixture(const std::array<std::uint64_t, 2> &expectedRow0) {
+            const std::array<std::uint64_t, 2> zeroRow{};
+            hasher.setExpected(0, hasher.computeHash(expectedRow0));
+            for (std::uint16_t r = 1; r < kS; ++r) {
+                hasher.setExpected(r, hasher.computeHash(zeroRow));
+            }
+        }
+
+        /**
+         * @brief Assign row 0 to the target left to right, without propagating, until `unknown` cells remain.
+         */
+        void assignUntilUnknown(const std::uint16_t unknown) {
+            for (std::uint16_t c = 0; c < kS && store.getStatDirect(0).unknown > unknown; ++c) {
+                if (store.getCellState(0, c) == CellState::Unassigned) {
+                    store.assign(0, c, targetBit(c));
+                    brancher.recordAssignment(0, c);
+                }
+            }
+        }
+    };
+} // namespace
+
+// ---------------------------------------------------------------------------
+// CRC-32 row completion
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief A row with 32 unknowns is completed to the values its CRC-32 determines.
+ */
+TEST(LexPrunerTest, ExtendCompletesRowFromCrc) {
+    Fixture f(targetRow());
+    LexPruner pruner(f.store, f.brancher, f.hasher);
+    ASSERT_TRUE(pruner.prepareRoot());
+
+    const auto before = f.store.getStatDirect(0).unknown;
+    const auto token = f.brancher.saveUndoPoint();
+    f.assignUntilUnknown(32);
+    ASSERT_TRUE(pruner.extend(0, std::span<const Assignment>{}));
+
+    EXPECT_EQ(f.store.getStatDirect(0).unknown, 0);
+    // Propagating the first completed cells may force the last few before CRC-32 reaches them
+    EXPECT_GT(pruner.crcForcedCells(), 0U);
+    EXPECT_LE(pruner.crcForcedCells(), 32U);
+    for (std::uint16_t c = 0; c < kS; ++c) {
+        EXPECT_EQ(f.store.getCellValue(0, c), targetBit(c)) << "col " << c;
+    }
+
+    // Everything the completion assigned is on the undo stack
+    f.brancher.undoToSavePoint(token);
+    EXPECT_EQ(f.store.getStatDirect(0).unknown, before);
+}
+
+/**
+ * @brief An overdetermined row whose known cells contradict its CRC-32 is pruned.
+ */
+TEST(LexPrunerTest, ExtendRejectsInconsistentRow) {
+    Fixture f(targetRow(5));
+    LexPruner pruner(f.store, f.brancher, f.hasher);
+    ASSERT_TRUE(pruner.prepareRoot());
+
+    const auto before = f.store.getStatDirect(0).unknown;
+    const auto token = f.brancher.saveUndoPoint();
+    f.assignUntilUnknown(16);
+    EXPECT_FALSE(pruner.extend(0, std::span<const Assignment>{}));
+    EXPECT_EQ(pruner.crcPrunes(), 1U);
+    f.brancher.undoToSavePoint(token);
+    EXPECT_EQ(f.store.getStatDirect(0).unknown, before);
+}
+
+/**
+ * @brief Rows with more than 32 unknowns are left alone.
+ */
+TEST(LexPrunerTest, ExtendIgnoresRowsAboveThreshold) {
+    Fixture f(targetRow());
+    LexPruner pruner(f.store, f.brancher, f.hasher);
+    ASSERT_TRUE(pruner.prepareRoot());
+
+    f.assignUntilUnknown(33);
+    EXPECT_TRUE(pruner.extend(0, std::span<const Assignment>{}));
+    EXPECT_EQ(f.store.getStatDirect(0).unknown, 33);
+    EXPECT_EQ(pruner.crcForcedCells(), 0U);
+}
+
+// ---------------------------------------------------------------------------
+// Stall-time lookahead
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Before any stall the lookahead admits every value without probing.
+ */
+TEST(LexPrunerTest, AdmitsWithoutProbingWhenNotStalled) {
+    Fixture f(targetRow());
+    LexPruner pruner(f.store, f.brancher, f.hasher);
+    ASSERT_TRUE(pruner.prepareRoot());
+
+    pruner.observeDepth(1);
+    EXPECT_TRUE(pruner.admits(0, 0, 0));
+    EXPECT_TRUE(pruner.admits(0, 0, 1));
+    EXPECT_EQ(pruner.stallProbes(), 0U);
+}
@@ -0,0 +1,106 @@
+/**
+ * @file unit_line_mask_table_test.cpp
+ * @copyright (c) 2026 Sam Caldwell. See LICENSE.txt for details.
+ * @brief Unit tests for lineMaskTable and ConstraintStore::forEachUnassignedOnLine.
+ */
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "decompress/Solvers/CellLineTable.h"
+#include "decompress/Solvers/ConstraintStore.h"
+#include "decompress/Solvers/LineID.h"
+#include "decompress/Solvers/LineMaskTable.h"
+
+using crsce::decompress::solvers::cellLineTable;
+using crsce::decompress::solvers::ConstraintStore;
+using crsce::decompress::solvers::kCellLineNone;
+using crsce::decompress::solvers::LineID;
+using crsce::decompress::solvers::LineType;
+using crsce::decompress::solvers::lineMaskTable;
+
+namespace {
+    constexpr std::uint16_t kS = 127;
+
+    /**
+     * @brief A store with every target zero (the sums do not matter to these tests).
+     */
+    ConstraintStore makeStore() {
+        const std::vector<std::uint16_t> zeros(kS, 0);
+        const std::vector<std::uint16_t> diagZeros((2 * kS) - 1, 0);
+        const std::vector<std::uint16_t> none;
+        return {zeros, zeros, diagZeros, diagZeros, zeros, zeros, none, none, none, none};
+    }
+} // namespace
+
+/**
+ * @brief Each mask holds exactly the cells whose cellLineTable entry names the line.
+ */
+TEST(LineMaskTableTest, MasksInvertTheCellLineTable) {
+    const auto *masks = lineMaskTable();
+    const auto *cells = cellLineTable();
+    std::vector<std::size_t> members(kCellLineNone, 0);
+    for (std::uint16_t r = 0; r < kS; ++r) {
+        for (std::uint16_t c = 0; c < kS; ++c) {
+            const auto &e = cells[(static_cast<std::size_t>(r) * kS) + c]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            for (std::uint8_t j = 0; j < e.count; ++j) {
+                const auto &m = masks[e.flat[j]]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-pro-bounds-constant-array-index)
+                EXPECT_NE((m.words[r][c / 64U] >> (c % 64U)) & 1U, 0U) << r << "," << c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                EXPECT_GE(r, m.rowLo);
+                EXPECT_LE(r, m.rowHi);
+                ++members[e.flat[j]]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+        }
+    }
+    for (std::uint16_t idx = 0; idx < kCellLineNone; ++idx) {
+        std::size_t bits = 0;
+        for (const auto &row : masks[idx].words) { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            bits += static_cast<std::size_t>(std::popcount(row[0]) + std::popcount(row[1]));
+        }
+        EXPECT_EQ(bits, members[idx]) << "line " << idx; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+}
+
+/**
+ * @brief forEachUnassignedOnLine visits only the line's unassigned cells, in row-major order.
+ */
+TEST(LineMaskTableTest, ForEachUnassignedOnLineSkipsAssignedCells) {
+    auto store = makeStore();
+    const LineID diag{.type = LineType::Diagonal, .index = kS + 9}; // cells (r, r + 10)
+    store.assign(0, 10, 0);
+    store.assign(50, 60, 1);
+    std::vector<std::pair<std::uint16_t, std::uint16_t>> seen;
+    store.forEachUnassignedOnLine(ConstraintStore::lineIndex(diag), [&](const std::uint16_t r, const std::uint16_t c) {
+        seen.emplace_back(r, c);
+    });
+    ASSERT_EQ(seen.size(), static_cast<std::size_t>(kS - 10 - 2));
+    EXPECT_EQ(seen.front(), std::make_pair(std::uint16_t{1}, std::uint16_t{11}));
+    EXPECT_EQ(seen.back(), std::make_pair(std::uint16_t{kS - 11}, std::uint16_t{kS - 1}));
+    for (std::size_t i = 1; i < seen.size(); ++i) {
+        EXPECT_LT(seen[i - 1].first, seen[i].first);
+        EXPECT_EQ(seen[i].second, seen[i].first + 10);
+        EXPECT_NE(seen[i].first, 50U);
+    }
+}
+
+/**
+ * @brief Cells the callback assigns are not visited afterwards.
+ */
+TEST(LineMaskTableTest, ForEachUnassignedOnLineSeesAssignmentsMadeByTheCallback) {
+    auto store = makeStore();
+    const LineID row{.type = LineType::Row, .index = 7};
+    std::size_t visits = 0;
+    store.forEachUnassignedOnLine(ConstraintStore::lineIndex(row), [&](const std::uint16_t r, const std::uint16_t c) {
+        ++visits;
+        store.assign(r, c, 0);
+        if (c + 1U < kS) {
+            store.assign(r, static_cast<std::uint16_t>(c + 1U), 0);
+        }
+    });
+    EXPECT_EQ(visits, (kS + 1U) / 2U);
+    EXPECT_EQ(store.getRowUnknownCount(7), 0U);
+}